@@ -0,0 +1,305 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Times B := A for every pair of distributions [U,V] -> [W,Z] (and for
+// [MC,MR] copies between grids of different shapes) over a range of sizes,
+// with A aligned and misaligned relative to B, and compares the achieved
+// bandwidth against the bandwidth of a ring exchange of the same processes.
+//
+// The communication volume of a redistribution is taken to be the number of
+// entries of B which a process owns but which it did not own in A, which is
+// the minimum amount of data that it must receive.
+
+vector<string> SplitList( const string& list )
+{
+    vector<string> items;
+    istringstream stream( list );
+    string item;
+    while( getline( stream, item, ',' ) )
+        if( !item.empty() )
+            items.push_back( item );
+    return items;
+}
+
+struct RedistCtrl
+{
+    Int numReps;
+    string pattern;
+    bool progress;
+    double linkGBs;
+};
+
+// The per-process bandwidth of each process simultaneously sending 'numBytes'
+// to its successor and receiving from its predecessor
+double RingBandwidth( Int numBytes, Int numReps, mpi::Comm comm )
+{
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    const Int to = (commRank+1) % commSize;
+    const Int from = (commRank+commSize-1) % commSize;
+    vector<byte> sendBuf(numBytes,1), recvBuf(numBytes);
+    double bestTime = numeric_limits<double>::max();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        mpi::Barrier( comm );
+        const double startTime = mpi::Time();
+        mpi::SendRecv
+        ( sendBuf.data(), numBytes, to, recvBuf.data(), numBytes, from, comm );
+        mpi::Barrier( comm );
+        bestTime = Min( bestTime, mpi::Time()-startTime );
+    }
+    return numBytes/(1e9*bestTime);
+}
+
+// The number of entries of B which this process owns but which it does not
+// own in A. Since ownership is the product of row and column ownership, this
+// only requires a pass over the local rows and columns of B.
+template<typename T>
+Int ReceiveVolume
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    Int overlapHeight=0, overlapWidth=0;
+    for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+        if( A.IsLocalRow( B.GlobalRow(iLoc) ) )
+            ++overlapHeight;
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        if( A.IsLocalCol( B.GlobalCol(jLoc) ) )
+            ++overlapWidth;
+    return B.LocalHeight()*B.LocalWidth() - overlapHeight*overlapWidth;
+}
+
+template<typename T>
+void TimeCopy
+( const string& label, const AbstractDistMatrix<T>& A,
+  AbstractDistMatrix<T>& B, bool aligned, const RedistCtrl& ctrl,
+  vector<string>& results )
+{
+    const Grid& g = B.Grid();
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    double bestTime = numeric_limits<double>::max();
+    for( Int rep=0; rep<ctrl.numReps; ++rep )
+    {
+        mpi::Barrier( comm );
+        const double startTime = mpi::Time();
+        Copy( A, B );
+        mpi::Barrier( comm );
+        bestTime = Min( bestTime, mpi::Time()-startTime );
+    }
+
+    const double recvBytes = double(ReceiveVolume(A,B))*sizeof(T);
+    const double maxRecvBytes = mpi::AllReduce( recvBytes, mpi::MAX, comm );
+    const double totalRecvBytes = mpi::AllReduce( recvBytes, comm );
+    const double gbs = maxRecvBytes/(1e9*bestTime);
+    const double efficiency = gbs/ctrl.linkGBs;
+
+    ostringstream os;
+    os << "    {\"redistribution\": \"" << label << "\", "
+       << "\"m\": " << A.Height() << ", "
+       << "\"n\": " << A.Width() << ", "
+       << "\"gridHeight\": " << g.Height() << ", "
+       << "\"gridWidth\": " << g.Width() << ", "
+       << "\"aligned\": " << ( aligned ? "true" : "false" ) << ", "
+       << "\"seconds\": " << bestTime << ", "
+       << "\"maxRecvMB\": " << maxRecvBytes/1e6 << ", "
+       << "\"totalRecvMB\": " << totalRecvBytes/1e6 << ", "
+       << "\"gbs\": " << gbs << ", "
+       << "\"efficiency\": " << efficiency << "}";
+    results.push_back( os.str() );
+    if( ctrl.progress && mpi::Rank(comm) == 0 )
+        cout << "  " << label << " (" << A.Height() << " x " << A.Width()
+             << ", " << g.Height() << " x " << g.Width() << " grid, "
+             << ( aligned ? "aligned" : "misaligned" ) << "): "
+             << bestTime << " seconds, " << maxRecvBytes/1e6
+             << " MB max received, " << gbs << " GB/s ("
+             << 100*efficiency << "% of ring exchange)" << endl;
+}
+
+template<Dist U,Dist V,Dist W,Dist Z>
+void BenchmarkPair
+( Int m, Int n, const Grid& g, const RedistCtrl& ctrl,
+  vector<string>& results )
+{
+    const string label =
+        string("[") + DistToString(U) + "," + DistToString(V) + "] -> [" +
+        DistToString(W) + "," + DistToString(Z) + "]";
+    if( label.find(ctrl.pattern) == string::npos )
+        return;
+
+    for( Int shift=0; shift<2; ++shift )
+    {
+        DistMatrix<double,U,V> A(g);
+        DistMatrix<double,W,Z> B(g);
+        if( shift == 1 && A.ColStride() == 1 && A.RowStride() == 1 )
+            break;
+        // Constrain the alignments so that the copy cannot simply realign B
+        A.Align( shift % A.ColStride(), shift % A.RowStride() );
+        B.Align( 0, 0 );
+        Uniform( A, m, n );
+        TimeCopy( label, A, B, shift==0, ctrl, results );
+    }
+}
+
+template<Dist U,Dist V>
+void BenchmarkSource
+( Int m, Int n, const Grid& g, const RedistCtrl& ctrl,
+  vector<string>& results )
+{
+    BenchmarkPair<U,V,CIRC,CIRC>( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,MC,  MR  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,MC,  STAR>( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,MD,  STAR>( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,MR,  MC  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,MR,  STAR>( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,STAR,MC  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,STAR,MD  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,STAR,MR  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,STAR,STAR>( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,STAR,VC  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,STAR,VR  >( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,VC,  STAR>( m, n, g, ctrl, results );
+    BenchmarkPair<U,V,VR,  STAR>( m, n, g, ctrl, results );
+}
+
+void BenchmarkAll
+( Int m, Int n, const Grid& g, const RedistCtrl& ctrl,
+  vector<string>& results )
+{
+    BenchmarkSource<CIRC,CIRC>( m, n, g, ctrl, results );
+    BenchmarkSource<MC,  MR  >( m, n, g, ctrl, results );
+    BenchmarkSource<MC,  STAR>( m, n, g, ctrl, results );
+    BenchmarkSource<MD,  STAR>( m, n, g, ctrl, results );
+    BenchmarkSource<MR,  MC  >( m, n, g, ctrl, results );
+    BenchmarkSource<MR,  STAR>( m, n, g, ctrl, results );
+    BenchmarkSource<STAR,MC  >( m, n, g, ctrl, results );
+    BenchmarkSource<STAR,MD  >( m, n, g, ctrl, results );
+    BenchmarkSource<STAR,MR  >( m, n, g, ctrl, results );
+    BenchmarkSource<STAR,STAR>( m, n, g, ctrl, results );
+    BenchmarkSource<STAR,VC  >( m, n, g, ctrl, results );
+    BenchmarkSource<STAR,VR  >( m, n, g, ctrl, results );
+    BenchmarkSource<VC,  STAR>( m, n, g, ctrl, results );
+    BenchmarkSource<VR,  STAR>( m, n, g, ctrl, results );
+}
+
+// [MC,MR] copies from a grid to one of a different shape or ordering
+void BenchmarkCrossGrid
+( Int m, Int n, const Grid& gA, const Grid& gB, const RedistCtrl& ctrl,
+  vector<string>& results )
+{
+    ostringstream os;
+    os << "[MC,MR] (" << gA.Height() << " x " << gA.Width()
+       << ( gA.Order()==COLUMN_MAJOR ? ", column-major" : ", row-major" )
+       << ") -> [MC,MR] (" << gB.Height() << " x " << gB.Width()
+       << ( gB.Order()==COLUMN_MAJOR ? ", column-major" : ", row-major" )
+       << ")";
+    const string label = os.str();
+    if( label.find(ctrl.pattern) == string::npos )
+        return;
+    DistMatrix<double> A(gA), B(gB);
+    Uniform( A, m, n );
+    TimeCopy( label, A, B, true, ctrl, results );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const string sizeList =
+            Input
+            ("--sizes","comma-separated list of sizes",string("1000,4000"));
+        const string gridHeightList =
+            Input
+            ("--gridHeights","comma-separated grid heights (0 for default)",
+             string("0,1"));
+        const Int numReps = Input("--numReps","repetitions per copy",3);
+        const string pattern =
+            Input
+            ("--pattern","only time redistributions containing this string",
+             string(""));
+        const Int ringBytes =
+            Input("--ringBytes","message size of the ring exchange",1<<24);
+        const string filename =
+            Input("--output","JSON output file",string("El_redist.json"));
+        const bool progress = Input("--progress","print progress?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        RedistCtrl ctrl;
+        ctrl.numReps = numReps;
+        ctrl.pattern = pattern;
+        ctrl.progress = progress;
+        ctrl.linkGBs = RingBandwidth( ringBytes, numReps, comm );
+        if( commRank == 0 )
+            cout << "Ring exchange bandwidth: " << ctrl.linkGBs << " GB/s"
+                 << endl;
+
+        vector<Int> sizes;
+        for( const string& size : SplitList(sizeList) )
+            sizes.push_back( atoi(size.c_str()) );
+
+        vector<string> results;
+        for( const string& heightString : SplitList(gridHeightList) )
+        {
+            Int gridHeight = atoi( heightString.c_str() );
+            if( gridHeight == 0 )
+                gridHeight = Grid::FindFactor( commSize );
+            if( gridHeight <= 0 || commSize % gridHeight != 0 )
+            {
+                if( commRank == 0 )
+                    cout << "Skipping grid height " << gridHeight
+                         << " since it does not divide " << commSize << endl;
+                continue;
+            }
+            const Grid g( comm, gridHeight );
+            const Grid gTrans( comm, commSize/gridHeight );
+            const Grid gRowMajor( comm, gridHeight, ROW_MAJOR );
+            for( const Int n : sizes )
+            {
+                BenchmarkAll( n, n, g, ctrl, results );
+                if( gTrans.Height() != g.Height() )
+                    BenchmarkCrossGrid( n, n, g, gTrans, ctrl, results );
+                if( commSize > 1 )
+                    BenchmarkCrossGrid( n, n, g, gRowMajor, ctrl, results );
+            }
+        }
+
+        if( commRank == 0 )
+        {
+            ofstream file( filename.c_str() );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+            file << "{\n"
+                 << "  \"version\": \"" << EL_VERSION_MAJOR << "."
+                 << EL_VERSION_MINOR << "\",\n"
+                 << "  \"commit\": \"" << EL_GIT_SHA1 << "\",\n"
+                 << "  \"processes\": " << commSize << ",\n"
+                 << "  \"numReps\": " << numReps << ",\n"
+                 << "  \"ringGBs\": " << ctrl.linkGBs << ",\n"
+                 << "  \"results\": [\n";
+            for( std::size_t j=0; j<results.size(); ++j )
+                file << results[j] << ( j+1<results.size() ? ",\n" : "\n" );
+            file << "  ]\n}" << endl;
+            cout << "Wrote " << results.size() << " results to " << filename
+                 << endl;
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
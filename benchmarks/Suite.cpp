@@ -0,0 +1,424 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <set>
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/resource.h>
+# include <unistd.h>
+#endif
+using namespace std;
+using namespace El;
+
+// Sweeps the requested routines over problem sizes, scalar types, and grid
+// shapes, and writes the best time of each configuration, its rate, its
+// efficiency relative to a local Gemm, and its change in resident memory as
+// JSON, along with the memory high-water mark of the whole run.
+//
+// The flop counts are the nominal counts for square n x n problems (e.g.,
+// 2/3 n^3 for LU), multiplied by four for complex arithmetic, so that rates
+// can be compared between runs rather than being exact operation counts.
+
+// The peak resident set size of this process in megabytes (zero if it is not
+// available on this platform). Since this is a high-water mark over the life
+// of the process, it is only reported once per run.
+double MaxResidentMB()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage;
+    getrusage( RUSAGE_SELF, &usage );
+# ifdef __APPLE__
+    return usage.ru_maxrss/(1024.*1024.);
+# else
+    return usage.ru_maxrss/1024.;
+# endif
+#else
+    return 0;
+#endif
+}
+
+// The current resident set size of this process in megabytes (zero if it is
+// not available on this platform)
+double ResidentMB()
+{
+#if defined(__linux__)
+    ifstream statm( "/proc/self/statm" );
+    long long pages, residentPages;
+    if( !(statm >> pages >> residentPages) )
+        return 0;
+    return residentPages*double(sysconf(_SC_PAGESIZE))/(1024.*1024.);
+#else
+    return 0;
+#endif
+}
+
+vector<string> SplitList( const string& list )
+{
+    vector<string> items;
+    istringstream stream( list );
+    string item;
+    while( getline( stream, item, ',' ) )
+        if( !item.empty() )
+            items.push_back( item );
+    return items;
+}
+
+template<typename F> string TypeChar();
+template<> string TypeChar<float>() { return "s"; }
+template<> string TypeChar<double>() { return "d"; }
+template<> string TypeChar<Complex<float>>() { return "c"; }
+template<> string TypeChar<Complex<double>>() { return "z"; }
+
+struct BenchmarkCtrl
+{
+    set<string> routines;
+    Int numReps;
+    Int baselineSize;
+    bool progress;
+};
+
+class Recorder
+{
+public:
+    Recorder( const Grid& g, double baselineGFlops, const BenchmarkCtrl& ctrl )
+    : g_(g), baselineGFlops_(baselineGFlops), ctrl_(ctrl)
+    { }
+
+    // Time the best of numReps executions of 'run', each preceded by an
+    // untimed call to 'setup', and record the result. The memory which is
+    // reported is the (maximum over the processes of the) change in the
+    // resident set size over the configuration, which captures the memory
+    // retained by it but not transient workspace which was already released.
+    template<typename Setup,typename Run>
+    void Time
+    ( const string& routine, const string& variant, const string& type,
+      Int n, double flops, Setup setup, Run run )
+    {
+        const double startResidentMB = ResidentMB();
+        double bestTime = numeric_limits<double>::max();
+        for( Int rep=0; rep<ctrl_.numReps; ++rep )
+        {
+            setup();
+            mpi::Barrier( g_.Comm() );
+            const double startTime = mpi::Time();
+            run();
+            mpi::Barrier( g_.Comm() );
+            bestTime = Min( bestTime, mpi::Time()-startTime );
+        }
+        const double residentDeltaMB =
+            mpi::AllReduce
+            ( ResidentMB()-startResidentMB, mpi::MAX, g_.Comm() );
+        const double gflops = flops/(1e9*bestTime);
+        const double efficiency = gflops/(g_.Size()*baselineGFlops_);
+
+        ostringstream os;
+        os << "    {\"routine\": \"" << routine << "\", "
+           << "\"variant\": \"" << variant << "\", "
+           << "\"type\": \"" << type << "\", "
+           << "\"n\": " << n << ", "
+           << "\"gridHeight\": " << g_.Height() << ", "
+           << "\"gridWidth\": " << g_.Width() << ", "
+           << "\"seconds\": " << bestTime << ", "
+           << "\"gflops\": " << gflops << ", "
+           << "\"efficiency\": " << efficiency << ", "
+           << "\"residentDeltaMB\": " << residentDeltaMB << "}";
+        results_.push_back( os.str() );
+        if( ctrl_.progress && g_.Rank() == 0 )
+            cout << "  " << routine << " (" << variant << ", " << type
+                 << ", n=" << n << ", " << g_.Height() << " x " << g_.Width()
+                 << "): " << bestTime << " seconds, " << gflops
+                 << " GFlops, " << 100*efficiency << "% of local Gemm"
+                 << endl;
+    }
+
+    const vector<string>& Results() const { return results_; }
+
+private:
+    const Grid& g_;
+    double baselineGFlops_;
+    const BenchmarkCtrl& ctrl_;
+    vector<string> results_;
+};
+
+// The average (over the processes) rate of a sequential Gemm
+template<typename F>
+double BaselineGFlops( Int n, Int numReps, mpi::Comm comm )
+{
+    Matrix<F> A, B, C;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+    double bestTime = numeric_limits<double>::max();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        const double startTime = mpi::Time();
+        Gemm( NORMAL, NORMAL, F(1), A, B, F(0), C );
+        bestTime = Min( bestTime, mpi::Time()-startTime );
+    }
+    const double flopScale = ( IsComplex<F>::val ? 4 : 1 );
+    const double gflops = flopScale*2.*n*n*n/(1e9*bestTime);
+    return mpi::AllReduce( gflops, comm ) / mpi::Size( comm );
+}
+
+template<typename F>
+void Benchmark
+( Int n, const Grid& g, const BenchmarkCtrl& ctrl, Recorder& recorder )
+{
+    typedef Base<F> Real;
+    const string type = TypeChar<F>();
+    const double scale = ( IsComplex<F>::val ? 4 : 1 );
+    const double n3 = double(n)*n*n;
+    auto active = [&]( const string& routine )
+                  { return ctrl.routines.count( routine ) > 0; };
+
+    DistMatrix<F> A(g), B(g), C(g), AOrig(g), HPD(g);
+    Uniform( AOrig, n, n );
+    HermitianUniformSpectrum( HPD, n, 1, 10 );
+    auto noSetup = [](){};
+
+    if( active("Gemm") )
+    {
+        const vector<pair<GemmAlgorithm,string>> algs =
+          { {GEMM_DEFAULT,"DEFAULT"}, {GEMM_SUMMA_A,"SUMMA_A"},
+            {GEMM_SUMMA_B,"SUMMA_B"}, {GEMM_SUMMA_C,"SUMMA_C"},
+            {GEMM_SUMMA_DOT,"SUMMA_DOT"}, {GEMM_CANNON,"CANNON"},
+            {GEMM_3D,"3D"} };
+        Uniform( B, n, n );
+        Zeros( C, n, n );
+        for( const auto& alg : algs )
+            recorder.Time
+            ( "Gemm", alg.second, type, n, scale*2*n3, noSetup,
+              [&](){ Gemm( NORMAL, NORMAL, F(1), AOrig, B, F(0), C,
+                           alg.first ); } );
+    }
+    if( active("Trsm") )
+    {
+        recorder.Time
+        ( "Trsm", "LLN", type, n, scale*n3, [&](){ B = AOrig; },
+          [&](){ Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), HPD, B ); } );
+        recorder.Time
+        ( "Trsm", "RUN", type, n, scale*n3, [&](){ B = AOrig; },
+          [&](){ Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), HPD, B ); } );
+    }
+    if( active("Herk") )
+    {
+        Zeros( C, n, n );
+        recorder.Time
+        ( "Herk", "LN", type, n, scale*n3, noSetup,
+          [&](){ Herk( LOWER, NORMAL, F(1), AOrig, F(0), C ); } );
+        recorder.Time
+        ( "Herk", "UN", type, n, scale*n3, noSetup,
+          [&](){ Herk( UPPER, NORMAL, F(1), AOrig, F(0), C ); } );
+    }
+    if( active("LU") )
+    {
+        DistMatrix<Int,VC,STAR> p(g);
+        recorder.Time
+        ( "LU", "partial", type, n, scale*2*n3/3, [&](){ A = AOrig; },
+          [&](){ LU( A, p ); } );
+        recorder.Time
+        ( "LU", "none", type, n, scale*2*n3/3, [&](){ A = HPD; },
+          [&](){ LU( A ); } );
+    }
+    if( active("Cholesky") )
+    {
+        recorder.Time
+        ( "Cholesky", "L", type, n, scale*n3/3, [&](){ A = HPD; },
+          [&](){ Cholesky( LOWER, A ); } );
+        recorder.Time
+        ( "Cholesky", "U", type, n, scale*n3/3, [&](){ A = HPD; },
+          [&](){ Cholesky( UPPER, A ); } );
+    }
+    if( active("QR") )
+    {
+        recorder.Time
+        ( "QR", "Householder", type, n, scale*4*n3/3, [&](){ A = AOrig; },
+          [&](){ QR( A ); } );
+    }
+    if( active("HermitianTridiag") )
+    {
+        HermitianTridiagCtrl tridiagCtrl;
+        tridiagCtrl.approach = HERMITIAN_TRIDIAG_NORMAL;
+        recorder.Time
+        ( "HermitianTridiag", "NORMAL", type, n, scale*4*n3/3,
+          [&](){ A = HPD; },
+          [&](){ HermitianTridiag( LOWER, A, tridiagCtrl ); } );
+        tridiagCtrl.approach = HERMITIAN_TRIDIAG_SQUARE;
+        recorder.Time
+        ( "HermitianTridiag", "SQUARE", type, n, scale*4*n3/3,
+          [&](){ A = HPD; },
+          [&](){ HermitianTridiag( LOWER, A, tridiagCtrl ); } );
+        DistMatrix<F,STAR,STAR> t(g);
+        BulgeReflectors<F> bulge;
+        recorder.Time
+        ( "HermitianTridiag", "TWO_STAGE", type, n, scale*4*n3/3,
+          [&](){ A = HPD; },
+          [&](){ herm_tridiag::TwoStage( LOWER, A, t, bulge ); } );
+    }
+    if( active("HermitianEig") )
+    {
+        DistMatrix<Real,VR,STAR> w(g);
+        DistMatrix<F> Z(g);
+        recorder.Time
+        ( "HermitianEig", "values", type, n, scale*4*n3/3,
+          [&](){ A = HPD; }, [&](){ HermitianEig( LOWER, A, w ); } );
+        recorder.Time
+        ( "HermitianEig", "vectors", type, n, scale*10*n3/3,
+          [&](){ A = HPD; }, [&](){ HermitianEig( LOWER, A, w, Z ); } );
+        HermitianEigCtrl<Real> eigCtrl;
+        eigCtrl.useTwoStage = true;
+        recorder.Time
+        ( "HermitianEig", "vectors (two-stage)", type, n, scale*10*n3/3,
+          [&](){ A = HPD; },
+          [&](){ HermitianEig
+                 ( LOWER, A, w, Z, ASCENDING, HermitianEigSubset<Real>(),
+                   eigCtrl ); } );
+    }
+    if( active("SVD") )
+    {
+        DistMatrix<Real,VR,STAR> s(g);
+        DistMatrix<F> V(g);
+        recorder.Time
+        ( "SVD", "values", type, n, scale*8*n3/3,
+          [&](){ A = AOrig; }, [&](){ SVD( A, s ); } );
+        recorder.Time
+        ( "SVD", "vectors", type, n, scale*20*n3/3,
+          [&](){ A = AOrig; }, [&](){ SVD( A, s, V ); } );
+        SVDCtrl svdCtrl;
+        svdCtrl.useTwoStage = true;
+        recorder.Time
+        ( "SVD", "vectors (two-stage)", type, n, scale*20*n3/3,
+          [&](){ A = AOrig; }, [&](){ SVD( A, s, V, svdCtrl ); } );
+    }
+}
+
+template<typename F>
+void BenchmarkType
+( const vector<Int>& sizes, const Grid& g, const BenchmarkCtrl& ctrl,
+  vector<string>& results, ostringstream& baselines )
+{
+    const double baselineGFlops =
+        BaselineGFlops<F>( ctrl.baselineSize, ctrl.numReps, g.Comm() );
+    if( !baselines.str().empty() )
+        baselines << ", ";
+    baselines << "{\"type\": \"" << TypeChar<F>() << "\", "
+              << "\"gridHeight\": " << g.Height() << ", "
+              << "\"gridWidth\": " << g.Width() << ", "
+              << "\"gflops\": " << baselineGFlops << "}";
+    Recorder recorder( g, baselineGFlops, ctrl );
+    for( const Int n : sizes )
+        Benchmark<F>( n, g, ctrl, recorder );
+    results.insert
+    ( results.end(), recorder.Results().begin(), recorder.Results().end() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const string routineList =
+            Input
+            ("--routines","comma-separated list of routines",
+             string("Gemm,Trsm,Herk,LU,Cholesky,QR,HermitianTridiag,"
+                    "HermitianEig,SVD"));
+        const string sizeList =
+            Input("--sizes","comma-separated list of sizes",string("1000"));
+        const string typeList =
+            Input("--types","comma-separated subset of s,d,c,z",string("d,z"));
+        const string gridHeightList =
+            Input
+            ("--gridHeights","comma-separated grid heights (0 for default)",
+             string("0"));
+        const Int numReps = Input("--numReps","repetitions per benchmark",3);
+        const Int baselineSize =
+            Input("--baselineSize","size of the local Gemm baseline",1000);
+        const Int nb = Input("--nb","algorithmic blocksize (0 for default)",0);
+        const string filename =
+            Input("--output","JSON output file",string("El_benchmark.json"));
+        const bool progress = Input("--progress","print progress?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( nb != 0 )
+            SetBlocksize( nb );
+
+        BenchmarkCtrl ctrl;
+        for( const string& routine : SplitList(routineList) )
+            ctrl.routines.insert( routine );
+        ctrl.numReps = numReps;
+        ctrl.baselineSize = baselineSize;
+        ctrl.progress = progress;
+
+        vector<Int> sizes;
+        for( const string& size : SplitList(sizeList) )
+            sizes.push_back( atoi(size.c_str()) );
+        const vector<string> types = SplitList( typeList );
+        auto haveType = [&]( const string& type )
+            { return find(types.begin(),types.end(),type) != types.end(); };
+
+        vector<string> results;
+        ostringstream baselines;
+        for( const string& heightString : SplitList(gridHeightList) )
+        {
+            Int gridHeight = atoi( heightString.c_str() );
+            if( gridHeight == 0 )
+                gridHeight = Grid::FindFactor( commSize );
+            if( gridHeight <= 0 || commSize % gridHeight != 0 )
+            {
+                if( commRank == 0 )
+                    cout << "Skipping grid height " << gridHeight
+                         << " since it does not divide " << commSize << endl;
+                continue;
+            }
+            const Grid g( comm, gridHeight );
+            if( haveType("s") )
+                BenchmarkType<float>( sizes, g, ctrl, results, baselines );
+            if( haveType("d") )
+                BenchmarkType<double>( sizes, g, ctrl, results, baselines );
+            if( haveType("c") )
+                BenchmarkType<Complex<float>>
+                ( sizes, g, ctrl, results, baselines );
+            if( haveType("z") )
+                BenchmarkType<Complex<double>>
+                ( sizes, g, ctrl, results, baselines );
+        }
+
+        const double maxResidentMB =
+            mpi::AllReduce( MaxResidentMB(), mpi::MAX, comm );
+        if( commRank == 0 )
+        {
+            ofstream file( filename.c_str() );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+            file << "{\n"
+                 << "  \"version\": \"" << EL_VERSION_MAJOR << "."
+                 << EL_VERSION_MINOR << "\",\n"
+                 << "  \"commit\": \"" << EL_GIT_SHA1 << "\",\n"
+                 << "  \"processes\": " << commSize << ",\n"
+                 << "  \"numReps\": " << numReps << ",\n"
+                 << "  \"maxResidentMB\": " << maxResidentMB << ",\n"
+                 << "  \"baselines\": [" << baselines.str() << "],\n"
+                 << "  \"results\": [\n";
+            for( std::size_t j=0; j<results.size(); ++j )
+                file << results[j] << ( j+1<results.size() ? ",\n" : "\n" );
+            file << "  ]\n}" << endl;
+            cout << "Wrote " << results.size() << " results to " << filename
+                 << endl;
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -54,6 +54,8 @@
 #cmakedefine EL_HAVE_CXX11RANDOM
 #cmakedefine EL_HAVE_STEADYCLOCK
 #cmakedefine EL_HAVE_NOEXCEPT
+#cmakedefine EL_HAVE_PERF_EVENT
+#cmakedefine EL_HAVE_MMAP
 #cmakedefine EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
 #cmakedefine EL_HAVE_MPI_IN_PLACE
 #cmakedefine EL_HAVE_MPI_LONG_LONG
@@ -35,6 +35,32 @@ set(NOEXCEPT_CODE
 check_cxx_source_compiles("${STEADYCLOCK_CODE}" EL_HAVE_STEADYCLOCK)
 check_cxx_source_compiles("${NOEXCEPT_CODE}" EL_HAVE_NOEXCEPT)
 
+# Linux hardware performance counters
+# ===================================
+set(PERF_EVENT_CODE
+    "#include <linux/perf_event.h>
+     #include <sys/syscall.h>
+     #include <unistd.h>
+     int main()
+     {
+         perf_event_attr attr;
+         attr.type = PERF_TYPE_HARDWARE;
+         attr.config = PERF_COUNT_HW_CPU_CYCLES;
+         return syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+     }")
+check_cxx_source_compiles("${PERF_EVENT_CODE}" EL_HAVE_PERF_EVENT)
+
+# Memory-mapped files
+# ===================
+set(MMAP_CODE
+    "#include <sys/mman.h>
+     int main()
+     {
+         void* p = mmap( 0, 1, PROT_READ, MAP_SHARED, 0, 0 );
+         return munmap( p, 1 );
+     }")
+check_cxx_source_compiles("${MMAP_CODE}" EL_HAVE_MMAP)
+
 # C++11 random number generation
 # ==============================
 # Note: It was noticed that, for certain relatively recent Intel compiler
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--size","size of benchmark matrices",2000);
+        const Int numReps = Input("--numReps","repetitions per candidate",1);
+        const bool sequential =
+            Input("--sequential","tune sequential routines?",true);
+        const bool tuneComplex = Input("--complex","tune complex types?",true);
+        const string filename =
+            Input("--filename","tuning file",string("El_tuning.txt"));
+        const bool progress = Input("--progress","print progress?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        // Start from any previously tuned values so that several grid shapes
+        // can be accumulated into a single tuning file
+        Int haveExisting = 0;
+        if( mpi::Rank(comm) == 0 )
+        {
+            ifstream existingFile( filename.c_str() );
+            haveExisting = existingFile.is_open();
+        }
+        mpi::Broadcast( haveExisting, 0, comm );
+        if( haveExisting )
+            LoadTuning( filename, comm );
+
+        AutotuneCtrl ctrl;
+        ctrl.size = n;
+        ctrl.numReps = numReps;
+        ctrl.sequential = sequential;
+        ctrl.progress = progress;
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Tuning float" << endl;
+        Autotune<float>( g, ctrl );
+        if( mpi::WorldRank() == 0 )
+            cout << "Tuning double" << endl;
+        Autotune<double>( g, ctrl );
+        if( tuneComplex )
+        {
+            if( mpi::WorldRank() == 0 )
+                cout << "Tuning Complex<float>" << endl;
+            Autotune<Complex<float>>( g, ctrl );
+            if( mpi::WorldRank() == 0 )
+                cout << "Tuning Complex<double>" << endl;
+            Autotune<Complex<double>>( g, ctrl );
+        }
+
+        SaveTuning( filename, comm );
+        if( mpi::WorldRank() == 0 )
+            cout << "Wrote tuning file " << filename << "; set EL_TUNING_FILE="
+                 << filename << " to load it within Initialize" << endl;
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
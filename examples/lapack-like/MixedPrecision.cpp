@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename F>
+void Report
+( const MixedPrecisionInfo<Base<F>>& info, double solveTime,
+  const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& X,
+  bool hermitian )
+{
+    DistMatrix<F> R( B );
+    if( hermitian )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    const Base<F> backwardError =
+        FrobeniusNorm(R) / (FrobeniusNorm(A)*FrobeniusNorm(X)+FrobeniusNorm(B));
+    if( mpi::WorldRank() == 0 )
+        std::cout << "  time:                " << solveTime << " seconds\n"
+                  << "  converged:           " << info.converged << "\n"
+                  << "  refinement steps:    " << info.numRefineIts << "\n"
+                  << "  used GMRES-IR:       " << info.usedGMRES << "\n"
+                  << "  GMRES iterations:    " << info.numGMRESIts << "\n"
+                  << "  fell back:           " << info.fellBack << "\n"
+                  << "  backward error:      " << backwardError << "\n"
+                  << std::endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--size","size of matrix",1000);
+        const Int numRhs = Input("--numRhs","# of right-hand sides",1);
+        const double cond =
+            Input("--cond","condition number of HPD matrix",1e4);
+        Int gridHeight = Input("--gridHeight","grid height",0);
+        const bool gmres = Input("--gmres","allow GMRES-IR?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( commSize );
+        Grid grid( comm, gridHeight );
+
+        MixedPrecisionCtrl<double> ctrl;
+        ctrl.gmres = gmres;
+        ctrl.progress = progress;
+
+        // General matrix
+        DistMatrix<double> A(grid), B(grid), X(grid);
+        Uniform( A, n, n );
+        Uniform( B, n, numRhs );
+        if( commRank == 0 )
+            std::cout << "Full-precision GaussianElimination" << std::endl;
+        {
+            DistMatrix<double> ACopy( A );
+            X = B;
+            mpi::Barrier( comm );
+            const double startTime = mpi::Time();
+            GaussianElimination( ACopy, X );
+            mpi::Barrier( comm );
+            const double solveTime = mpi::Time() - startTime;
+            MixedPrecisionInfo<double> info;
+            info.converged = true;
+            Report( info, solveTime, A, B, X, false );
+        }
+        if( commRank == 0 )
+            std::cout << "MixedPrecisionGaussianElimination" << std::endl;
+        {
+            X = B;
+            mpi::Barrier( comm );
+            const double startTime = mpi::Time();
+            auto info = MixedPrecisionGaussianElimination( A, X, ctrl );
+            mpi::Barrier( comm );
+            const double solveTime = mpi::Time() - startTime;
+            Report( info, solveTime, A, B, X, false );
+        }
+
+        // HPD matrix with the requested condition number
+        HermitianUniformSpectrum( A, n, 1., cond );
+        if( commRank == 0 )
+            std::cout << "Full-precision HPDSolve" << std::endl;
+        {
+            DistMatrix<double> ACopy( A );
+            X = B;
+            mpi::Barrier( comm );
+            const double startTime = mpi::Time();
+            HPDSolve( LOWER, NORMAL, ACopy, X );
+            mpi::Barrier( comm );
+            const double solveTime = mpi::Time() - startTime;
+            MixedPrecisionInfo<double> info;
+            info.converged = true;
+            Report( info, solveTime, A, B, X, true );
+        }
+        if( commRank == 0 )
+            std::cout << "MixedPrecisionHPDSolve" << std::endl;
+        {
+            X = B;
+            mpi::Barrier( comm );
+            const double startTime = mpi::Time();
+            auto info = MixedPrecisionHPDSolve( LOWER, A, X, ctrl );
+            mpi::Barrier( comm );
+            const double solveTime = mpi::Time() - startTime;
+            Report( info, solveTime, A, B, X, true );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -622,6 +622,7 @@ inline ElHermitianEigCtrl_s CReflect( const HermitianEigCtrl<float>& ctrl )
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
     ctrlC.useSdc = ctrl.useSdc;
+    ctrlC.useTwoStage = ctrl.useTwoStage;
     return ctrlC;
 }
 inline ElHermitianEigCtrl_d CReflect( const HermitianEigCtrl<double>& ctrl )
@@ -630,6 +631,7 @@ inline ElHermitianEigCtrl_d CReflect( const HermitianEigCtrl<double>& ctrl )
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
     ctrlC.useSdc = ctrl.useSdc;
+    ctrlC.useTwoStage = ctrl.useTwoStage;
     return ctrlC;
 }
 
@@ -639,6 +641,7 @@ inline HermitianEigCtrl<float> CReflect( const ElHermitianEigCtrl_s& ctrlC )
     ctrl.tridiagCtrl = CReflect( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
     ctrl.useSdc = ctrlC.useSdc;
+    ctrl.useTwoStage = ctrlC.useTwoStage;
     return ctrl;
 }
 inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
@@ -647,6 +650,7 @@ inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
     ctrl.tridiagCtrl = CReflect( ctrlC.tridiagCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
     ctrl.useSdc = ctrlC.useSdc;
+    ctrl.useTwoStage = ctrlC.useTwoStage;
     return ctrl;
 }
 
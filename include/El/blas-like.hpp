@@ -57,6 +57,21 @@ template<> Int LocalTrr2kBlocksize<double>();
 template<> Int LocalTrr2kBlocksize<Complex<float>>();
 template<> Int LocalTrr2kBlocksize<Complex<double>>();
 
+// The replication factor for GEMM_3D (zero signifies Grid3D::FindDepth)
+void SetGemm3DDepth( Int depth );
+Int Gemm3DDepth();
+
+// Sequential (and hence local) Gemm calls recursively apply Strassen-Winograd
+// while all of the dimensions are at least the cutoff (which must be zero, the
+// default, which disables the recursion, or at least two)
+void SetStrassenCutoff( Int cutoff );
+Int StrassenCutoff();
+
+// Sequential (and hence local) complex Gemm calls use the 3M algorithm, which
+// requires three real matrix-matrix multiplications rather than four, if set
+void SetGemm3M( bool use3M );
+bool Gemm3M();
+
 } // namespace El
 
 #endif // ifndef EL_BLAS_HPP
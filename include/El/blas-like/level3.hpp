@@ -20,9 +20,30 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_3D
 };
 
+// NOTE: If a nonzero StrassenCutoff() has been set, sequential products whose
+//       dimensions are all at least the cutoff are formed with the
+//       Strassen-Winograd algorithm, which recurses until a dimension drops
+//       below the cutoff, n0. Each level saves one eighth of the flops, but
+//       only a normwise bound of the form
+//
+//         || C - fl(C) ||_max <= 
+//           [(n/n0)^{log2(18)} (n0^2+6 n0) - 6 n] u ||A||_max ||B||_max
+//
+//       (plus higher-order terms) holds for n x n products (see Higham's
+//       "Accuracy and Stability of Numerical Algorithms", Ch. 23), rather than
+//       the componentwise bound |C - fl(C)| <= n u |A| |B| of the conventional
+//       algorithm. In particular, small entries of C may be computed with
+//       large relative errors when A and B are badly scaled.
+//
+//       Similarly, if Gemm3M() is set, complex products are formed from three
+//       real products rather than four. While the real part of the result 
+//       satisfies the usual bound, the error in the imaginary part is only 
+//       bounded by (a small multiple of) n u (|Ar|+|Ai|)(|Br|+|Bi|), which 
+//       can be large relative to |Im(C)|.
 template<typename T>
 void Gemm
 ( Orientation orientationOfA, Orientation orientationOfB,
@@ -45,6 +66,14 @@ void Gemm
   T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
                  DistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// NOTE: GEMM_3D builds a Grid3D of depth Gemm3DDepth() on every call, whereas
+//       the following routine allows for the 3D grid to be reused
+template<typename T>
+void Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C, const Grid3D& grid3D );
+
 // Hemm
 // ====
 template<typename T>
@@ -466,6 +495,7 @@ inline void LocalGemm
                  "  C ~ ",C.Height()," x ",C.Width());
         }
     )
+    ProfileRegion region("LocalGemm",true);
     Gemm
     ( orientationOfA , orientationOfB,
       alpha, A.LockedMatrix(), B.LockedMatrix(), beta, C.Matrix() );
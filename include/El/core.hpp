@@ -22,6 +22,7 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <stack>
@@ -108,6 +109,7 @@
 #include "El/core/imports/choice.hpp"
 #include "El/core/imports/mpi_choice.hpp"
 #include "El/core/environment/decl.hpp"
+#include "El/core/Profile.hpp"
 #include "El/core/indexing/decl.hpp"
 #include "El/core/imports/blas.hpp"
 #include "El/core/imports/lapack.hpp"
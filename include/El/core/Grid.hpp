@@ -106,6 +106,37 @@ bool operator!= ( const Grid& A, const Grid& B );
 // Return a grid constructed using mpi::COMM_WORLD.
 const Grid& DefaultGrid();
 
+// A stack of 'depth' congruent two-dimensional layer grids which partition the
+// owning processes of a base grid. Since process (i,j) of each layer is 
+// connected through the depth communicator, data which is identically 
+// distributed over each layer can be directly combined across the depth.
+class Grid3D
+{
+public:
+    explicit Grid3D( const Grid& grid, int depth );
+    ~Grid3D();
+
+    const Grid& BaseGrid() const;
+    int Depth() const;
+    int Layer() const;       // mpi::UNDEFINED if not in the base grid
+    const Grid& LayerGrid( int layer ) const;
+    const Grid& LayerGrid() const;
+    mpi::Comm DepthComm() const;
+
+    // Choose the largest depth which is at most the cube-root of p and 
+    // divides p
+    static int FindDepth( int p );
+
+private:
+    const Grid& baseGrid_;
+    int depth_, layer_;
+    std::vector<Grid*> layerGrids_;
+    mpi::Comm depthComm_;
+
+    const Grid3D& operator=( Grid3D& );
+    Grid3D( const Grid3D& );
+};
+
 } // namespace El
 
 #endif // ifndef EL_GRID_HPP
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+// Hierarchical region profiling
+// =============================
+// Unlike CallStackEntry, profiling regions are compiled into release builds
+// and are switched on at runtime, either through EnableProfiling or by
+// setting the environment variables
+//
+//   EL_PROFILE=stdout|<filename>  (per-region summary written at Finalize)
+//   EL_PROFILE_TRACE=<filename>   (Chrome/Perfetto trace written at Finalize)
+//
+// Each process accumulates the number of calls and the inclusive and
+// exclusive times of every path of nested regions, and, up to a limit, a
+// timeline of region instances which is written as a Chrome trace with one
+// 'process' per rank. While communication tracing is enabled, regions also
+// label the traced communication (see mpi::TraceScope).
+
+// Collective over mpi::COMM_WORLD so that the timelines of the processes
+// share a common origin
+void EnableProfiling( bool enable=true );
+bool Profiling();
+void ClearProfile();
+void SetMaxProfileEvents( Int maxEvents );
+void SetProfileFile( const std::string& filename );
+void SetProfileTraceFile( const std::string& filename );
+
+// Collective over mpi::COMM_WORLD: print the minimum, average, and maximum
+// (over the processes) inclusive and exclusive times of each region path
+// from the root process, followed by the times of each process if requested
+void PrintProfile( std::ostream& os=std::cout, bool perRank=false );
+// Collective over mpi::COMM_WORLD: write the timelines in the Chrome trace
+// event format (viewable with chrome://tracing or ui.perfetto.dev)
+void WriteProfileTrace( const std::string& filename );
+// Called from Finalize: write the requested reports if profiling was enabled
+void FinalizeProfile();
+
+// Hardware performance counters
+// -----------------------------
+// On Linux systems which provide perf_event_open, regions which are
+// constructed with countEvents=true (e.g., those around LocalGemm, LocalTrrk,
+// and lu::Panel) also accumulate the number of cycles, instructions, and
+// last-level cache misses of this process (and of any threads it spawns
+// after the counters are enabled). Floating-point operations are counted if
+// raw event codes and their flop weights are provided as a comma-separated
+// list of 'code:weight' pairs, e.g., for recent Intel processors,
+//
+//   EL_PROFILE_FP_EVENTS=0x1c7:1,0x2c7:1,0x4c7:2,0x8c7:4,0x10c7:4,0x20c7:8
+//
+// The counters are enabled by EnableProfileCounters or by setting
+// EL_PROFILE_COUNTERS. The unavailable counters are skipped, and the return
+// value reports whether any counter could be opened.
+bool EnableProfileCounters( bool enable=true );
+bool ProfileCounters();
+void SetProfileFPEvents( const std::string& events );
+
+void PushProfileRegion( const char* name, bool countEvents=false );
+void PopProfileRegion();
+
+class ProfileRegion
+{
+public:
+    ProfileRegion( const char* name, bool countEvents=false )
+    : profiled_(Profiling()), traced_(mpi::Tracing())
+    {
+        if( profiled_ )
+            PushProfileRegion( name, countEvents );
+        if( traced_ )
+            mpi::PushTraceRoutine( name );
+    }
+
+    ~ProfileRegion()
+    {
+        if( traced_ )
+            mpi::PopTraceRoutine();
+        if( profiled_ )
+            PopProfileRegion();
+    }
+
+private:
+    bool profiled_, traced_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
@@ -54,6 +54,37 @@ void SetBlocksize( Int blocksize );
 void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 
+// For querying and registering per-routine tuned blocksizes, which are keyed
+// on the routine name, the scalar type, and the process grid dimensions.
+// Sequential routines (and the grid-independent local kernels) use grid
+// dimensions of 0 x 0 so that they are distinct from a 1 x 1 process grid.
+// NOTE: A blocksize which was explicitly set or pushed onto the blocksize
+//       stack always takes precedence over a tuned value.
+class Grid;
+template<typename T> std::string TypeName();
+template<> std::string TypeName<Int>();
+template<> std::string TypeName<float>();
+template<> std::string TypeName<double>();
+template<> std::string TypeName<Complex<float>>();
+template<> std::string TypeName<Complex<double>>();
+template<typename T>
+Int Blocksize( std::string routine, Int gridHeight=0, Int gridWidth=0 );
+template<typename T>
+Int Blocksize( std::string routine, const Grid& grid );
+void SetTunedBlocksize
+( std::string routine, std::string typeName,
+  Int gridHeight, Int gridWidth, Int blocksize );
+bool HaveTunedBlocksize
+( std::string routine, std::string typeName, Int gridHeight, Int gridWidth );
+void ClearTunedBlocksizes();
+
+// Tuning files contain one "routine type gridHeight gridWidth blocksize"
+// entry per line (with '#' starting a comment and grid dimensions of "0 0"
+// denoting a sequential entry). If the environment variable
+// EL_TUNING_FILE is set, it is automatically loaded within Initialize.
+void LoadTuning( std::string filename, mpi::Comm comm=mpi::COMM_WORLD );
+void SaveTuning( std::string filename, mpi::Comm comm=mpi::COMM_WORLD );
+
 Int DefaultBlockHeight();
 Int DefaultBlockWidth();
 void SetDefaultBlockHeight( Int blockHeight );
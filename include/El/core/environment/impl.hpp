@@ -61,6 +61,11 @@ inline void
 PrintInputReport()
 { GetArgs().PrintReport(); }
 
+template<typename T>
+inline Int
+Blocksize( std::string routine, const Grid& grid )
+{ return Blocksize<T>( routine, grid.Height(), grid.Width() ); }
+
 inline void ReportException( const std::exception& e, std::ostream& os )
 {
     try {
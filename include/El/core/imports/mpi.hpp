@@ -130,6 +130,40 @@ void Split( Comm comm, int color, int key, Comm& newComm );
 void Free( Comm& comm );
 bool Congruent( Comm comm1, Comm comm2 );
 void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler );
+void SetName( Comm comm, const char* name );
+std::string Name( Comm comm );
+
+// Communication tracing
+// =====================
+// When enabled, each of the communication wrappers below accumulates its
+// call count, the number of bytes sent and received by this process, and its
+// wall time into an entry keyed by the innermost enclosing TraceScope, the
+// name of the wrapper, and the name of the communicator (e.g., MC or VR for
+// the communicators of a Grid). Tracing may also be enabled by setting the
+// environment variable EL_COMM_TRACE to either 'stdout' or a filename.
+//
+// The check performed by each wrapper when tracing is disabled is a single
+// load and branch.
+void EnableTracing( bool enable=true );
+bool Tracing();
+void ClearTrace();
+// If set, Finalize writes the trace report to the given file rather than
+// to std::cout
+void SetTraceFile( const std::string& filename );
+// Collective over COMM_WORLD: reduce the per-process traces and print a
+// per-routine report from the root process
+void PrintTrace( std::ostream& os=std::cout );
+// Called from Finalize: report the trace if tracing was ever enabled
+void FinalizeTrace();
+
+void PushTraceRoutine( const char* routine );
+void PopTraceRoutine();
+
+struct TraceScope
+{
+    TraceScope( const char* routine ) { PushTraceRoutine( routine ); }
+    ~TraceScope() { PopTraceRoutine(); }
+};
 
 // Cartesian communicator routines
 void CartCreate
@@ -177,6 +211,48 @@ bool IProbe( int source, int tag, Comm comm, Status& status );
 template<typename T>
 int GetCount( Status& status );
 
+// Parallel file I/O
+// =================
+struct File
+{
+    MPI_File file;
+    File( MPI_File mpiFile=MPI_FILE_NULL ) : file(mpiFile) { }
+};
+typedef MPI_Offset Offset;
+
+// Collective over comm. Failures to open the file are reported with a
+// RuntimeError on every process, even in release builds.
+void FileOpen
+( Comm comm, const std::string& filename, bool write, File& file );
+void FileClose( File& file );
+Offset FileSize( File file );
+// Collective: truncate or extend the file to the given number of bytes
+void FileSetSize( File file, Offset numBytes );
+
+// Independent access to bytes [offset,offset+count*sizeof(T)) of the file
+template<typename T>
+void FileReadAt( File file, Offset offset, T* buf, int count );
+template<typename T>
+void FileWriteAt( File file, Offset offset, const T* buf, int count );
+
+// Collective access to a column-major matrix with the given height whose
+// entries have type T and begin at byte 'offset' of the file: each process
+// transfers the localHeight x localWidth entries in rows
+// colShift:colStride:height-1 and columns rowShift:rowStride:end to or from
+// its local matrix, which has leading dimension ldim. The file and memory
+// layouts are described by derived datatypes so that the MPI-IO
+// implementation can aggregate the strided requests of the processes.
+template<typename T>
+void FileReadAll
+( File file, Offset offset, Int height,
+  Int localHeight, Int colShift, Int colStride,
+  Int localWidth,  Int rowShift, Int rowStride, T* buf, Int ldim );
+template<typename T>
+void FileWriteAll
+( File file, Offset offset, Int height,
+  Int localHeight, Int colShift, Int colStride,
+  Int localWidth,  Int rowShift, Int rowStride, const T* buf, Int ldim );
+
 // Point-to-point communication
 // ============================
 
@@ -20,6 +20,7 @@ typedef enum {
   EL_ASCII_MATLAB,
   EL_BINARY,
   EL_BINARY_FLAT,
+  EL_BINARY_SHARDED,
   EL_BMP,
   EL_JPG,
   EL_JPEG,
@@ -12,7 +12,6 @@
 
 namespace El {
 
-// TODO: Distributed file formats?
 namespace FileFormatNS {
 enum FileFormat
 {
@@ -21,6 +20,7 @@ enum FileFormat
     ASCII_MATLAB,
     BINARY,
     BINARY_FLAT,
+    BINARY_SHARDED, // One file per process, plus an index (DistMatrix only)
     BMP,
     JPG,
     JPEG,
@@ -165,6 +165,32 @@ void Read
 ( AbstractBlockDistMatrix<T>& A, 
   const std::string filename, FileFormat format=AUTO, bool sequential=false );
 
+// A read-only view of a matrix stored in the BINARY format. Where mmap is
+// available, the file is mapped into memory rather than copied, so that its
+// pages are loaded on demand and shared by the processes on a node which map
+// the same file; otherwise, the matrix is read into memory owned by this
+// object. The view is valid for the lifetime of the MappedMatrix.
+template<typename T>
+class MappedMatrix
+{
+public:
+    explicit MappedMatrix( const std::string filename );
+    ~MappedMatrix();
+
+    const Matrix<T>& LockedMatrix() const { return A_; }
+    Int Height() const { return A_.Height(); }
+    Int Width() const { return A_.Width(); }
+    bool Mapped() const { return mapping_ != nullptr; }
+
+private:
+    Matrix<T> A_;
+    void* mapping_;
+    std::size_t mappingSize_;
+
+    MappedMatrix( const MappedMatrix& );
+    const MappedMatrix& operator=( const MappedMatrix& );
+};
+
 // Spy
 // ===
 template<typename T>
@@ -45,4 +45,6 @@ void Zeros( AbstractBlockDistMatrix<T>& A, Int m, Int n );
 
 #include "./lapack-like/props.hpp"
 
+#include "./lapack-like/tune.hpp"
+
 #endif // ifndef EL_LAPACK_HPP
@@ -12,6 +12,25 @@
 
 namespace El {
 
+// The Householder reflectors generated while chasing bulges in the second
+// stage of a two-stage reduction. The sweeps are split into groups of
+// groupSize consecutive sweeps, and the reflectors of group g are only held
+// by process g mod numOwners (of the communicator of the process grid when
+// the reduction was distributed). The j'th locally held reflector was
+// generated by step steps[j] of sweep sweeps[j], it acts on the indices
+// [offsets[j],offsets[j]+Min(bandwidth,n-offsets[j])), and its vector
+// (with an explicit leading one) is stored in the j'th column of V. The
+// reflectors are ordered by group, then step, then sweep.
+template<typename F>
+struct BulgeReflectors
+{
+    Int bandwidth, groupSize, numOwners;
+    Matrix<F> V, t;
+    std::vector<Int> sweeps, steps, offsets;
+
+    BulgeReflectors() : bandwidth(1), groupSize(1), numOwners(1) { }
+};
+
 // Bidiag
 // ======
 
@@ -64,6 +83,43 @@ void ApplyP
 ( LeftOrRight side, Orientation orientation,
   const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, DistMatrix<F>& B );
 
+// Reduce to an upper band of width Blocksize<F>("BidiagTwoStage") using
+// blocked (Gemm-rich) QR and LQ panel updates, and then chase bulges down to
+// real bidiagonal form (upper if A is at least as tall as it is wide, lower
+// otherwise). The reflectors from the first stage are stored outside of the
+// band of A, with scalings in tP and tQ.
+template<typename F>
+void TwoStage
+( Matrix<F>& A, Matrix<F>& tP, Matrix<F>& tQ,
+  BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ );
+template<typename F>
+void TwoStage
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ,
+  BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ );
+
+// Apply the unitary matrices from a two-stage reduction
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeReflectors<F>& bulge,
+  Matrix<F>& B );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation,
+  const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t,
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B );
+
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeReflectors<F>& bulge,
+  Matrix<F>& B );
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation,
+  const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t,
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B );
+
 } // namespace bidiag
 
 // HermitianTridiag
@@ -74,7 +130,8 @@ enum HermitianTridiagApproach
 {
     HERMITIAN_TRIDIAG_NORMAL, // Keep the current grid
     HERMITIAN_TRIDIAG_SQUARE, // Drop to a square process grid
-    HERMITIAN_TRIDIAG_DEFAULT // Square grid algorithm only if already square
+    HERMITIAN_TRIDIAG_DEFAULT // Square algorithm if already square, otherwise
+                              // choose between the above with a cost model
 };
 }
 using namespace HermitianTridiagApproachNS;
@@ -84,7 +141,7 @@ struct HermitianTridiagCtrl {
     GridOrder order;
 
     HermitianTridiagCtrl()
-    : approach(HERMITIAN_TRIDIAG_SQUARE), order(ROW_MAJOR)
+    : approach(HERMITIAN_TRIDIAG_DEFAULT), order(ROW_MAJOR)
     { }
 };
 
@@ -104,6 +161,18 @@ void HermitianTridiag
 
 namespace herm_tridiag {
 
+// Reduce to a band of width Blocksize<F>("HermitianTridiagTwoStage") using 
+// blocked (Gemm-rich) two-sided updates, and then chase bulges down to real
+// symmetric tridiagonal form. The reflectors from the first stage are stored
+// below the band of A, with scalings in t.
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t, BulgeReflectors<F>& bulge );
+template<typename F>
+void TwoStage
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
+  BulgeReflectors<F>& bulge );
+
 template<typename F>
 void ApplyQ
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
@@ -117,6 +186,18 @@ void ApplyQ
 ( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
   const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, DistMatrix<F>& B );
 
+// Apply the unitary matrix from a two-stage reduction
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeReflectors<F>& bulge,
+  Matrix<F>& B );
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t,
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -240,6 +240,36 @@ void SolveAfter
 
 } // namespace ldl
 
+// LTL
+// ===
+
+// Return an implicit representation of Aasen's factorization,
+// P A P^T = L T L^[T/H], where T is tridiagonal and L is unit lower triangular
+// with its first column equal to e_0
+// ---------------------------------------------------------------------------
+template<typename F>
+void LTL( Matrix<F>& A, Matrix<Int>& p, bool conjugate=false );
+// NOTE: Only instantiated for UPerm=VC
+template<typename F,Dist UPerm>
+void LTL
+( DistMatrix<F>& A, DistMatrix<Int,UPerm,STAR>& p, bool conjugate=false );
+
+namespace ltl {
+
+// Solve linear systems using an implicit LTL factorization
+// --------------------------------------------------------
+template<typename F>
+void SolveAfter
+( const Matrix<F>& A, const Matrix<Int>& p, Matrix<F>& B,
+  bool conjugated=false );
+// NOTE: Only instantiated for UPerm=VC
+template<typename F,Dist UPerm>
+void SolveAfter
+( const DistMatrix<F>& A, const DistMatrix<Int,UPerm,STAR>& p,
+  DistMatrix<F>& B, bool conjugated=false );
+
+} // namespace ltl
+
 // LQ
 // ==
 
@@ -442,6 +472,16 @@ Int QR
   DistMatrix<Base<F>,MD,STAR>& d, DistMatrix<Int,UPerm,STAR>& p,
   const QRCtrl<Base<F>> ctrl=QRCtrl<Base<F>>() );
 
+// Return a thin QR factorization of A + U V^H given one of A = Q R
+// ----------------------------------------------------------------
+template<typename F>
+void QRMod
+( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& U, const Matrix<F>& V );
+template<typename F>
+void QRMod
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,VC,STAR>& U, const DistMatrix<F,STAR,STAR>& V );
+
 namespace qr {
 
 // Apply Q using its implicit representation
@@ -458,6 +498,54 @@ void ApplyQ
   const DistMatrix<F>& A, const DistMatrix<F,Ut,Vt>& t,
   const DistMatrix<Base<F>,Ud,Vd>& d, DistMatrix<F>& B );
 
+// Update a thin QR factorization, A = Q R, after appending rows to A
+// -----------------------------------------------------------------
+template<typename F>
+void AppendRows( Matrix<F>& R, const Matrix<F>& W );
+template<typename F>
+void AppendRows( DistMatrix<F,STAR,STAR>& R, const DistMatrix<F,STAR,STAR>& W );
+template<typename F>
+void AppendRows( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& W );
+template<typename F>
+void AppendRows
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,STAR,STAR>& W );
+
+// Downdate a thin QR factorization after deleting rows from A
+// -----------------------------------------------------------
+// NOTE: The versions without Q require the deleted rows, W, while the versions
+//       with Q delete rows [i,i+k) of A
+template<typename F>
+void DeleteRows( Matrix<F>& R, const Matrix<F>& W );
+template<typename F>
+void DeleteRows( DistMatrix<F,STAR,STAR>& R, const DistMatrix<F,STAR,STAR>& W );
+template<typename F>
+void DeleteRows( Matrix<F>& Q, Matrix<F>& R, Int i, Int k );
+template<typename F>
+void DeleteRows
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, Int i, Int k );
+
+// Update a thin QR factorization after appending the columns U to A
+// -----------------------------------------------------------------
+template<typename F>
+void AppendColumns( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& U );
+template<typename F>
+void AppendColumns
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,VC,STAR>& U );
+
+// Downdate a thin QR factorization after deleting columns [j,j+k) of A
+// --------------------------------------------------------------------
+template<typename F>
+void DeleteColumns( Matrix<F>& R, Int j, Int k );
+template<typename F>
+void DeleteColumns( DistMatrix<F,STAR,STAR>& R, Int j, Int k );
+template<typename F>
+void DeleteColumns( Matrix<F>& Q, Matrix<F>& R, Int j, Int k );
+template<typename F>
+void DeleteColumns
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, Int j, Int k );
+
 // Cholesky-based QR
 // -----------------
 template<typename F>
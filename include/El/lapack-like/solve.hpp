@@ -50,6 +50,79 @@ void HPDSolve
 ( UpperOrLower uplo, Orientation orientation,
   DistMatrix<F>& A, DistMatrix<F>& B );
 
+// B := inv(A) B using a lower-precision factorization of A
+// ========================================================
+// The factorization of A (in single-precision when F is double-precision) is
+// used to form an initial solution which is then refined, using residuals
+// computed in the working precision, until the normwise relative backward 
+// error, || B - A X ||_F / (|| A ||_F || X ||_F + || B ||_F), drops below the 
+// tolerance. If classical iterative refinement stalls, GMRES preconditioned
+// with the lower-precision factorization is used to compute the corrections
+// (GMRES-IR), and, as a last resort, A is factored in the working precision.
+
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    Real tol; // zero selects sqrt(n) eps
+    Int maxRefineIts;
+    // Refinement is considered stalled if the backward error is not reduced
+    // by at least this factor in a single step
+    Real minReduction;
+
+    bool gmres;
+    Int maxGMRESIts; // number of GMRES-IR corrections
+    Int restart;     // dimension of the Krylov subspace for each correction
+    Real gmresTol;   // relative residual tolerance for each correction
+
+    bool fallback; // factor in the working precision if refinement fails?
+    bool progress;
+
+    MixedPrecisionCtrl()
+    : tol(0), maxRefineIts(10), minReduction(Real(0.5)),
+      gmres(true), maxGMRESIts(5), restart(30), gmresTol(Real(1e-4)),
+      fallback(true), progress(false)
+    { }
+};
+
+// After a fallback, only 'fellBack' and 'backwardError' (which then measures
+// the working-precision solution) are set; nothing is reported from the
+// abandoned refinement
+template<typename Real>
+struct MixedPrecisionInfo
+{
+    bool converged; // converged without a working-precision factorization?
+    bool usedGMRES;
+    bool fellBack;
+    Int numRefineIts;
+    Int numGMRESIts; // total number of (inner) GMRES iterations
+    Real backwardError;
+
+    MixedPrecisionInfo()
+    : converged(false), usedGMRES(false), fellBack(false),
+      numRefineIts(0), numGMRESIts(0), backwardError(0)
+    { }
+};
+
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionGaussianElimination
+( const Matrix<F>& A, Matrix<F>& B, 
+  const MixedPrecisionCtrl<Base<F>>& ctrl=MixedPrecisionCtrl<Base<F>>() );
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionGaussianElimination
+( const DistMatrix<F>& A, DistMatrix<F>& B, 
+  const MixedPrecisionCtrl<Base<F>>& ctrl=MixedPrecisionCtrl<Base<F>>() );
+
+// NOTE: Only the 'uplo' triangle of the Hermitian positive-definite A is
+//       accessed, and a Cholesky factorization is used in place of LU
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionHPDSolve
+( UpperOrLower uplo, const Matrix<F>& A, Matrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl=MixedPrecisionCtrl<Base<F>>() );
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionHPDSolve
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl=MixedPrecisionCtrl<Base<F>>() );
+
 // min_X || A X - B ||_F
 // =====================
 template<typename F>
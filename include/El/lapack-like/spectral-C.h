@@ -66,6 +66,7 @@ typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSdcCtrl_s sdcCtrl;
   bool useSdc;
+  bool useTwoStage;
 } ElHermitianEigCtrl_s;
 ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl );
 
@@ -73,6 +74,7 @@ typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
   ElHermitianSdcCtrl_d sdcCtrl;
   bool useSdc;
+  bool useTwoStage;
 } ElHermitianEigCtrl_d;
 ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl );
 
@@ -58,19 +58,64 @@ struct HermitianEigCtrl
     HermitianTridiagCtrl tridiagCtrl;
     HermitianSdcCtrl<Real> sdcCtrl;
     bool useSdc;
+    // Tridiagonalize distributed matrices with herm_tridiag::TwoStage
+    // rather than with the approach chosen by tridiagCtrl
+    bool useTwoStage;
 
     HermitianEigCtrl()
-    : tridiagCtrl(), sdcCtrl(), useSdc(false)
+    : tridiagCtrl(), sdcCtrl(), useSdc(false), useTwoStage(false)
     { }
 };
 
+namespace HermitianLanczosTargetNS {
+enum HermitianLanczosTarget
+{
+    LANCZOS_SMALLEST, // algebraically smallest eigenvalues
+    LANCZOS_LARGEST,  // algebraically largest eigenvalues
+    LANCZOS_NEAREST   // eigenvalues nearest the shift (via shift-invert)
+};
+}
+using namespace HermitianLanczosTargetNS;
+
+template<typename Real>
+struct HermitianLanczosCtrl
+{
+    HermitianLanczosTarget target;
+    Real shift;
+    bool definiteShift; // if A - shift I is HPD, use Cholesky rather than LDL
+    Int basisSize;      // if zero, Max(2 numEigs,numEigs+20) is used
+    Int maxRestarts;
+    Real tol;           // if zero, eps^(3/4) is used
+    bool fullReorthog;
+    bool progress;
+
+    HermitianLanczosCtrl()
+    : target(LANCZOS_SMALLEST), shift(0), definiteShift(false),
+      basisSize(0), maxRestarts(100), tol(0),
+      fullReorthog(false), progress(false)
+    { }
+};
+
+struct SVDCtrl {
+    // Switchpoints for Chan's algorithm, which starts with a QR factorization
+    // once the matrix is this many times taller than it is wide
+    double valChanRatio;
+    double fullChanRatio;
+    // Bidiagonalize distributed matrices with bidiag::TwoStage
+    bool useTwoStage;
+
+    SVDCtrl() : valChanRatio(1.2), fullChanRatio(1.5), useTwoStage(false) { }
+};
+
 struct PolarCtrl {
     bool qdwh;
     bool colPiv;
     Int maxIts;
     mutable Int numIts;
+    SVDCtrl svdCtrl;
 
-    PolarCtrl() : qdwh(false), colPiv(false), maxIts(20), numIts(0) { }
+    PolarCtrl()
+    : qdwh(false), colPiv(false), maxIts(20), numIts(0), svdCtrl() { }
 };
 
 struct HessQrCtrl {
@@ -248,6 +293,21 @@ void Sort
 ( DistMatrix<Base<F>,U1,V1>& w, DistMatrix<F,U2,V2>& Z,
   SortType sort=ASCENDING );
 
+// Compute numEigs eigenpairs at the end of the spectrum (or nearest the shift)
+// chosen by ctrl.target with thick-restart Lanczos. Only the triangle of A
+// specified by uplo is accessed, and the eigenvalues are sorted in ascending
+// order.
+template<typename F>
+void Lanczos
+( UpperOrLower uplo, const Matrix<F>& A, Int numEigs,
+  Matrix<Base<F>>& w, Matrix<F>& Z,
+  const HermitianLanczosCtrl<Base<F>>& ctrl=HermitianLanczosCtrl<Base<F>>() );
+template<typename F>
+void Lanczos
+( UpperOrLower uplo, const DistMatrix<F>& A, Int numEigs,
+  DistMatrix<Base<F>,VR,STAR>& w, DistMatrix<F>& Z,
+  const HermitianLanczosCtrl<Base<F>>& ctrl=HermitianLanczosCtrl<Base<F>>() );
+
 } // namespace herm_eig
 
 // Polar decomposition
@@ -390,6 +450,9 @@ void SVD( Matrix<F>& A, Matrix<Base<F>>& s );
 template<typename F>
 void SVD
 ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2 );
+template<typename F>
+void SVD
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, const SVDCtrl& ctrl );
 
 template<typename F>
 void HermitianSVD( UpperOrLower uplo, Matrix<F>& A, Matrix<Base<F>>& s );
@@ -405,6 +468,10 @@ template<typename F>
 void SVD
 ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
   double heightRatio=1.5 );
+template<typename F>
+void SVD
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
+  const SVDCtrl& ctrl );
 
 template<typename F>
 void HermitianSVD
@@ -415,8 +482,41 @@ void HermitianSVD
 ( UpperOrLower uplo, DistMatrix<F>& A,
   DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& U, DistMatrix<F>& V );
 
+// Approximate the leading singular triplets with a randomized sketch
+// ------------------------------------------------------------------
+struct RandomizedSVDCtrl {
+    Int oversample;
+    Int numPowerIts;
+
+    RandomizedSVDCtrl() : oversample(10), numPowerIts(1) { }
+};
+
 namespace svd {
 
+// Return an orthonormal basis for an approximation of the range of A with
+// Min(rank+ctrl.oversample,Min(m,n)) columns
+template<typename F>
+void RangeFinder
+( const Matrix<F>& A, Int rank, Matrix<F>& Q,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename F>
+void RangeFinder
+( const DistMatrix<F>& A, Int rank, DistMatrix<F>& Q,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
+// Return U, s, and V such that U diag(s) V^H approximates the leading 'rank'
+// singular triplets of A in O(m n rank) work
+template<typename F>
+void Randomized
+( const Matrix<F>& A, Int rank,
+  Matrix<F>& U, Matrix<Base<F>>& s, Matrix<F>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+template<typename F>
+void Randomized
+( const DistMatrix<F>& A, Int rank,
+  DistMatrix<F>& U, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
+  const RandomizedSVDCtrl& ctrl=RandomizedSVDCtrl() );
+
 template<typename F>
 void Thresholded
 ( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V,
@@ -0,0 +1,44 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_TUNE_HPP
+#define EL_TUNE_HPP
+
+namespace El {
+
+// Autotune
+// ========
+// Time each candidate algorithmic blocksize for the blocked factorizations and
+// reductions (LU, Cholesky, LDL, QR, HermitianTridiag, Hessenberg, Bidiag), 
+// as well as each candidate blocksize for the local Symv, Trrk, and Trr2k 
+// kernels, over the given grid and register the fastest choice via 
+// SetTunedBlocksize. The results can then be persisted with SaveTuning and
+// reloaded at Initialize time by setting EL_TUNING_FILE.
+
+struct AutotuneCtrl
+{
+    Int size;
+    std::vector<Int> blocksizes, localBlocksizes;
+    Int numReps;
+    bool sequential, progress;
+
+    AutotuneCtrl()
+    : size(2000), 
+      blocksizes({32,48,64,96,128,160,192,256}),
+      localBlocksizes({16,32,64,96,128,256}),
+      numReps(1), sequential(true), progress(false)
+    { }
+};
+
+template<typename F>
+void Autotune( const Grid& g, const AutotuneCtrl& ctrl=AutotuneCtrl() );
+
+} // namespace El
+
+#endif // ifndef EL_TUNE_HPP
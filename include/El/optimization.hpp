@@ -303,6 +303,13 @@ template<typename F>
 Int PivotedQR
 ( DistMatrix<F>& A, Base<F> rho, Int numSteps, bool relative=false );
 
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> rho, Int rank, bool relative=false );
+template<typename F>
+Int Randomized
+( DistMatrix<F>& A, Base<F> rho, Int rank, bool relative=false );
+
 template<typename F,Dist U>
 Int TSQR( DistMatrix<F,U,STAR>& A, Base<F> rho, bool relative=false );
 
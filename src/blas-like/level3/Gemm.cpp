@@ -12,6 +12,9 @@
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/3D.hpp"
+#include "./Gemm/Strassen.hpp"
+#include "./Gemm/3M.hpp"
 
 namespace El {
 
@@ -56,7 +59,16 @@ void Gemm
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
-    if( k != 0 )
+    const Int cutoff = StrassenCutoff();
+    if( IsComplex<T>::val && Gemm3M() && k != 0 )
+    {
+        gemm::ThreeM( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    }
+    else if( cutoff > 0 && m >= cutoff && n >= cutoff && k >= cutoff )
+    {
+        gemm::Strassen( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+    }
+    else if( k != 0 )
     {
         blas::Gemm
         ( transA, transB, m, n, k,
@@ -88,7 +100,16 @@ void Gemm
   T beta,        DistMatrix<T>& C, GemmAlgorithm alg )
 {
     DEBUG_ONLY(CallStackEntry cse("Gemm"))
-    if( orientationOfA == NORMAL && orientationOfB == NORMAL )
+    if( alg == GEMM_3D )
+    {
+        const Grid& g = C.Grid();
+        const Int depth = 
+            ( Gemm3DDepth() > 0 ? Gemm3DDepth() : Grid3D::FindDepth(g.Size()) );
+        const Grid3D grid3D( g, depth );
+        gemm::Gemm3D
+        ( orientationOfA, orientationOfB, alpha, A, B, beta, C, grid3D );
+    }
+    else if( orientationOfA == NORMAL && orientationOfB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, beta, C );
@@ -97,16 +118,26 @@ void Gemm
     }
     else if( orientationOfA == NORMAL )
     {
-        gemm::SUMMA_NT( orientationOfB, alpha, A, B, beta, C, alg );
+        if( alg == GEMM_CANNON )
+            gemm::Cannon_NT( orientationOfB, alpha, A, B, beta, C );
+        else
+            gemm::SUMMA_NT( orientationOfB, alpha, A, B, beta, C, alg );
     }
     else if( orientationOfB == NORMAL )
     {
-        gemm::SUMMA_TN( orientationOfA, alpha, A, B, beta, C, alg );
+        if( alg == GEMM_CANNON )
+            gemm::Cannon_TN( orientationOfA, alpha, A, B, beta, C );
+        else
+            gemm::SUMMA_TN( orientationOfA, alpha, A, B, beta, C, alg );
     }
     else
     {
-        gemm::SUMMA_TT
-        ( orientationOfA, orientationOfB, alpha, A, B, beta, C, alg );
+        if( alg == GEMM_CANNON )
+            gemm::Cannon_TT
+            ( orientationOfA, orientationOfB, alpha, A, B, beta, C );
+        else
+            gemm::SUMMA_TT
+            ( orientationOfA, orientationOfB, alpha, A, B, beta, C, alg );
     }
 }
 
@@ -123,6 +154,17 @@ void Gemm
     Gemm( orientationOfA, orientationOfB, alpha, A, B, T(0), C, alg );
 }
 
+template<typename T>
+void Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C, const Grid3D& grid3D )
+{
+    DEBUG_ONLY(CallStackEntry cse("Gemm"))
+    gemm::Gemm3D
+    ( orientationOfA, orientationOfB, alpha, A, B, beta, C, grid3D );
+}
+
 #define PROTO(T) \
   template void Gemm \
   ( Orientation orientationA, Orientation orientationB, \
@@ -139,7 +181,11 @@ void Gemm
   template void Gemm \
   ( Orientation orientationA, Orientation orientationB, \
     T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B, \
-                   DistMatrix<T>& C, GemmAlgorithm alg );
+                   DistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( Orientation orientationA, Orientation orientationB, \
+    T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B, \
+    T beta,        DistMatrix<T>& C, const Grid3D& grid3D );
 
 #include "El/macros/Instantiate.h"
 
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// 3D (or 2.5D) Gemm: the inner dimension is split into 'depth' contiguous
+// pieces, each layer of the 3D grid forms the product of its pieces with
+// SUMMA, and the layer contributions are summed over the depth communicator.
+// Since each layer only involves p/depth processes and a 1/depth fraction of
+// the inner dimension, the per-process bandwidth of the multiplication is
+// reduced by a factor of sqrt(depth) at the cost of storing depth copies of
+// C (which is the "spare memory" traded for bandwidth).
+template<typename T>
+inline void
+Gemm3D
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C, const Grid3D& grid3D )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("gemm::Gemm3D");
+        if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+            LogicError("{A,B,C} must have the same grid");
+        if( C.Grid() != grid3D.BaseGrid() )
+            LogicError("The 3D grid must be built from the grid of C");
+    )
+    ProfileRegion region("gemm::Gemm3D");
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    DEBUG_ONLY(
+        const Int mA = ( orientationOfA == NORMAL ? A.Height() : A.Width() );
+        const Int kB = ( orientationOfB == NORMAL ? B.Height() : B.Width() );
+        const Int nB = ( orientationOfB == NORMAL ? B.Width() : B.Height() );
+        if( mA != m || kB != k || nB != n )
+            LogicError
+            ("Nonconformal matrices:\n",
+             DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
+    )
+    const Grid& g = C.Grid();
+    const Int depth = grid3D.Depth();
+
+    // Redistribute each piece of A and B from the base grid to its layer.
+    // Each redistribution involves every process in the base grid, but each
+    // entry of A and B is only communicated once in total.
+    std::vector<DistMatrix<T>> ALayers, BLayers;
+    ALayers.reserve( depth );
+    BLayers.reserve( depth );
+    const Int kPiece = ( k + depth - 1 ) / depth;
+    for( Int layer=0; layer<depth; ++layer )
+    {
+        const Grid& layerGrid = grid3D.LayerGrid( layer );
+        const Int kBeg = Min(layer*kPiece,k);
+        const Int kEnd = Min((layer+1)*kPiece,k);
+
+        // NOTE: The views are bound to lvalues so that they are copied onto
+        //       the layer grids rather than moved over the layer matrices
+        auto APiece =
+          ( orientationOfA == NORMAL ? LockedViewRange( A, 0, kBeg, m, kEnd )
+                                     : LockedViewRange( A, kBeg, 0, kEnd, m ) );
+        auto BPiece =
+          ( orientationOfB == NORMAL ? LockedViewRange( B, kBeg, 0, kEnd, n )
+                                     : LockedViewRange( B, 0, kBeg, n, kEnd ) );
+        ALayers.emplace_back( layerGrid );
+        ALayers.back() = APiece;
+        BLayers.emplace_back( layerGrid );
+        BLayers.back() = BPiece;
+    }
+
+    // Form each layer's contribution, where the results for every layer are
+    // identically distributed (so that they can be directly summed)
+    std::vector<DistMatrix<T>> CLayers;
+    CLayers.reserve( depth );
+    for( Int layer=0; layer<depth; ++layer )
+    {
+        CLayers.emplace_back( grid3D.LayerGrid(layer) );
+        Zeros( CLayers.back(), m, n );
+    }
+    const Int myLayer = grid3D.Layer();
+    if( myLayer != mpi::UNDEFINED )
+    {
+        DistMatrix<T>& CLayer = CLayers[myLayer];
+        Gemm
+        ( orientationOfA, orientationOfB,
+          alpha, ALayers[myLayer], BLayers[myLayer], T(0), CLayer );
+
+        // Sum the contributions onto the first layer
+        // NOTE: Freshly allocated matrices have contiguous local data
+        const Int localSize = CLayer.LocalHeight()*CLayer.LocalWidth();
+        mpi::Reduce
+        ( CLayer.Buffer(), localSize, mpi::SUM, 0, grid3D.DepthComm() );
+    }
+    ALayers.clear();
+    BLayers.clear();
+
+    // Redistribute the sum back to the base grid and update C
+    DistMatrix<T> CSum(g);
+    CSum.AlignWith( C );
+    CSum = CLayers[0];
+    CLayers.clear();
+    Scale( beta, C );
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
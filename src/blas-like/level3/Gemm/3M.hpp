@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Split the (conjugated, if op is the adjoint) complex matrix A into its real
+// and imaginary parts, as well as their sum
+template<typename Real>
+inline void
+SplitParts
+( Orientation orientation, const Matrix<Complex<Real>>& A,
+  Matrix<Real>& AReal, Matrix<Real>& AImag, Matrix<Real>& ASum )
+{
+    DEBUG_ONLY(CallStackEntry cse("gemm::SplitParts"))
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Real sign = ( orientation == ADJOINT ? Real(-1) : Real(1) );
+    AReal.Resize( height, width );
+    AImag.Resize( height, width );
+    ASum.Resize( height, width );
+    for( Int j=0; j<width; ++j )
+    {
+        const Complex<Real>* ACol = A.LockedBuffer(0,j);
+        Real* ARealCol = AReal.Buffer(0,j);
+        Real* AImagCol = AImag.Buffer(0,j);
+        Real* ASumCol = ASum.Buffer(0,j);
+        for( Int i=0; i<height; ++i )
+        {
+            ARealCol[i] = ACol[i].real();
+            AImagCol[i] = sign*ACol[i].imag();
+            ASumCol[i] = ARealCol[i] + AImagCol[i];
+        }
+    }
+}
+
+// The 3M (Gauss) algorithm for C := alpha op(A) op(B) + beta C, which forms
+// the product (Ar + i Ai)(Br + i Bi) from the three real products
+//   T1 = Ar Br, T2 = Ai Bi, and T3 = (Ar+Ai)(Br+Bi)
+// as (T1-T2) + i (T3-T1-T2), trading one of the four real products of the
+// conventional algorithm for O(mk+kn+mn) additions.
+template<typename Real>
+inline void
+ThreeM
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<Real> alpha, const Matrix<Complex<Real>>& A,
+                       const Matrix<Complex<Real>>& B,
+  Complex<Real> beta,        Matrix<Complex<Real>>& C )
+{
+    DEBUG_ONLY(CallStackEntry cse("gemm::ThreeM"))
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Orientation orientRealA =
+        ( orientationOfA == NORMAL ? NORMAL : TRANSPOSE );
+    const Orientation orientRealB =
+        ( orientationOfB == NORMAL ? NORMAL : TRANSPOSE );
+
+    Matrix<Real> AReal, AImag, ASum, BReal, BImag, BSum;
+    SplitParts( orientationOfA, A, AReal, AImag, ASum );
+    SplitParts( orientationOfB, B, BReal, BImag, BSum );
+
+    Matrix<Real> T1, T2, T3;
+    Gemm( orientRealA, orientRealB, Real(1), AReal, BReal, T1 );
+    Gemm( orientRealA, orientRealB, Real(1), AImag, BImag, T2 );
+    Gemm( orientRealA, orientRealB, Real(1), ASum,  BSum,  T3 );
+
+    for( Int j=0; j<n; ++j )
+    {
+        const Real* T1Col = T1.LockedBuffer(0,j);
+        const Real* T2Col = T2.LockedBuffer(0,j);
+        const Real* T3Col = T3.LockedBuffer(0,j);
+        Complex<Real>* CCol = C.Buffer(0,j);
+        if( beta == Complex<Real>(0) )
+        {
+            for( Int i=0; i<m; ++i )
+                CCol[i] =
+                    alpha*Complex<Real>
+                    (T1Col[i]-T2Col[i],T3Col[i]-T1Col[i]-T2Col[i]);
+        }
+        else
+        {
+            for( Int i=0; i<m; ++i )
+                CCol[i] =
+                    beta*CCol[i] +
+                    alpha*Complex<Real>
+                    (T1Col[i]-T2Col[i],T3Col[i]-T1Col[i]-T2Col[i]);
+        }
+    }
+}
+
+template<typename T>
+inline void
+ThreeM
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C )
+{
+    DEBUG_ONLY(CallStackEntry cse("gemm::ThreeM"))
+    LogicError("The 3M algorithm is only for complex matrices");
+}
+
+} // namespace gemm
+} // namespace El
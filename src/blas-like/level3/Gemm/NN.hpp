@@ -10,7 +10,22 @@
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
+// Cannon's algorithm, generalized to r x c process grids.
+//
+// The inner dimension is split into L=lcm(r,c) classes, where class K
+// contains the indices congruent to K modulo L. Since every column of A in
+// class K is owned by a single process column (and every row of B in class K
+// by a single process row), process (s,t) can multiply with class 
+// (s+t+q) mod L during step q, and each class of A (B) only needs to travel 
+// leftwards (upwards) by one process per step. When the grid is square, the 
+// classes simply circulate around the process rows/columns as in the 
+// traditional algorithm; otherwise, each class is dropped after reaching the 
+// first process column (row) and the next class is sent from its owner 
+// directly to the last process column (row).
+//
+// The shifts for step q+1 are posted with nonblocking sends/receives into
+// a second pair of buffers before the local multiply for step q so that the 
+// communication can be overlapped with computation.
 template<typename T>
 inline void
 Cannon_NN
@@ -28,64 +43,174 @@ Cannon_NN
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::Cannon_NN");
     const Grid& g = A.Grid();
-    if( g.Height() != g.Width() )
-        LogicError("Process grid must be square for Cannon's");
     if( C.ColAlign() != A.ColAlign() || C.RowAlign() != B.RowAlign() )
-        LogicError("C is not properly aligned");
+    {
+        // A must be aligned with the rows of C and B with the columns of C
+        DistMatrix<T> AAlign(g), BAlign(g);
+        AAlign.AlignColsWith( C );
+        BAlign.AlignRowsWith( C );
+        AAlign = A;
+        BAlign = B;
+        Cannon_NN( alpha, AAlign, BAlign, beta, C );
+        return;
+    }
 
+    const Int r = g.Height();
+    const Int c = g.Width();
     const Int row = g.Row();
     const Int col = g.Col();
-    const Int pSqrt = g.Height();
+    const Int numClasses = g.LCM();
+    const Int k = A.Width();
     mpi::Comm rowComm = g.RowComm();
     mpi::Comm colComm = g.ColComm(); 
-    if( A.Width() % pSqrt != 0 )
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
+    const bool ringA = ( numClasses == c );
+    const bool ringB = ( numClasses == r );
 
     // Begin by scaling our local portion of C
     Scale( beta, C );
 
-    // Load the initial A and B packages (may want to transpose B...)
     const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
     const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA), 
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-        MemCopy
-        ( pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA );
-    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
-        MemCopy
-        ( pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB );
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv( pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm );
-    mpi::SendRecv( pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm );
+    auto classA = [&]( Int s, Int t, Int q ) 
+                  { return Mod(s+t+q,numClasses); };
+    auto ownerA = [&]( Int K ) { return Mod(K+A.RowAlign(),c); };
+    auto ownerB = [&]( Int K ) { return Mod(K+B.ColAlign(),r); };
+
+    // Pack the columns of our local portion of A (or rows of our local 
+    // portion of B) which lie within class K
+    auto packA = [&]( Int K, Matrix<T>& pkg )
+    {
+        const Int width = Length( k, K, numClasses );
+        const Int jLocStart = K / c;
+        const Int jLocStride = numClasses / c;
+        pkg.Resize( localHeightA, width, Max(localHeightA,1) );
+        for( Int j=0; j<width; ++j )
+            MemCopy
+            ( pkg.Buffer(0,j), A.LockedBuffer(0,jLocStart+j*jLocStride), 
+              localHeightA );
+    };
+    auto packB = [&]( Int K, Matrix<T>& pkg )
+    {
+        const Int height = Length( k, K, numClasses );
+        const Int iLocStart = K / r;
+        const Int iLocStride = numClasses / r;
+        pkg.Resize( height, localWidthB, Max(height,1) );
+        for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+            StridedMemCopy
+            ( pkg.Buffer(0,jLoc), 1, 
+              B.LockedBuffer(iLocStart,jLoc), iLocStride, height );
+    };
+
+    // Perform the initial skew, which permutes the classes within each
+    // process row (column) so that process (s,t) holds class (s+t) mod L
+    Matrix<T> pkgA0, pkgA1, pkgB0, pkgB1, injectA, injectB;
+    Matrix<T> *pkgA=&pkgA0, *nextA=&pkgA1, *pkgB=&pkgB0, *nextB=&pkgB1;
+    {
+        const Int toA = Mod(col-row-A.RowAlign(),c);
+        const Int fromA = ownerA(classA(row,col,0));
+        packA( classA(row,toA,0), injectA );
+        pkgA->Resize
+        ( localHeightA, Length(k,classA(row,col,0),numClasses),
+          Max(localHeightA,1) );
+        mpi::SendRecv
+        ( injectA.LockedBuffer(), injectA.Height()*injectA.Width(), toA,
+          pkgA->Buffer(), pkgA->Height()*pkgA->Width(), fromA, rowComm );
+
+        const Int toB = Mod(row-col-B.ColAlign(),r);
+        const Int fromB = ownerB(classA(row,col,0));
+        packB( classA(toB,col,0), injectB );
+        const Int heightB = Length(k,classA(row,col,0),numClasses);
+        pkgB->Resize( heightB, localWidthB, Max(heightB,1) );
+        mpi::SendRecv
+        ( injectB.LockedBuffer(), injectB.Height()*injectB.Width(), toB,
+          pkgB->Buffer(), pkgB->Height()*pkgB->Width(), fromB, colComm );
+    }
 
     // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for( Int q=0; q<pSqrt; ++q )
+    const Int leftCol  = Mod(col-1,c);
+    const Int rightCol = Mod(col+1,c);
+    const Int aboveRow = Mod(row-1,r);
+    const Int belowRow = Mod(row+1,r);
+    std::vector<mpi::Request> requests;
+    requests.reserve( 6 );
+    for( Int q=0; q<numClasses; ++q )
     {
-        Gemm( NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix() );
-        if( q != pSqrt-1 )
+        requests.resize( 0 );
+        if( q != numClasses-1 )
         {
-            mpi::SendRecv
-            ( pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm );
-            mpi::SendRecv
-            ( pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm );
+            // Post the receives for the next step
+            const Int nextClass = classA(row,col,q+1);
+            const Int nextLength = Length(k,nextClass,numClasses);
+            nextA->Resize( localHeightA, nextLength, Max(localHeightA,1) );
+            nextB->Resize( nextLength, localWidthB, Max(nextLength,1) );
+            const bool injectedA = ( !ringA && col == c-1 );
+            const bool injectedB = ( !ringB && row == r-1 );
+            if( injectedA && ownerA(nextClass) == col )
+                packA( nextClass, *nextA );
+            else
+            {
+                requests.push_back( mpi::REQUEST_NULL );
+                mpi::IRecv
+                ( nextA->Buffer(), localHeightA*nextLength, 
+                  injectedA ? ownerA(nextClass) : rightCol, rowComm, 
+                  requests.back() );
+            }
+            if( injectedB && ownerB(nextClass) == row )
+                packB( nextClass, *nextB );
+            else
+            {
+                requests.push_back( mpi::REQUEST_NULL );
+                mpi::IRecv
+                ( nextB->Buffer(), nextLength*localWidthB,
+                  injectedB ? ownerB(nextClass) : belowRow, colComm, 
+                  requests.back() );
+            }
+
+            // Post the sends to our left (upper) neighbor
+            if( ringA || col != 0 )
+            {
+                requests.push_back( mpi::REQUEST_NULL );
+                mpi::ISend
+                ( pkgA->LockedBuffer(), pkgA->Height()*pkgA->Width(), 
+                  leftCol, rowComm, requests.back() );
+            }
+            if( ringB || row != 0 )
+            {
+                requests.push_back( mpi::REQUEST_NULL );
+                mpi::ISend
+                ( pkgB->LockedBuffer(), pkgB->Height()*pkgB->Width(), 
+                  aboveRow, colComm, requests.back() );
+            }
+
+            // Inject any classes that we own into the last column (row)
+            const Int injectClassA = classA(row,c-1,q+1);
+            if( !ringA && ownerA(injectClassA) == col && col != c-1 )
+            {
+                packA( injectClassA, injectA );
+                requests.push_back( mpi::REQUEST_NULL );
+                mpi::ISend
+                ( injectA.LockedBuffer(), injectA.Height()*injectA.Width(),
+                  c-1, rowComm, requests.back() );
+            }
+            const Int injectClassB = classA(r-1,col,q+1);
+            if( !ringB && ownerB(injectClassB) == row && row != r-1 )
+            {
+                packB( injectClassB, injectB );
+                requests.push_back( mpi::REQUEST_NULL );
+                mpi::ISend
+                ( injectB.LockedBuffer(), injectB.Height()*injectB.Width(),
+                  r-1, colComm, requests.back() );
+            }
         }
+
+        Gemm( NORMAL, NORMAL, alpha, *pkgA, *pkgB, T(1), C.Matrix() );
+
+        if( requests.size() != 0 )
+            mpi::WaitAll( requests.size(), requests.data() );
+        std::swap( pkgA, nextA );
+        std::swap( pkgB, nextB );
     }
 }
 
@@ -107,6 +232,7 @@ SUMMA_NNA
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NNA");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -177,6 +303,7 @@ SUMMA_NNB
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NNB");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -258,6 +385,7 @@ SUMMA_NNC
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NNC");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -328,6 +456,7 @@ SUMMA_NNDot
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NNDot");
     const Grid& g = A.Grid();
 
     if( A.Height() > B.Width() )
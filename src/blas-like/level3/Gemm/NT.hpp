@@ -10,6 +10,28 @@
 namespace El {
 namespace gemm {
 
+// Cannon's algorithm for C := alpha A B^{T/H} + beta C, which explicitly
+// forms B^{T/H}, with its rows aligned with C, before running Cannon_NN
+template<typename T>
+inline void
+Cannon_NT
+( Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("gemm::Cannon_NT");
+        if( orientationOfB == NORMAL )
+            LogicError("B must be (Conjugate)Transposed");
+    )
+    ProfileRegion region("gemm::Cannon_NT");
+    DistMatrix<T> BTrans(B.Grid());
+    BTrans.AlignRowsWith( C );
+    Transpose( B, BTrans, orientationOfB==ADJOINT );
+    Cannon_NN( alpha, A, BTrans, beta, C );
+}
+
 // Normal Transpose Gemm that avoids communicating the matrix A
 template<typename T>
 inline void
@@ -31,6 +53,7 @@ SUMMA_NTA
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NTA");
     const Grid& g = A.Grid();
     const bool conjugate = ( orientationOfB == ADJOINT );
 
@@ -110,6 +133,7 @@ SUMMA_NTB
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NTB");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -202,6 +226,7 @@ SUMMA_NTC
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_NTC");
     const Grid& g = A.Grid();
     const bool conjugate = ( orientationOfB == ADJOINT );
 
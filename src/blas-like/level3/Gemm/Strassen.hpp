@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Return a view of the submatrix of A which corresponds to the submatrix
+// op(A)(i:i+height-1,j:j+width-1), so that op(view) is the desired block
+template<typename T>
+inline Matrix<T>
+OpView
+( Orientation orientation, const Matrix<T>& A,
+  Int i, Int j, Int height, Int width )
+{
+    if( orientation == NORMAL )
+        return LockedView( A, i, j, height, width );
+    else
+        return LockedView( A, j, i, width, height );
+}
+
+// Z := X + Y
+template<typename T>
+inline void
+Sum( const Matrix<T>& X, const Matrix<T>& Y, Matrix<T>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("gemm::Sum"))
+    const Int height = Z.Height();
+    const Int width = Z.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        const T* XCol = X.LockedBuffer(0,j);
+        const T* YCol = Y.LockedBuffer(0,j);
+              T* ZCol = Z.Buffer(0,j);
+        for( Int i=0; i<height; ++i )
+            ZCol[i] = XCol[i] + YCol[i];
+    }
+}
+
+// Z := X - Y
+template<typename T>
+inline void
+Difference( const Matrix<T>& X, const Matrix<T>& Y, Matrix<T>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("gemm::Difference"))
+    const Int height = Z.Height();
+    const Int width = Z.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        const T* XCol = X.LockedBuffer(0,j);
+        const T* YCol = Y.LockedBuffer(0,j);
+              T* ZCol = Z.Buffer(0,j);
+        for( Int i=0; i<height; ++i )
+            ZCol[i] = XCol[i] - YCol[i];
+    }
+}
+
+// One level of the Strassen-Winograd algorithm for
+//   C := alpha op(A) op(B) + beta C,
+// where each of the seven half-size products is formed by Gemm (which
+// recursively applies this routine until a dimension drops below the cutoff).
+// The even portions of the dimensions are handled by the recursion and the
+// remaining (at most one) row, column, and inner index are peeled off.
+//
+// Since the operand sums are formed in the native orientations of A and B,
+// and op(X+Y) = op(X)+op(Y), the transposed cases require no explicit
+// transposition. The workspace for the sums and the two half-size products
+// which cannot be accumulated directly into C is taken from a single
+// Memory<T> allocation of (mk+kn+2mn)/4 entries per level.
+template<typename T>
+inline void
+Strassen
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C )
+{
+    DEBUG_ONLY(CallStackEntry cse("gemm::Strassen"))
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( orientationOfA == NORMAL ? A.Width() : A.Height() );
+    const Int m2 = m/2;
+    const Int n2 = n/2;
+    const Int k2 = k/2;
+    DEBUG_ONLY(
+        if( m2 == 0 || n2 == 0 || k2 == 0 )
+            LogicError("Strassen requires all dimensions to be at least two");
+    )
+    Scale( beta, C );
+
+    auto AOp = [&]( Int i, Int j )
+               { return OpView( orientationOfA, A, i*m2, j*k2, m2, k2 ); };
+    auto BOp = [&]( Int i, Int j )
+               { return OpView( orientationOfB, B, i*k2, j*n2, k2, n2 ); };
+    const Matrix<T> A11=AOp(0,0), A12=AOp(0,1), A21=AOp(1,0), A22=AOp(1,1);
+    const Matrix<T> B11=BOp(0,0), B12=BOp(0,1), B21=BOp(1,0), B22=BOp(1,1);
+    Matrix<T> C11 = View( C, 0,  0,  m2, n2 ),
+              C12 = View( C, 0,  n2, m2, n2 ),
+              C21 = View( C, m2, 0,  m2, n2 ),
+              C22 = View( C, m2, n2, m2, n2 );
+
+    // Carve the workspace out of a single allocation
+    Memory<T> memory( 2*m2*n2 + m2*k2 + k2*n2 );
+    T* buffer = memory.Buffer();
+    Matrix<T> W( m2, n2, &buffer[0], m2 ), P( m2, n2, &buffer[m2*n2], m2 );
+    Matrix<T> S, U;
+    if( orientationOfA == NORMAL )
+        S.Attach( m2, k2, &buffer[2*m2*n2], m2 );
+    else
+        S.Attach( k2, m2, &buffer[2*m2*n2], k2 );
+    if( orientationOfB == NORMAL )
+        U.Attach( k2, n2, &buffer[2*m2*n2+m2*k2], k2 );
+    else
+        U.Attach( n2, k2, &buffer[2*m2*n2+m2*k2], n2 );
+
+    // W := alpha A11 B11 and C11 += W + alpha A12 B21
+    Gemm( orientationOfA, orientationOfB, alpha, A11, B11, T(0), W );
+    Axpy( T(1), W, C11 );
+    Gemm( orientationOfA, orientationOfB, alpha, A12, B21, T(1), C11 );
+
+    // W += alpha (A21+A22-A11) (B22-B12+B11) and add W into C12, C21, C22
+    Sum( A21, A22, S );
+    Axpy( T(-1), A11, S );
+    Difference( B22, B12, U );
+    Axpy( T(1), B11, U );
+    Gemm( orientationOfA, orientationOfB, alpha, S, U, T(1), W );
+    Axpy( T(1), W, C12 );
+    Axpy( T(1), W, C21 );
+    Axpy( T(1), W, C22 );
+
+    // C21 -= alpha A22 (B22-B12+B11-B21)
+    Axpy( T(-1), B21, U );
+    Gemm( orientationOfA, orientationOfB, -alpha, A22, U, T(1), C21 );
+
+    // C12 += alpha (A12-A21-A22+A11) B22
+    Difference( A12, S, S );
+    Gemm( orientationOfA, orientationOfB, alpha, S, B22, T(1), C12 );
+
+    // P := alpha (A11-A21) (B22-B12) and add P into C21 and C22
+    Difference( A11, A21, S );
+    Difference( B22, B12, U );
+    Gemm( orientationOfA, orientationOfB, alpha, S, U, T(0), P );
+    Axpy( T(1), P, C21 );
+    Axpy( T(1), P, C22 );
+
+    // P := alpha (A21+A22) (B12-B11) and add P into C12 and C22
+    Sum( A21, A22, S );
+    Difference( B12, B11, U );
+    Gemm( orientationOfA, orientationOfB, alpha, S, U, T(0), P );
+    Axpy( T(1), P, C12 );
+    Axpy( T(1), P, C22 );
+    memory.Empty();
+
+    // Peel off the remaining inner index, row, and column
+    Matrix<T> CEven = View( C, 0, 0, 2*m2, 2*n2 );
+    if( k != 2*k2 )
+        Gemm
+        ( orientationOfA, orientationOfB,
+          alpha, OpView( orientationOfA, A, 0, 2*k2, 2*m2, 1 ),
+                 OpView( orientationOfB, B, 2*k2, 0, 1, 2*n2 ),
+          T(1), CEven );
+    if( m != 2*m2 )
+    {
+        Matrix<T> cBottom = View( C, 2*m2, 0, 1, n );
+        Gemm
+        ( orientationOfA, orientationOfB,
+          alpha, OpView( orientationOfA, A, 2*m2, 0, 1, k ), B,
+          T(1), cBottom );
+    }
+    if( n != 2*n2 )
+    {
+        Matrix<T> cRight = View( C, 0, 2*n2, 2*m2, 1 );
+        Gemm
+        ( orientationOfA, orientationOfB,
+          alpha, OpView( orientationOfA, A, 0, 0, 2*m2, k ),
+                 OpView( orientationOfB, B, 0, 2*n2, k, 1 ),
+          T(1), cRight );
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -10,6 +10,28 @@
 namespace El {
 namespace gemm {
 
+// Cannon's algorithm for C := alpha A^{T/H} B + beta C, which explicitly
+// forms A^{T/H}, with its columns aligned with C, before running Cannon_NN
+template<typename T>
+inline void
+Cannon_TN
+( Orientation orientationOfA,
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("gemm::Cannon_TN");
+        if( orientationOfA == NORMAL )
+            LogicError("A must be (Conjugate)Transposed");
+    )
+    ProfileRegion region("gemm::Cannon_TN");
+    DistMatrix<T> ATrans(A.Grid());
+    ATrans.AlignColsWith( C );
+    Transpose( A, ATrans, orientationOfA==ADJOINT );
+    Cannon_NN( alpha, ATrans, B, beta, C );
+}
+
 // Transpose Normal Gemm that avoids communicating the matrix A
 template<typename T> 
 inline void
@@ -31,6 +53,7 @@ SUMMA_TNA
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_TNA");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -107,6 +130,7 @@ SUMMA_TNB
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_TNB");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -194,6 +218,7 @@ SUMMA_TNC
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_TNC");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -10,6 +10,30 @@
 namespace El {
 namespace gemm {
 
+// Cannon's algorithm for C := alpha A^{T/H} B^{T/H} + beta C, which 
+// explicitly forms A^{T/H} and B^{T/H} before running Cannon_NN
+template<typename T>
+inline void
+Cannon_TT
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T>& A,
+           const DistMatrix<T>& B,
+  T beta,        DistMatrix<T>& C )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("gemm::Cannon_TT");
+        if( orientationOfA == NORMAL || orientationOfB == NORMAL )
+            LogicError("A and B must be (Conjugate)Transposed");
+    )
+    ProfileRegion region("gemm::Cannon_TT");
+    DistMatrix<T> ATrans(A.Grid()), BTrans(B.Grid());
+    ATrans.AlignColsWith( C );
+    BTrans.AlignRowsWith( C );
+    Transpose( A, ATrans, orientationOfA==ADJOINT );
+    Transpose( B, BTrans, orientationOfB==ADJOINT );
+    Cannon_NN( alpha, ATrans, BTrans, beta, C );
+}
+
 // Transpose Transpose Gemm that avoids communicating the matrix A
 template<typename T>
 inline void
@@ -32,6 +56,7 @@ SUMMA_TTA
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_TTA");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -117,6 +142,7 @@ SUMMA_TTB
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_TTB");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -206,6 +232,7 @@ SUMMA_TTC
             ("Nonconformal matrices:\n",
              DimsString(A,"A"),"\n",DimsString(B,"B"),"\n",DimsString(C,"C"));
     )
+    ProfileRegion region("gemm::SUMMA_TTC");
     const Grid& g = A.Grid();
 
     // Matrix views
@@ -650,6 +650,7 @@ void LocalTrrk
         CallStackEntry cse("LocalTrrk");
         CheckInput( A, B, C );
     )
+    ProfileRegion region("LocalTrrk",true);
     const Grid& g = C.Grid();
 
     if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
@@ -697,6 +698,7 @@ void LocalTrrk
         CallStackEntry cse("LocalTrrk");
         CheckInput( A, B, C );
     )
+    ProfileRegion region("LocalTrrk",true);
     const Grid& g = C.Grid();
 
     if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
@@ -744,6 +746,7 @@ void LocalTrrk
         CallStackEntry cse("LocalTrrk");
         CheckInput( A, B, C );
     )
+    ProfileRegion region("LocalTrrk",true);
     const Grid& g = C.Grid();
 
     if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
@@ -791,6 +794,7 @@ void LocalTrrk
         CallStackEntry cse("LocalTrrk");
         CheckInput( A, B, C );
     )
+    ProfileRegion region("LocalTrrk",true);
     const Grid& g = C.Grid();
 
     if( C.Height() < g.Width()*LocalTrrkBlocksize<T>() )
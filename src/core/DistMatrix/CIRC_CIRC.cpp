@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MC,MR]"))
+    ProfileRegion region("[CIRC,CIRC] = [MC,MR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -41,6 +42,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MC,STAR]"))
+    ProfileRegion region("[CIRC,CIRC] = [MC,STAR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -49,6 +51,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,MR]"))
+    ProfileRegion region("[CIRC,CIRC] = [STAR,MR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -61,6 +64,7 @@ DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[CIRC,CIRC] = [MD,STAR]");
     const Int m = A.Height();
     const Int n = A.Width();
     this->Resize( m, n );
@@ -145,6 +149,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[CIRC,CIRC] = [STAR,MD]");
     const Int m = A.Height();
     const Int n = A.Width();
     this->Resize( m, n );
@@ -221,6 +226,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MR,MC]"))
+    ProfileRegion region("[CIRC,CIRC] = [MR,MC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -229,6 +235,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MR,STAR]"))
+    ProfileRegion region("[CIRC,CIRC] = [MR,STAR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -237,6 +244,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,MC]"))
+    ProfileRegion region("[CIRC,CIRC] = [STAR,MC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -245,6 +253,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [VC,STAR]"))
+    ProfileRegion region("[CIRC,CIRC] = [VC,STAR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -253,6 +262,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,VC]"))
+    ProfileRegion region("[CIRC,CIRC] = [STAR,VC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -261,6 +271,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [VR,STAR]"))
+    ProfileRegion region("[CIRC,CIRC] = [VR,STAR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -269,6 +280,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,VR]"))
+    ProfileRegion region("[CIRC,CIRC] = [STAR,VR]");
     this->CollectFrom( A );
     return *this;
 }
@@ -277,6 +289,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,STAR]"))
+    ProfileRegion region("[CIRC,CIRC] = [STAR,STAR]");
     this->Resize( A.Height(), A.Width() );
     if( A.Grid().VCRank() == this->Root() )
         this->matrix_ = A.LockedMatrix();
@@ -36,6 +36,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MC,STAR]"))
+    ProfileRegion region("[MC,MR] = [MC,STAR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -44,6 +45,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MR]"))
+    ProfileRegion region("[MC,MR] = [STAR,MR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -52,6 +54,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MD,STAR]"))
+    ProfileRegion region("[MC,MR] = [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -62,6 +65,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MD]"))
+    ProfileRegion region("[MC,MR] = [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -76,6 +80,7 @@ DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[MC,MR] = [MR,MC]");
     const El::Grid& g = A.Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -281,6 +286,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MR,STAR]"))
+    ProfileRegion region("[MC,MR] = [MR,STAR]");
     std::unique_ptr<DistMatrix<T,VR,STAR>> A_VR_STAR
     ( new DistMatrix<T,VR,STAR>(A) );
     std::unique_ptr<DistMatrix<T,VC,STAR>> A_VC_STAR
@@ -296,6 +302,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MC]"))
+    ProfileRegion region("[MC,MR] = [STAR,MC]");
     std::unique_ptr<DistMatrix<T,STAR,VC>> A_STAR_VC
     ( new DistMatrix<T,STAR,VC>(A) );
     std::unique_ptr<DistMatrix<T,STAR,VR>> A_STAR_VR
@@ -311,6 +318,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [VC,STAR]"))
+    ProfileRegion region("[MC,MR] = [VC,STAR]");
     A.PartialColAllToAll( *this );
     return *this;
 }
@@ -319,6 +327,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,VC]"))
+    ProfileRegion region("[MC,MR] = [STAR,VC]");
     DistMatrix<T,STAR,VR> A_STAR_VR(this->Grid());
     A_STAR_VR.AlignRowsWith(*this);
     A_STAR_VR = A;
@@ -330,6 +339,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [VR,STAR]"))
+    ProfileRegion region("[MC,MR] = [VR,STAR]");
     DistMatrix<T,VC,STAR> A_VC_STAR(this->Grid());
     A_VC_STAR.AlignColsWith(*this);
     A_VC_STAR = A;
@@ -341,6 +351,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,VR]"))
+    ProfileRegion region("[MC,MR] = [STAR,VR]");
     A.PartialRowAllToAll( *this );
     return *this;
 }
@@ -349,6 +360,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,STAR]"))
+    ProfileRegion region("[MC,MR] = [STAR,STAR]");
     this->FilterFrom( A );
     return *this;
 }
@@ -361,6 +373,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[MC,MR] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MC,MR]"))
+    ProfileRegion region("[MC,STAR] = [MC,MR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -41,6 +42,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MR]"))
+    ProfileRegion region("[MC,STAR] = [STAR,MR]");
     DistMatrix<T,MC,MR> A_MC_MR(this->Grid());
     A_MC_MR.AlignColsWith(*this);
     A_MC_MR = A;
@@ -52,6 +54,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MD,STAR]"))
+    ProfileRegion region("[MC,STAR] = [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -62,6 +65,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MD]"))
+    ProfileRegion region("[MC,STAR] = [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -72,6 +76,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MR,MC]"))
+    ProfileRegion region("[MC,STAR] = [MR,MC]");
     std::unique_ptr<DistMatrix<T,VR,STAR>> A_VR_STAR
     ( new DistMatrix<T,VR,STAR>(A) );
     std::unique_ptr<DistMatrix<T,VC,STAR>> A_VC_STAR
@@ -87,6 +92,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MR,STAR]"))
+    ProfileRegion region("[MC,STAR] = [MR,STAR]");
     std::unique_ptr<DistMatrix<T,VR,STAR>> A_VR_STAR
     ( new DistMatrix<T,VR,STAR>(A) );
     std::unique_ptr<DistMatrix<T,VC,STAR>> A_VC_STAR
@@ -102,6 +108,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MC]"))
+    ProfileRegion region("[MC,STAR] = [STAR,MC]");
     std::unique_ptr<DistMatrix<T,MR,MC>> 
         A_MR_MC( new DistMatrix<T,MR,MC>(A) );
     std::unique_ptr<DistMatrix<T,VR,STAR>> 
@@ -122,6 +129,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [VC,STAR]"))
+    ProfileRegion region("[MC,STAR] = [VC,STAR]");
     A.PartialColAllGather( *this );
     return *this;
 }
@@ -130,6 +138,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,VC]"))
+    ProfileRegion region("[MC,STAR] = [STAR,VC]");
     std::unique_ptr<DistMatrix<T,STAR,VR>> 
         A_STAR_VR( new DistMatrix<T,STAR,VR>(A) );
     std::unique_ptr<DistMatrix<T,MC,MR>> 
@@ -145,6 +154,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [VR,STAR]"))
+    ProfileRegion region("[MC,STAR] = [VR,STAR]");
     DistMatrix<T,VC,STAR> A_VC_STAR(this->Grid());
     A_VC_STAR.AlignColsWith(*this);
     A_VC_STAR = A;
@@ -156,6 +166,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,VR]"))
+    ProfileRegion region("[MC,STAR] = [STAR,VR]");
     DistMatrix<T,MC,MR> A_MC_MR(this->Grid());
     A_MC_MR.AlignColsWith(*this);
     A_MC_MR = A;
@@ -167,6 +178,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,STAR]"))
+    ProfileRegion region("[MC,STAR] = [STAR,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -175,6 +187,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [CIRC,CIRC]"))
+    ProfileRegion region("[MC,STAR] = [CIRC,CIRC]");
     DistMatrix<T,MC,MR> A_MC_MR( this->Grid() );
     A_MC_MR.AlignWith( *this );
     A_MC_MR = A;
@@ -37,6 +37,7 @@ DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[MR,MC] = [MC,MR]");
     const El::Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -245,6 +246,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MC,STAR]"))
+    ProfileRegion region("[MR,MC] = [MC,STAR]");
     std::unique_ptr<DistMatrix<T,VC,STAR>> A_VC_STAR
     ( new DistMatrix<T,VC,STAR>(A) );
 
@@ -262,6 +264,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MR]"))
+    ProfileRegion region("[MR,MC] = [STAR,MR]");
     std::unique_ptr<DistMatrix<T,STAR,VR>> A_STAR_VR
     ( new DistMatrix<T,STAR,VR>(A) );
 
@@ -279,6 +282,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MD,STAR]"))
+    ProfileRegion region("[MR,MC] = [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -289,6 +293,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MD]"))
+    ProfileRegion region("[MR,MC] = [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -299,6 +304,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MR,STAR]"))
+    ProfileRegion region("[MR,MC] = [MR,STAR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -307,6 +313,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MC]"))
+    ProfileRegion region("[MR,MC] = [STAR,MC]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -315,6 +322,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [VC,STAR]"))
+    ProfileRegion region("[MR,MC] = [VC,STAR]");
     DistMatrix<T,VR,STAR> A_VR_STAR( A );
     *this = A_VR_STAR;
     return *this;
@@ -324,6 +332,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,VC]"))
+    ProfileRegion region("[MR,MC] = [STAR,VC]");
     A.PartialRowAllToAll( *this );
     return *this;
 }
@@ -332,6 +341,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [VR,STAR]"))
+    ProfileRegion region("[MR,MC] = [VR,STAR]");
     A.PartialColAllToAll( *this );
     return *this;
 }
@@ -340,6 +350,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,VR]"))
+    ProfileRegion region("[MR,MC] = [STAR,VR]");
     DistMatrix<T,STAR,VC> A_STAR_VC( A );
     *this = A_STAR_VC;
     return *this;
@@ -349,6 +360,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,STAR]"))
+    ProfileRegion region("[MR,MC] = [STAR,STAR]");
     this->FilterFrom( A );
     return *this;
 }
@@ -362,6 +374,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[MR,MC] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -397,7 +410,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
                 const Int sLocalHeight = Length( m, s, colStride );
                 // NOTE: switched vs. [MC,MR] variant of [o, o] redist
                 const Int col = (colAlign+s) % colStride;
-                const Int q = row + col*colStride;
+                const Int q = row + col*rowStride;
                 for( Int jLoc=0; jLoc<tLocalWidth; ++jLoc )
                 {
                     const Int j = t + jLoc*rowStride;
@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [MC,MR]"))
+    ProfileRegion region("[MR,STAR] = [MC,MR]");
     std::unique_ptr<DistMatrix<T,VC,STAR>> A_VC_STAR
     ( new DistMatrix<T,VC,STAR>(A) );
 
@@ -54,6 +55,7 @@ DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[MR,STAR] = [MC,STAR]");
     const El::Grid& g = this->Grid();
     if( !this->Participating() )
     {
@@ -145,6 +147,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,MR]"))
+    ProfileRegion region("[MR,STAR] = [STAR,MR]");
     std::unique_ptr<DistMatrix<T,MC,MR>> A_MC_MR( new DistMatrix<T,MC,MR>(A) );
 
     std::unique_ptr<DistMatrix<T,VC,STAR>> A_VC_STAR
@@ -165,6 +168,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [MD,STAR]"))
+    ProfileRegion region("[MR,STAR] = [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -175,6 +179,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,MD]"))
+    ProfileRegion region("[MR,STAR] = [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -185,6 +190,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [MR,MC]"))
+    ProfileRegion region("[MR,STAR] = [MR,MC]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -193,6 +199,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,MC]"))
+    ProfileRegion region("[MR,STAR] = [STAR,MC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -202,6 +209,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [VC,STAR]"))
+    ProfileRegion region("[MR,STAR] = [VC,STAR]");
     DistMatrix<T,VR,STAR> A_VR_STAR(this->Grid());
     A_VR_STAR.AlignColsWith(*this);
     A_VR_STAR = A;
@@ -213,6 +221,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,VC]"))
+    ProfileRegion region("[MR,STAR] = [STAR,VC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -222,6 +231,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [VR,STAR]"))
+    ProfileRegion region("[MR,STAR] = [VR,STAR]");
     A.PartialColAllGather( *this );
     return *this;
 }
@@ -230,6 +240,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,VR]"))
+    ProfileRegion region("[MR,STAR] = [STAR,VR]");
     std::unique_ptr<DistMatrix<T,STAR,VC>> A_STAR_VC
     ( new DistMatrix<T,STAR,VC>(A) );
 
@@ -247,6 +258,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,STAR]"))
+    ProfileRegion region("[MR,STAR] = [STAR,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -255,6 +267,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [CIRC,CIRC]"))
+    ProfileRegion region("[MR,STAR] = [CIRC,CIRC]");
     DistMatrix<T,MR,MC> A_MR_MC( this->Grid() );
     A_MR_MC.AlignWith( *this );
     A_MR_MC = A;
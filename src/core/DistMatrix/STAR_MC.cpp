@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MC,MR]"))
+    ProfileRegion region("[STAR,MC] = [MC,MR]");
     std::unique_ptr<DistMatrix<T,STAR,VR>> A_STAR_VR
     ( new DistMatrix<T,STAR,VR>(A) );
 
@@ -50,6 +51,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MC,STAR]"))
+    ProfileRegion region("[STAR,MC] = [MC,STAR]");
     std::unique_ptr<DistMatrix<T,MC,MR>> A_MC_MR( new DistMatrix<T,MC,MR>(A) );
 
     std::unique_ptr<DistMatrix<T,STAR,VR>> A_STAR_VR
@@ -74,6 +76,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[STAR,MC] = [STAR,MR]");
     const El::Grid& g = this->Grid();
     if( A.Height() == 1 )
     {
@@ -164,6 +167,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MD,STAR]"))
+    ProfileRegion region("[STAR,MC] = [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -174,6 +178,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,MD]"))
+    ProfileRegion region("[STAR,MC] = [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -184,6 +189,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MR,MC]"))
+    ProfileRegion region("[STAR,MC] = [MR,MC]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -192,6 +198,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MR,STAR]"))
+    ProfileRegion region("[STAR,MC] = [MR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -201,6 +208,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [VC,STAR]"))
+    ProfileRegion region("[STAR,MC] = [VC,STAR]");
     std::unique_ptr<DistMatrix<T,VR,STAR>> A_VR_STAR
     ( new DistMatrix<T,VR,STAR>(A) );
 
@@ -218,6 +226,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,VC]"))
+    ProfileRegion region("[STAR,MC] = [STAR,VC]");
     A.PartialRowAllGather( *this );
     return *this;
 }
@@ -226,6 +235,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [VR,STAR]"))
+    ProfileRegion region("[STAR,MC] = [VR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -235,6 +245,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,VR]"))
+    ProfileRegion region("[STAR,MC] = [STAR,VR]");
     DistMatrix<T,STAR,VC> A_STAR_VC(this->Grid());
     A_STAR_VC.AlignRowsWith(*this);
     *this = A_STAR_VC = A;
@@ -245,6 +256,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,STAR]"))
+    ProfileRegion region("[STAR,MC] = [STAR,STAR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -253,6 +265,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [CIRC,CIRC]"))
+    ProfileRegion region("[STAR,MC] = [CIRC,CIRC]");
     DistMatrix<T,MR,MC> A_MR_MC( A.Grid() );
     A_MR_MC.AlignWith( *this );
     A_MR_MC = A;
@@ -25,6 +25,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,STAR]"))
+    ProfileRegion region("[STAR,STAR] = [STAR,STAR]");
     this->Resize( A.Height(), A.Width() );
     if( this->Grid() == A.Grid() )
     {
@@ -96,6 +97,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MC,MR]"))
+    ProfileRegion region("[STAR,STAR] = [MC,MR]");
     A.AllGather( *this );
     return *this;
 }
@@ -104,6 +106,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MC,STAR]"))
+    ProfileRegion region("[STAR,STAR] = [MC,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -112,6 +115,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,MR]"))
+    ProfileRegion region("[STAR,STAR] = [STAR,MR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -120,6 +124,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MD,STAR]"))
+    ProfileRegion region("[STAR,STAR] = [MD,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -128,6 +133,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,MD]"))
+    ProfileRegion region("[STAR,STAR] = [STAR,MD]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -136,6 +142,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MR,MC]"))
+    ProfileRegion region("[STAR,STAR] = [MR,MC]");
     A.AllGather( *this );
     return *this;
 }
@@ -144,6 +151,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MR,STAR]"))
+    ProfileRegion region("[STAR,STAR] = [MR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -152,6 +160,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,MC]"))
+    ProfileRegion region("[STAR,STAR] = [STAR,MC]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -160,6 +169,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [VC,STAR]"))
+    ProfileRegion region("[STAR,STAR] = [VC,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -168,6 +178,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,VC]"))
+    ProfileRegion region("[STAR,STAR] = [STAR,VC]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -176,6 +187,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [VR,STAR]"))
+    ProfileRegion region("[STAR,STAR] = [VR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -184,6 +196,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,VR]"))
+    ProfileRegion region("[STAR,STAR] = [STAR,VR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -192,6 +205,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [CIRC,CIRC]"))
+    ProfileRegion region("[STAR,STAR] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height(); 
     const Int n = A.Width();
@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MC,MR]"))
+    ProfileRegion region("[STAR,VC] = [MC,MR]");
     DistMatrix<T,STAR,VR> A_STAR_VR( A );
     *this = A_STAR_VR;
     return *this;
@@ -42,6 +43,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MC,STAR]"))
+    ProfileRegion region("[STAR,VC] = [MC,STAR]");
     std::unique_ptr<DistMatrix<T,MC,MR>> A_MC_MR( new DistMatrix<T,MC,MR>(A) );
     std::unique_ptr<DistMatrix<T,STAR,VR>> A_STAR_VR
     ( new DistMatrix<T,STAR,VR>(*A_MC_MR) );
@@ -54,6 +56,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,MR]"))
+    ProfileRegion region("[STAR,VC] = [STAR,MR]");
     DistMatrix<T,STAR,VR> A_STAR_VR( A );
     *this = A_STAR_VR;
     return *this;
@@ -63,6 +66,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MD,STAR]"))
+    ProfileRegion region("[STAR,VC] = [MD,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -73,6 +77,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,MD]"))
+    ProfileRegion region("[STAR,VC] = [STAR,MD]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -83,6 +88,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MR,MC]"))
+    ProfileRegion region("[STAR,VC] = [MR,MC]");
     this->PartialRowAllToAllFrom( A );
     return *this;
 }
@@ -91,6 +97,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MR,STAR]"))
+    ProfileRegion region("[STAR,VC] = [MR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -100,6 +107,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,MC]"))
+    ProfileRegion region("[STAR,VC] = [STAR,MC]");
     this->PartialRowFilterFrom( A );
     return *this;
 }
@@ -108,6 +116,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [VC,STAR]"))
+    ProfileRegion region("[STAR,VC] = [VC,STAR]");
     std::unique_ptr<DistMatrix<T,MC,MR>> A_MC_MR( new DistMatrix<T,MC,MR>(A) );
     std::unique_ptr<DistMatrix<T,STAR,VR>> A_STAR_VR
     ( new DistMatrix<T,STAR,VR>(*A_MC_MR) );
@@ -120,6 +129,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [VR,STAR]"))
+    ProfileRegion region("[STAR,VC] = [VR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -133,6 +143,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[STAR,VC] = [STAR,VR]");
     const Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -199,6 +210,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,STAR]"))
+    ProfileRegion region("[STAR,VC] = [STAR,STAR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -212,6 +224,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[VC,STAR] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
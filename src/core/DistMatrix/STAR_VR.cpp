@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MC,MR]"))
+    ProfileRegion region("[STAR,VR] = [MC,MR]");
     this->PartialRowAllToAllFrom( A );
     return *this;
 }
@@ -41,6 +42,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MC,STAR]"))
+    ProfileRegion region("[STAR,VR] = [MC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -50,6 +52,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,MR]"))
+    ProfileRegion region("[STAR,VR] = [STAR,MR]");
     this->PartialRowFilterFrom( A );
     return *this;
 }
@@ -58,6 +61,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MD,STAR]"))
+    ProfileRegion region("[STAR,VR] = [MD,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -68,6 +72,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,MD]"))
+    ProfileRegion region("[STAR,VR] = [STAR,MD]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -78,6 +83,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MR,MC]"))
+    ProfileRegion region("[STAR,VR] = [MR,MC]");
     DistMatrix<T,STAR,VC> A_STAR_VC( A );
     *this = A_STAR_VC;
     return *this;
@@ -87,6 +93,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MR,STAR]"))
+    ProfileRegion region("[STAR,VR] = [MR,STAR]");
     std::unique_ptr<DistMatrix<T,MR,MC>> A_MR_MC( new DistMatrix<T,MR,MC>(A) );
     std::unique_ptr<DistMatrix<T,STAR,VC>> 
         A_STAR_VC( new DistMatrix<T,STAR,VC>(*A_MR_MC) );
@@ -99,6 +106,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,MC]"))
+    ProfileRegion region("[STAR,VR] = [STAR,MC]");
     DistMatrix<T,STAR,VC> A_STAR_VC( A );
     *this = A_STAR_VC;
     return *this;
@@ -108,6 +116,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [VC,STAR]"))
+    ProfileRegion region("[STAR,VR] = [VC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -121,6 +130,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[STAR,VR] = [STAR,VC]");
     const El::Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -187,6 +197,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [VR,STAR]"))
+    ProfileRegion region("[STAR,VR] = [VR,STAR]");
     std::unique_ptr<DistMatrix<T,MR,MC>> A_MR_MC( new DistMatrix<T,MR,MC>(A) );
     std::unique_ptr<DistMatrix<T,STAR,VC>> A_STAR_VC
     ( new DistMatrix<T,STAR,VC>(*A_MR_MC) );
@@ -199,6 +210,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,STAR]"))
+    ProfileRegion region("[STAR,VR] = [STAR,STAR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -212,6 +224,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[VR,STAR] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MC,MR]"))
+    ProfileRegion region("[VC,STAR] = [MC,MR]");
     this->PartialColAllToAllFrom( A );
     return *this;
 }
@@ -41,6 +42,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MC,STAR]"))
+    ProfileRegion region("[VC,STAR] = [MC,STAR]");
     this->PartialColFilterFrom( A );
     return *this;
 }
@@ -49,6 +51,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,MR]"))
+    ProfileRegion region("[VC,STAR] = [STAR,MR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -58,6 +61,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MD,STAR]"))
+    ProfileRegion region("[VC,STAR] = [MD,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -68,6 +72,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,MD]"))
+    ProfileRegion region("[VC,STAR] = [STAR,MD]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -78,6 +83,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MR,MC]"))
+    ProfileRegion region("[VC,STAR] = [MR,MC]");
     DistMatrix<T,VR,STAR> A_VR_STAR( A );
     *this = A_VR_STAR;
     return *this;
@@ -87,6 +93,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MR,STAR]"))
+    ProfileRegion region("[VC,STAR] = [MR,STAR]");
     DistMatrix<T,VR,STAR> A_VR_STAR( A );
     *this = A_VR_STAR;
     return *this;
@@ -96,6 +103,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,MC]"))
+    ProfileRegion region("[VC,STAR] = [STAR,MC]");
     std::unique_ptr<DistMatrix<T,MR,MC>> A_MR_MC( new DistMatrix<T,MR,MC>(A) );
     std::unique_ptr<DistMatrix<T,VR,STAR>> A_VR_STAR
     ( new DistMatrix<T,VR,STAR>(*A_MR_MC) );
@@ -108,6 +116,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,VC]"))
+    ProfileRegion region("[VC,STAR] = [STAR,VC]");
     std::unique_ptr<DistMatrix<T,MR,MC>> A_MR_MC( new DistMatrix<T,MR,MC>(A) );
     std::unique_ptr<DistMatrix<T,VR,STAR>> 
         A_VR_STAR( new DistMatrix<T,VR,STAR>(*A_MR_MC) );
@@ -124,6 +133,7 @@ DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[VC,STAR] = [VR,STAR]");
     const Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -191,6 +201,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,VR]"))
+    ProfileRegion region("[VC,STAR] = [STAR,VR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -200,6 +211,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,STAR]"))
+    ProfileRegion region("[VC,STAR] = [STAR,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -213,6 +225,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[VC,STAR] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
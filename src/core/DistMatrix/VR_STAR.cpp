@@ -33,6 +33,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MC,MR]"))
+    ProfileRegion region("[VR,STAR] = [MC,MR]");
     DistMatrix<T,VC,STAR> A_VC_STAR( A );
     *this = A_VC_STAR;
     return *this;
@@ -42,6 +43,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MC,STAR]"))
+    ProfileRegion region("[VR,STAR] = [MC,STAR]");
     DistMatrix<T,VC,STAR> A_VC_STAR( A );
     *this = A_VC_STAR;
     return *this;
@@ -51,6 +53,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,MR]"))
+    ProfileRegion region("[VR,STAR] = [STAR,MR]");
     std::unique_ptr<DistMatrix<T,MC,MR>> A_MC_MR( new DistMatrix<T,MC,MR>(A) );
     std::unique_ptr<DistMatrix<T,VC,STAR>> 
         A_VC_STAR( new DistMatrix<T,VC,STAR>(*A_MC_MR) );
@@ -63,6 +66,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MD,STAR]"))
+    ProfileRegion region("[VR,STAR] = [MD,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -73,6 +77,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,MD]"))
+    ProfileRegion region("[VR,STAR] = [STAR,MD]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -83,6 +88,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MR,MC]"))
+    ProfileRegion region("[VR,STAR] = [MR,MC]");
     this->PartialColAllToAllFrom( A );
     return *this;
 }
@@ -91,6 +97,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MR,STAR]"))
+    ProfileRegion region("[VR,STAR] = [MR,STAR]");
     this->PartialColFilterFrom( A );
     return *this;
 }
@@ -99,6 +106,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,MC]"))
+    ProfileRegion region("[VR,STAR] = [STAR,MC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -112,6 +120,7 @@ DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[VR,STAR] = [VC,STAR]");
     const El::Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -179,6 +188,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,VC]"))
+    ProfileRegion region("[VR,STAR] = [STAR,VC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -188,6 +198,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,VR]"))
+    ProfileRegion region("[VR,STAR] = [STAR,VR]");
     std::unique_ptr<DistMatrix<T,MC,MR>> 
         A_MC_MR( new DistMatrix<T,MC,MR>(A) );
     std::unique_ptr<DistMatrix<T,VC,STAR>> 
@@ -201,6 +212,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,STAR]"))
+    ProfileRegion region("[VR,STAR] = [STAR,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -214,6 +226,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         this->AssertNotLocked();
         this->AssertSameGrid( A.Grid() );
     )
+    ProfileRegion region("[VR,STAR] = [CIRC,CIRC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -159,6 +159,15 @@ void Grid::SetUpGrid()
             mpi::ErrorHandlerSet( matrixDiagComm_,     mpi::ERRORS_RETURN );
             mpi::ErrorHandlerSet( matrixDiagPerpComm_, mpi::ERRORS_RETURN );
         )
+
+        // Name the communicators so that they can be identified in traces
+        mpi::SetName( matrixColComm_,      "MC"     );
+        mpi::SetName( matrixRowComm_,      "MR"     );
+        mpi::SetName( vectorColComm_,      "VC"     );
+        mpi::SetName( vectorRowComm_,      "VR"     );
+        mpi::SetName( matrixDiagComm_,     "MD"     );
+        mpi::SetName( matrixDiagPerpComm_, "MDPerp" );
+        mpi::SetName( owningComm_,         "Owning" );
     }
     else
     {
@@ -314,6 +323,83 @@ int Grid::DiagPathRank( int vectorColRank ) const
 
 int Grid::FirstVCRank( int diagPath ) const{ return diagPath*height_; }
 
+// Grid3D
+// ======
+
+Grid3D::Grid3D( const Grid& grid, int depth )
+: baseGrid_(grid), depth_(depth), layer_(mpi::UNDEFINED)
+{
+    DEBUG_ONLY(CallStackEntry cse("Grid3D::Grid3D"))
+    const int p = grid.Size();
+    if( depth < 1 || p % depth != 0 )
+        LogicError("Depth of ",depth," does not evenly divide ",p," processes");
+    const int layerSize = p / depth;
+    const int layerHeight = Grid::FindFactor( layerSize );
+
+    // Each layer owns a contiguous set of ranks from the base owning group
+    std::vector<int> layerRanks(layerSize);
+    mpi::Comm viewingComm = grid.ViewingComm();
+    mpi::Group owningGroup = grid.OwningGroup();
+    layerGrids_.resize( depth, 0 );
+    for( int layer=0; layer<depth; ++layer )
+    {
+        for( int q=0; q<layerSize; ++q )
+            layerRanks[q] = layer*layerSize + q;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup, layerSize, layerRanks.data(), layerGroup );
+        layerGrids_[layer] = 
+            new Grid( viewingComm, layerGroup, layerHeight, grid.Order() );
+        mpi::Free( layerGroup );
+    }
+
+    // Connect the processes which have the same rank within each layer
+    if( grid.InGrid() )
+    {
+        const int owningRank = grid.OwningRank();
+        layer_ = owningRank / layerSize;
+        mpi::Split
+        ( grid.OwningComm(), owningRank % layerSize, layer_, depthComm_ );
+    }
+}
+
+Grid3D::~Grid3D()
+{
+    for( Grid* layerGrid : layerGrids_ )
+        delete layerGrid;
+    if( !mpi::Finalized() && baseGrid_.InGrid() )
+        mpi::Free( depthComm_ );
+}
+
+const Grid& Grid3D::BaseGrid() const { return baseGrid_; }
+int Grid3D::Depth() const { return depth_; }
+int Grid3D::Layer() const { return layer_; }
+mpi::Comm Grid3D::DepthComm() const { return depthComm_; }
+
+const Grid& Grid3D::LayerGrid( int layer ) const 
+{ 
+    DEBUG_ONLY(
+        CallStackEntry cse("Grid3D::LayerGrid");
+        if( layer < 0 || layer >= depth_ )
+            LogicError("Invalid layer index");
+    )
+    return *layerGrids_[layer]; 
+}
+
+const Grid& Grid3D::LayerGrid() const
+{
+    if( layer_ == mpi::UNDEFINED )
+        LogicError("Process is not a member of any layer");
+    return *layerGrids_[layer_];
+}
+
+int Grid3D::FindDepth( int p )
+{
+    int depth = int(std::pow(double(p),1./3.)+0.5);
+    while( depth > 1 && (p % depth != 0 || depth*depth*depth > p) )
+        --depth;
+    return std::max(depth,1);
+}
+
 // Comparison functions
 // ====================
 
@@ -0,0 +1,571 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#ifdef EL_HAVE_PERF_EVENT
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+
+namespace {
+
+// Region paths are formed by joining the nested region names with a
+// separator which sorts before any printable character, so that sorting the
+// paths lists each region directly before its children
+const char pathSeparator = '\x01';
+
+// The hardware counters, each of which may be the weighted sum of several
+// perf events
+enum ProfileCounter
+{
+    CYCLES_COUNTER,
+    INSTRUCTIONS_COUNTER,
+    LLC_MISSES_COUNTER,
+    FP_OPS_COUNTER,
+    NUM_PROFILE_COUNTERS
+};
+const char* counterNames[NUM_PROFILE_COUNTERS] =
+{ "cycles", "instructions", "LLC misses", "FP ops" };
+
+struct ProfileFrame
+{
+    const char* name;
+    std::string path;
+    double startTime, childTime;
+    bool counted;
+    double startCounts[NUM_PROFILE_COUNTERS];
+};
+
+struct ProfileStats
+{
+    Int numCalls, numCounted;
+    double inclusiveTime, exclusiveTime;
+    double counts[NUM_PROFILE_COUNTERS];
+    ProfileStats()
+    : numCalls(0), numCounted(0), inclusiveTime(0), exclusiveTime(0)
+    {
+        for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+            counts[j] = 0;
+    }
+};
+
+struct ProfileEvent
+{
+    const char* name;
+    double startTime, endTime;
+};
+
+bool profiling = false;
+bool profilingWasEnabled = false;
+double profileOrigin = 0;
+Int maxProfileEvents = 1000000;
+Int numDroppedEvents = 0;
+std::string profileFile, profileTraceFile;
+std::vector<ProfileFrame> profileStack;
+std::map<std::string,ProfileStats> profileStats;
+std::vector<ProfileEvent> profileEvents;
+
+bool countingEvents = false;
+std::string profileFPEvents;
+std::vector<int> counterFiles[NUM_PROFILE_COUNTERS];
+std::vector<double> counterWeights[NUM_PROFILE_COUNTERS];
+
+#ifdef EL_HAVE_PERF_EVENT
+int OpenCounter( unsigned type, unsigned long long config )
+{
+    perf_event_attr attr;
+    std::memset( &attr, 0, sizeof(attr) );
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+}
+
+// Returns the count, scaled up if the event was multiplexed
+double ReadCounter( int file )
+{
+    unsigned long long values[3];
+    if( read( file, values, sizeof(values) ) != sizeof(values) ||
+        values[2] == 0 )
+        return 0;
+    return double(values[0])*(double(values[1])/double(values[2]));
+}
+#endif
+
+void CloseCounters()
+{
+    for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+    {
+#ifdef EL_HAVE_PERF_EVENT
+        for( int file : counterFiles[j] )
+            close( file );
+#endif
+        counterFiles[j].clear();
+        counterWeights[j].clear();
+    }
+    countingEvents = false;
+}
+
+void ReadCounters( double* counts )
+{
+    for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+    {
+        counts[j] = 0;
+#ifdef EL_HAVE_PERF_EVENT
+        for( std::size_t k=0; k<counterFiles[j].size(); ++k )
+            counts[j] += counterWeights[j][k]*ReadCounter(counterFiles[j][k]);
+#endif
+    }
+}
+
+// Concatenate the strings of every process in COMM_WORLD on the root
+std::string GatherStrings
+( const std::string& localString, std::vector<int>& sizes )
+{
+    const int commRank = mpi::Rank( mpi::COMM_WORLD );
+    const int commSize = mpi::Size( mpi::COMM_WORLD );
+    const int localSize = localString.size();
+    sizes.resize( commSize );
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, mpi::COMM_WORLD );
+    std::vector<int> offsets( commSize );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<byte> buffer( mpi::Pad(totalSize) );
+    mpi::Gather
+    ( reinterpret_cast<const byte*>(localString.data()), localSize,
+      buffer.data(), sizes.data(), offsets.data(), 0, mpi::COMM_WORLD );
+    if( commRank == 0 )
+        return std::string( reinterpret_cast<char*>(buffer.data()), totalSize );
+    else
+        return std::string();
+}
+
+std::string EscapeJSON( const char* name )
+{
+    std::string escaped;
+    for( const char* c=name; *c!='\0'; ++c )
+    {
+        if( *c == '"' || *c == '\\' )
+            escaped += '\\';
+        escaped += *c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+void EnableProfiling( bool enable )
+{
+    DEBUG_ONLY(CallStackEntry cse("EnableProfiling"))
+    if( enable && !profiling )
+    {
+        mpi::Barrier( mpi::COMM_WORLD );
+        if( !profilingWasEnabled )
+            profileOrigin = mpi::Time();
+        profilingWasEnabled = true;
+    }
+    profiling = enable;
+}
+
+bool Profiling()
+{ return profiling; }
+
+bool EnableProfileCounters( bool enable )
+{
+    DEBUG_ONLY(CallStackEntry cse("EnableProfileCounters"))
+    CloseCounters();
+    if( !enable )
+        return false;
+#ifdef EL_HAVE_PERF_EVENT
+    auto addCounter =
+      [&]( ProfileCounter counter, unsigned type, unsigned long long config,
+           double weight )
+      {
+          const int file = OpenCounter( type, config );
+          if( file >= 0 )
+          {
+              counterFiles[counter].push_back( file );
+              counterWeights[counter].push_back( weight );
+          }
+      };
+    addCounter
+    ( CYCLES_COUNTER, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, 1 );
+    addCounter
+    ( INSTRUCTIONS_COUNTER, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, 1 );
+    addCounter
+    ( LLC_MISSES_COUNTER, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, 1 );
+
+    // Parse the comma-separated list of 'code:weight' pairs
+    std::istringstream fpStream( profileFPEvents );
+    std::string token;
+    while( std::getline( fpStream, token, ',' ) )
+    {
+        const std::size_t colon = token.find( ':' );
+        const unsigned long long code =
+            std::strtoull( token.substr(0,colon).c_str(), 0, 0 );
+        const double weight =
+            ( colon == std::string::npos ? 1. :
+              std::atof(token.substr(colon+1).c_str()) );
+        addCounter( FP_OPS_COUNTER, PERF_TYPE_RAW, code, weight );
+    }
+#endif
+    for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+        if( !counterFiles[j].empty() )
+            countingEvents = true;
+    return countingEvents;
+}
+
+bool ProfileCounters()
+{ return countingEvents; }
+
+void SetProfileFPEvents( const std::string& events )
+{ profileFPEvents = events; }
+
+void ClearProfile()
+{
+    profileStats.clear();
+    profileEvents.clear();
+    numDroppedEvents = 0;
+}
+
+void SetMaxProfileEvents( Int maxEvents )
+{ maxProfileEvents = maxEvents; }
+
+void SetProfileFile( const std::string& filename )
+{ profileFile = filename; }
+
+void SetProfileTraceFile( const std::string& filename )
+{ profileTraceFile = filename; }
+
+void PushProfileRegion( const char* name, bool countEvents )
+{
+    ProfileFrame frame;
+    frame.name = name;
+    if( profileStack.empty() )
+        frame.path = name;
+    else
+        frame.path = profileStack.back().path + pathSeparator + name;
+    frame.childTime = 0;
+    frame.counted = countEvents && countingEvents;
+    if( frame.counted )
+        ReadCounters( frame.startCounts );
+    frame.startTime = mpi::Time();
+    profileStack.push_back( frame );
+}
+
+void PopProfileRegion()
+{
+    if( profileStack.empty() )
+        return;
+    const double endTime = mpi::Time();
+    const ProfileFrame& frame = profileStack.back();
+    const double time = endTime - frame.startTime;
+
+    ProfileStats& stats = profileStats[frame.path];
+    ++stats.numCalls;
+    stats.inclusiveTime += time;
+    stats.exclusiveTime += time - frame.childTime;
+    if( frame.counted )
+    {
+        double endCounts[NUM_PROFILE_COUNTERS];
+        ReadCounters( endCounts );
+        ++stats.numCounted;
+        for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+            stats.counts[j] += endCounts[j] - frame.startCounts[j];
+    }
+    if( Int(profileEvents.size()) < maxProfileEvents )
+    {
+        ProfileEvent event;
+        event.name = frame.name;
+        event.startTime = frame.startTime;
+        event.endTime = endTime;
+        profileEvents.push_back( event );
+    }
+    else
+        ++numDroppedEvents;
+
+    profileStack.pop_back();
+    if( !profileStack.empty() )
+        profileStack.back().childTime += time;
+}
+
+void PrintProfile( std::ostream& os, bool perRank )
+{
+    DEBUG_ONLY(CallStackEntry cse("PrintProfile"))
+    std::ostringstream localStream;
+    localStream.precision( 16 );
+    for( const auto& pair : profileStats )
+    {
+        const ProfileStats& stats = pair.second;
+        localStream << pair.first << '\t' << stats.numCalls << '\t'
+                    << stats.inclusiveTime << '\t' << stats.exclusiveTime
+                    << '\t' << stats.numCounted;
+        for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+            localStream << '\t' << stats.counts[j];
+        localStream << '\n';
+    }
+    // Only report the counters which were available on every process
+    int available[NUM_PROFILE_COUNTERS];
+    for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+        available[j] = !counterFiles[j].empty();
+    mpi::AllReduce
+    ( available, NUM_PROFILE_COUNTERS, mpi::LOGICAL_AND, mpi::COMM_WORLD );
+    Int numDropped = numDroppedEvents;
+    numDropped = mpi::AllReduce( numDropped, mpi::COMM_WORLD );
+    std::vector<int> sizes;
+    const std::string tables = GatherStrings( localStream.str(), sizes );
+    if( mpi::Rank(mpi::COMM_WORLD) != 0 )
+        return;
+
+    // path -> the statistics of each process (numCalls=0 if not entered)
+    const int commSize = sizes.size();
+    std::map<std::string,std::vector<ProfileStats>> summaries;
+    int offset = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        std::istringstream tableStream( tables.substr(offset,sizes[q]) );
+        offset += sizes[q];
+        std::string path;
+        while( std::getline( tableStream, path, '\t' ) )
+        {
+            ProfileStats stats;
+            tableStream >> stats.numCalls >> stats.inclusiveTime
+                        >> stats.exclusiveTime >> stats.numCounted;
+            for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+                tableStream >> stats.counts[j];
+            tableStream.ignore();
+            auto& pathStats = summaries[path];
+            pathStats.resize( commSize );
+            pathStats[q] = stats;
+        }
+    }
+
+    auto printName = [&]( const std::string& path )
+    {
+        const std::size_t lastSep = path.find_last_of( pathSeparator );
+        const Int depth = std::count( path.begin(), path.end(), pathSeparator );
+        os << std::string( 2*depth, ' ' )
+           << ( lastSep == std::string::npos ? path : path.substr(lastSep+1) );
+    };
+
+    os << "Profile over " << commSize << " processes (times in seconds; "
+       << "min/avg/max are over processes)\n"
+       << "region\tcalls\tincl min\tincl avg\tincl max\tmax rank"
+       << "\texcl min\texcl avg\texcl max\n";
+    for( const auto& pair : summaries )
+    {
+        const auto& pathStats = pair.second;
+        Int maxCalls = 0, maxRank = 0;
+        double inclMin = pathStats[0].inclusiveTime, inclSum = 0, inclMax = 0,
+               exclMin = pathStats[0].exclusiveTime, exclSum = 0, exclMax = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            const ProfileStats& stats = pathStats[q];
+            maxCalls = Max( maxCalls, stats.numCalls );
+            inclMin = Min( inclMin, stats.inclusiveTime );
+            exclMin = Min( exclMin, stats.exclusiveTime );
+            inclSum += stats.inclusiveTime;
+            exclSum += stats.exclusiveTime;
+            exclMax = Max( exclMax, stats.exclusiveTime );
+            if( stats.inclusiveTime > inclMax )
+            {
+                inclMax = stats.inclusiveTime;
+                maxRank = q;
+            }
+        }
+        printName( pair.first );
+        os << '\t' << maxCalls << '\t' << inclMin << '\t' << inclSum/commSize
+           << '\t' << inclMax << '\t' << maxRank << '\t' << exclMin << '\t'
+           << exclSum/commSize << '\t' << exclMax << '\n';
+    }
+    if( perRank )
+    {
+        os << "\nregion\trank\tcalls\tinclusive\texclusive\n";
+        for( const auto& pair : summaries )
+        {
+            for( int q=0; q<commSize; ++q )
+            {
+                const ProfileStats& stats = pair.second[q];
+                printName( pair.first );
+                os << '\t' << q << '\t' << stats.numCalls << '\t'
+                   << stats.inclusiveTime << '\t' << stats.exclusiveTime
+                   << '\n';
+            }
+        }
+    }
+
+    // Hardware counters summed over the processes, along with the derived
+    // rates per process (using the inclusive time of each process)
+    bool anyAvailable = false;
+    for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+        if( available[j] )
+            anyAvailable = true;
+    bool anyCounted = false;
+    for( const auto& pair : summaries )
+        for( const ProfileStats& stats : pair.second )
+            if( stats.numCounted > 0 )
+                anyCounted = true;
+    if( anyCounted && !anyAvailable )
+        os << "\n(hardware counters were requested but are unavailable)\n";
+    else if( anyCounted )
+    {
+        os << "\nregion";
+        for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+            if( available[j] )
+                os << '\t' << counterNames[j];
+        if( available[CYCLES_COUNTER] && available[INSTRUCTIONS_COUNTER] )
+            os << "\tIPC";
+        if( available[LLC_MISSES_COUNTER] )
+            os << "\tLLC miss GB/s per proc";
+        if( available[FP_OPS_COUNTER] )
+            os << "\tGFLOP/s per proc";
+        os << '\n';
+        for( const auto& pair : summaries )
+        {
+            double counts[NUM_PROFILE_COUNTERS];
+            for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+                counts[j] = 0;
+            double time = 0;
+            Int numCounted = 0;
+            for( const ProfileStats& stats : pair.second )
+            {
+                if( stats.numCounted == 0 )
+                    continue;
+                numCounted += stats.numCounted;
+                time += stats.inclusiveTime;
+                for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+                    counts[j] += stats.counts[j];
+            }
+            if( numCounted == 0 )
+                continue;
+            printName( pair.first );
+            for( Int j=0; j<NUM_PROFILE_COUNTERS; ++j )
+                if( available[j] )
+                    os << '\t' << counts[j];
+            if( available[CYCLES_COUNTER] && available[INSTRUCTIONS_COUNTER] )
+                os << '\t'
+                   << counts[INSTRUCTIONS_COUNTER]/
+                      Max(counts[CYCLES_COUNTER],1.);
+            // Assume 64-byte cache lines for the bandwidth estimate
+            if( available[LLC_MISSES_COUNTER] )
+                os << '\t'
+                   << 64*counts[LLC_MISSES_COUNTER]/(1e9*Max(time,1e-300));
+            if( available[FP_OPS_COUNTER] )
+                os << '\t' << counts[FP_OPS_COUNTER]/(1e9*Max(time,1e-300));
+            os << '\n';
+        }
+    }
+    if( numDropped > 0 )
+        os << "(" << numDropped << " region instances were dropped from "
+           << "the trace timeline)\n";
+    os.flush();
+}
+
+void WriteProfileTrace( const std::string& filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("WriteProfileTrace"))
+    const int commRank = mpi::Rank( mpi::COMM_WORLD );
+    std::ostringstream localStream;
+    localStream.precision( 16 );
+    localStream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"
+                << commRank << ",\"args\":{\"name\":\"rank " << commRank
+                << "\"}},\n";
+    for( const auto& event : profileEvents )
+    {
+        // The trace event format expects microseconds
+        const double start = 1e6*(event.startTime-profileOrigin);
+        const double duration = 1e6*(event.endTime-event.startTime);
+        localStream << "{\"name\":\"" << EscapeJSON(event.name)
+                    << "\",\"cat\":\"El\",\"ph\":\"X\",\"pid\":" << commRank
+                    << ",\"tid\":0,\"ts\":" << start << ",\"dur\":"
+                    << duration << "},\n";
+    }
+
+    // GatherStrings is collective, so every process must learn whether the
+    // root could open the file before any of them gives up
+    std::ofstream file;
+    int opened = 1;
+    if( commRank == 0 )
+    {
+        file.open( filename.c_str() );
+        opened = file.is_open();
+    }
+    mpi::Broadcast( opened, 0, mpi::COMM_WORLD );
+    if( !opened )
+        RuntimeError("Could not open ",filename);
+
+    std::vector<int> sizes;
+    std::string events = GatherStrings( localStream.str(), sizes );
+    if( commRank == 0 )
+    {
+        // Remove the trailing separator
+        events.resize( events.size()-2 );
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" << events
+             << "\n]}\n";
+    }
+}
+
+void FinalizeProfile()
+{
+    DEBUG_ONLY(CallStackEntry cse("FinalizeProfile"))
+    if( !profilingWasEnabled )
+        return;
+    profiling = false;
+    auto reset = []()
+    {
+        ClearProfile();
+        CloseCounters();
+        profileStack.clear();
+        profilingWasEnabled = false;
+    };
+
+    // Both reports are collective and every process learns whether its file
+    // could be opened, so all of them reset the profiler before rethrowing
+    try
+    {
+        if( profileFile.empty() )
+            PrintProfile( std::cout );
+        else
+        {
+            std::ofstream file;
+            int opened = 1;
+            if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+            {
+                file.open( profileFile.c_str() );
+                opened = file.is_open();
+            }
+            mpi::Broadcast( opened, 0, mpi::COMM_WORLD );
+            if( !opened )
+                RuntimeError("Could not open ",profileFile);
+            PrintProfile( file, true );
+        }
+        if( !profileTraceFile.empty() )
+            WriteProfileTrace( profileTraceFile );
+    }
+    catch( std::exception& )
+    {
+        reset();
+        throw;
+    }
+    reset();
+}
+
+} // namespace El
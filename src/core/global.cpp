@@ -19,6 +19,7 @@ Int numElemInits = 0;
 bool elemInitializedMpi = false;
 
 std::stack<Int> blocksizeStack;
+bool defaultBlocksizeModified = false;
 Grid* defaultGrid = 0;
 Args* args = 0;
 
@@ -47,6 +48,21 @@ Int localTrrkDoubleBlocksize = 64;
 Int localTrrkComplexFloatBlocksize = 64;
 Int localTrrkComplexDoubleBlocksize = 64;
 
+Int gemm3DDepth = 0;
+Int strassenCutoff = 0;
+bool gemm3M = false;
+
+// Tuned algorithmic blocksizes, keyed on routine, type, and grid dimensions
+std::map<std::string,Int> tunedBlocksizes;
+
+std::string TuningKey
+( std::string routine, std::string typeName, Int gridHeight, Int gridWidth )
+{
+    std::ostringstream os;
+    os << routine << " " << typeName << " " << gridHeight << " " << gridWidth;
+    return os.str();
+}
+
 // Qt5
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
@@ -317,6 +333,7 @@ void Initialize( int& argc, char**& argv )
     while( ! ::blocksizeStack.empty() )
         ::blocksizeStack.pop();
     ::blocksizeStack.push( 128 );
+    ::defaultBlocksizeModified = false;
 
     // Build the default grid
     defaultGrid = new Grid( mpi::COMM_WORLD );
@@ -350,6 +367,42 @@ void Initialize( int& argc, char**& argv )
     const long seed = (secs<<16) | (rank & 0xFFFF);
     ::generator.seed( seed );
     srand( seed );
+
+    // Load any tuned blocksizes
+    const char* tuningFile = getenv("EL_TUNING_FILE");
+    if( tuningFile != 0 )
+        LoadTuning( tuningFile );
+
+    // Enable communication tracing if requested
+    const char* commTrace = getenv("EL_COMM_TRACE");
+    if( commTrace != 0 )
+    {
+        if( std::string(commTrace) != "stdout" )
+            mpi::SetTraceFile( commTrace );
+        mpi::EnableTracing();
+    }
+
+    // Enable region profiling if requested
+    const char* profile = getenv("EL_PROFILE");
+    const char* profileTrace = getenv("EL_PROFILE_TRACE");
+    if( profile != 0 || profileTrace != 0 )
+    {
+        if( profile != 0 && std::string(profile) != "stdout" )
+            SetProfileFile( profile );
+        if( profileTrace != 0 )
+            SetProfileTraceFile( profileTrace );
+        EnableProfiling();
+    }
+    const char* profileFPEvents = getenv("EL_PROFILE_FP_EVENTS");
+    if( profileFPEvents != 0 )
+        SetProfileFPEvents( profileFPEvents );
+    if( getenv("EL_PROFILE_COUNTERS") != 0 )
+    {
+        const bool haveCounters = EnableProfileCounters();
+        if( !haveCounters && mpi::Rank(mpi::COMM_WORLD) == 0 )
+            std::cerr << "WARNING: Hardware performance counters are "
+                         "unavailable" << std::endl;
+    }
 }
 
 void Finalize()
@@ -366,6 +419,12 @@ void Finalize()
     }
     if( ::numElemInits == 0 )
     {
+        if( !mpi::Finalized() )
+        {
+            mpi::FinalizeTrace();
+            FinalizeProfile();
+        }
+
         delete ::args;
         ::args = 0;
 
@@ -415,6 +474,7 @@ void Finalize()
         ::defaultGrid = 0;
         while( ! ::blocksizeStack.empty() )
             ::blocksizeStack.pop();
+        ::tunedBlocksizes.clear();
     }
 }
 
@@ -429,7 +489,11 @@ Int Blocksize()
 { return ::blocksizeStack.top(); }
 
 void SetBlocksize( Int blocksize )
-{ ::blocksizeStack.top() = blocksize; }
+{ 
+    ::blocksizeStack.top() = blocksize; 
+    if( ::blocksizeStack.size() == 1 )
+        ::defaultBlocksizeModified = true;
+}
 
 void PushBlocksizeStack( Int blocksize )
 { ::blocksizeStack.push( blocksize ); }
@@ -437,6 +501,155 @@ void PushBlocksizeStack( Int blocksize )
 void PopBlocksizeStack()
 { ::blocksizeStack.pop(); }
 
+template<> std::string TypeName<Int>() { return "Int"; }
+template<> std::string TypeName<float>() { return "float"; }
+template<> std::string TypeName<double>() { return "double"; }
+template<> std::string TypeName<Complex<float>>() { return "Complex<float>"; }
+template<> std::string TypeName<Complex<double>>() { return "Complex<double>"; }
+
+template<typename T>
+Int Blocksize( std::string routine, Int gridHeight, Int gridWidth )
+{
+    // Explicitly requested blocksizes take precedence
+    if( ::blocksizeStack.size() > 1 || ::defaultBlocksizeModified )
+        return ::blocksizeStack.top();
+
+    const std::string key = 
+        TuningKey( routine, TypeName<T>(), gridHeight, gridWidth );
+    auto it = ::tunedBlocksizes.find( key );
+    if( it != ::tunedBlocksizes.end() )
+        return it->second;
+    else
+        return ::blocksizeStack.top();
+}
+
+void SetTunedBlocksize
+( std::string routine, std::string typeName, 
+  Int gridHeight, Int gridWidth, Int blocksize )
+{
+    DEBUG_ONLY(CallStackEntry cse("SetTunedBlocksize"))
+    if( blocksize < 1 )
+        LogicError("Tuned blocksizes must be positive");
+    if( (gridHeight == 0) != (gridWidth == 0) || gridHeight < 0 ||
+        gridWidth < 0 )
+        LogicError
+        ("Invalid grid dimensions ",gridHeight," x ",gridWidth,
+         " (use 0 x 0 for sequential routines)");
+    ::tunedBlocksizes[TuningKey(routine,typeName,gridHeight,gridWidth)] = 
+        blocksize;
+
+    // The local kernel blocksizes are independent of the grid and are
+    // therefore immediately applied
+    const bool isLocalSymv = ( routine == "LocalSymv" );
+    const bool isLocalTrrk = ( routine == "LocalTrrk" );
+    const bool isLocalTrr2k = ( routine == "LocalTrr2k" );
+    if( !isLocalSymv && !isLocalTrrk && !isLocalTrr2k )
+        return;
+    Int* blocksizes[4];
+    if( isLocalSymv )
+    {
+        blocksizes[0] = &::localSymvFloatBlocksize;
+        blocksizes[1] = &::localSymvDoubleBlocksize;
+        blocksizes[2] = &::localSymvComplexFloatBlocksize;
+        blocksizes[3] = &::localSymvComplexDoubleBlocksize;
+    }
+    else if( isLocalTrrk )
+    {
+        blocksizes[0] = &::localTrrkFloatBlocksize;
+        blocksizes[1] = &::localTrrkDoubleBlocksize;
+        blocksizes[2] = &::localTrrkComplexFloatBlocksize;
+        blocksizes[3] = &::localTrrkComplexDoubleBlocksize;
+    }
+    else
+    {
+        blocksizes[0] = &::localTrr2kFloatBlocksize;
+        blocksizes[1] = &::localTrr2kDoubleBlocksize;
+        blocksizes[2] = &::localTrr2kComplexFloatBlocksize;
+        blocksizes[3] = &::localTrr2kComplexDoubleBlocksize;
+    }
+    if( typeName == TypeName<float>() )
+        *blocksizes[0] = blocksize;
+    else if( typeName == TypeName<double>() )
+        *blocksizes[1] = blocksize;
+    else if( typeName == TypeName<Complex<float>>() )
+        *blocksizes[2] = blocksize;
+    else if( typeName == TypeName<Complex<double>>() )
+        *blocksizes[3] = blocksize;
+}
+
+bool HaveTunedBlocksize
+( std::string routine, std::string typeName, Int gridHeight, Int gridWidth )
+{
+    const std::string key = 
+        TuningKey( routine, typeName, gridHeight, gridWidth );
+    return ::tunedBlocksizes.find( key ) != ::tunedBlocksizes.end();
+}
+
+void ClearTunedBlocksizes()
+{ ::tunedBlocksizes.clear(); }
+
+void LoadTuning( std::string filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("LoadTuning"))
+    // Read the file on the root and broadcast its contents so that large
+    // jobs do not hammer the filesystem
+    std::string contents;
+    Int size = 0;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            std::ostringstream os;
+            os << file.rdbuf();
+            contents = os.str();
+            size = contents.size();
+        }
+        else
+            size = -1;
+    }
+    mpi::Broadcast( size, 0, comm );
+    if( size < 0 )
+        RuntimeError("Could not open tuning file ",filename);
+    std::vector<byte> buffer( size );
+    if( mpi::Rank(comm) == 0 )
+        MemCopy( buffer.data(), (const byte*)contents.data(), size );
+    mpi::Broadcast( buffer.data(), size, 0, comm );
+    contents.assign( (const char*)buffer.data(), size );
+
+    std::istringstream is( contents );
+    std::string line;
+    Int lineNum = 0;
+    while( std::getline( is, line ) )
+    {
+        ++lineNum;
+        const std::size_t commentPos = line.find('#');
+        if( commentPos != std::string::npos )
+            line.erase( commentPos );
+        std::istringstream lineStream( line );
+        std::string routine, typeName;
+        Int gridHeight, gridWidth, blocksize;
+        if( !(lineStream >> routine) )
+            continue;
+        if( !(lineStream >> typeName >> gridHeight >> gridWidth >> blocksize) )
+            RuntimeError("Invalid entry on line ",lineNum," of ",filename);
+        SetTunedBlocksize( routine, typeName, gridHeight, gridWidth, blocksize );
+    }
+}
+
+void SaveTuning( std::string filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("SaveTuning"))
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open tuning file ",filename);
+    file << "# routine type gridHeight gridWidth blocksize\n";
+    for( const auto& entry : ::tunedBlocksizes )
+        file << entry.first << " " << entry.second << "\n";
+}
+
 const Grid& DefaultGrid()
 {
     DEBUG_ONLY(
@@ -596,4 +809,35 @@ template<>
 Int LocalTrrkBlocksize<Complex<double>>()
 { return ::localTrrkComplexDoubleBlocksize; }
 
+void SetGemm3DDepth( Int depth )
+{ 
+    if( depth < 0 )
+        LogicError("The 3D Gemm depth must be non-negative");
+    ::gemm3DDepth = depth; 
+}
+
+Int Gemm3DDepth()
+{ return ::gemm3DDepth; }
+
+void SetStrassenCutoff( Int cutoff )
+{
+    if( cutoff < 0 || cutoff == 1 )
+        LogicError("The Strassen cutoff must be zero or at least two");
+    ::strassenCutoff = cutoff;
+}
+
+Int StrassenCutoff()
+{ return ::strassenCutoff; }
+
+void SetGemm3M( bool use3M )
+{ ::gemm3M = use3M; }
+
+bool Gemm3M()
+{ return ::gemm3M; }
+
+#define PROTO(T) \
+  template Int Blocksize<T>\
+  ( std::string routine, Int gridHeight, Int gridWidth );
+#include "El/macros/Instantiate.h"
+
 } // namespace El
@@ -174,6 +174,281 @@ void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler )
 #endif
 }
 
+void SetName( Comm comm, const char* name )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::SetName"))
+    SafeMpi( MPI_Comm_set_name( comm.comm, const_cast<char*>(name) ) );
+}
+
+std::string Name( Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Name"))
+    if( comm == COMM_NULL )
+        return "-";
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    SafeMpi( MPI_Comm_get_name( comm.comm, name, &length ) );
+    return std::string( name, length );
+}
+
+// Communication tracing
+// =====================
+
+namespace {
+
+struct TraceEntry
+{
+    long long numCalls, bytesSent, bytesRecv;
+    double time;
+    TraceEntry() : numCalls(0), bytesSent(0), bytesRecv(0), time(0) { }
+};
+
+bool tracing = false;
+bool tracingWasEnabled = false;
+int traceDepth = 0;
+std::string traceFile;
+std::vector<const char*> traceRoutines;
+// Entries are keyed by 'routine<TAB>wrapper<TAB>communicator'
+std::map<std::string,TraceEntry> traceEntries;
+
+// Records a single call of a communication wrapper. Since several wrappers
+// are implemented in terms of others, only the outermost call is recorded.
+class Tracer
+{
+public:
+    Tracer( const char* wrapper, Comm comm )
+    : active_(tracing && traceDepth == 0), wrapper_(wrapper), comm_(comm),
+      bytesSent_(0), bytesRecv_(0), startTime_(0)
+    {
+        if( active_ )
+        {
+            ++traceDepth;
+            startTime_ = MPI_Wtime();
+        }
+    }
+
+    ~Tracer()
+    {
+        if( active_ )
+        {
+            const double time = MPI_Wtime() - startTime_;
+            --traceDepth;
+            std::string commName = Name( comm_ );
+            if( commName.empty() )
+                commName = "(unnamed)";
+            std::string key =
+                ( traceRoutines.empty() ? "(top level)" : traceRoutines.back() );
+            key += '\t';
+            key += wrapper_;
+            key += '\t';
+            key += commName;
+            TraceEntry& entry = traceEntries[key];
+            ++entry.numCalls;
+            entry.bytesSent += bytesSent_;
+            entry.bytesRecv += bytesRecv_;
+            entry.time += time;
+        }
+    }
+
+    bool Active() const { return active_; }
+
+    void SetBytes( long long bytesSent, long long bytesRecv )
+    {
+        bytesSent_ = bytesSent;
+        bytesRecv_ = bytesRecv;
+    }
+
+private:
+    bool active_;
+    const char* wrapper_;
+    Comm comm_;
+    long long bytesSent_, bytesRecv_;
+    double startTime_;
+};
+
+template<typename T>
+inline long long Bytes( long long count )
+{ return count*sizeof(T); }
+
+template<typename T>
+inline long long Bytes( const int* counts, int numCounts )
+{
+    long long count = 0;
+    for( int i=0; i<numCounts; ++i )
+        count += counts[i];
+    return count*sizeof(T);
+}
+
+// The byte counts are only evaluated when the call is being recorded. They
+// measure the portions of the send and receive buffers which were used by
+// this process rather than the traffic generated by the MPI implementation.
+#define EL_TRACE_COMM(wrapper,comm,bytesSent,bytesRecv) \
+    Tracer tracer( wrapper, comm ); \
+    if( tracer.Active() ) \
+        tracer.SetBytes( bytesSent, bytesRecv );
+
+} // anonymous namespace
+
+void EnableTracing( bool enable )
+{
+    tracing = enable;
+    if( enable )
+        tracingWasEnabled = true;
+}
+
+bool Tracing()
+{ return tracing; }
+
+void ClearTrace()
+{ traceEntries.clear(); }
+
+void SetTraceFile( const std::string& filename )
+{ traceFile = filename; }
+
+void PushTraceRoutine( const char* routine )
+{ traceRoutines.push_back( routine ); }
+
+void PopTraceRoutine()
+{
+    if( !traceRoutines.empty() )
+        traceRoutines.pop_back();
+}
+
+void PrintTrace( std::ostream& os )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::PrintTrace"))
+    // Do not record the communication used to form the report
+    const bool wasTracing = tracing;
+    tracing = false;
+
+    std::ostringstream localStream;
+    for( const auto& pair : traceEntries )
+    {
+        const TraceEntry& entry = pair.second;
+        localStream << pair.first << '\t' << entry.numCalls << '\t'
+                    << entry.bytesSent << '\t' << entry.bytesRecv << '\t'
+                    << entry.time << '\n';
+    }
+    const std::string localTable = localStream.str();
+
+    const int commRank = Rank( COMM_WORLD );
+    const int commSize = Size( COMM_WORLD );
+    const int localSize = localTable.size();
+    std::vector<int> sizes( commSize ), offsets( commSize );
+    Gather( &localSize, 1, sizes.data(), 1, 0, COMM_WORLD );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<char> tables( Pad(totalSize) );
+    SafeMpi
+    ( MPI_Gatherv
+      ( const_cast<char*>(localTable.data()), localSize, MPI_CHAR,
+        tables.data(), sizes.data(), offsets.data(), MPI_CHAR,
+        0, COMM_WORLD.comm ) );
+
+    if( commRank == 0 )
+    {
+        struct Summary
+        {
+            long long numCalls, bytesSent, bytesRecv;
+            double totalTime, maxTime;
+            Summary()
+            : numCalls(0), bytesSent(0), bytesRecv(0), totalTime(0), maxTime(0)
+            { }
+        };
+        // routine -> (wrapper<TAB>communicator -> summary)
+        std::map<std::string,std::map<std::string,Summary>> summaries;
+        std::istringstream tableStream( std::string(tables.data(),totalSize) );
+        std::string routine, wrapper, commName;
+        while( std::getline( tableStream, routine, '\t' ) )
+        {
+            std::getline( tableStream, wrapper, '\t' );
+            std::getline( tableStream, commName, '\t' );
+            TraceEntry entry;
+            tableStream >> entry.numCalls >> entry.bytesSent
+                        >> entry.bytesRecv >> entry.time;
+            tableStream.ignore();
+            Summary& summary = summaries[routine][wrapper+'\t'+commName];
+            summary.numCalls += entry.numCalls;
+            summary.bytesSent += entry.bytesSent;
+            summary.bytesRecv += entry.bytesRecv;
+            summary.totalTime += entry.time;
+            summary.maxTime = std::max(summary.maxTime,entry.time);
+        }
+
+        // Order the routines by their average communication time
+        std::vector<std::pair<double,std::string>> routineTimes;
+        for( const auto& pair : summaries )
+        {
+            double time = 0;
+            for( const auto& entryPair : pair.second )
+                time += entryPair.second.totalTime;
+            routineTimes.push_back( std::make_pair(time/commSize,pair.first) );
+        }
+        std::sort( routineTimes.rbegin(), routineTimes.rend() );
+
+        os << "Communication trace over " << commSize << " processes\n"
+           << "(calls and bytes are summed over processes, times are in "
+           << "seconds)\n";
+        for( const auto& routinePair : routineTimes )
+        {
+            os << "\n" << routinePair.second << ": average time "
+               << routinePair.first << "\n"
+               << "  wrapper\tcomm\tcalls\tbytes sent\tbytes recv"
+               << "\tavg time\tmax time\n";
+            for( const auto& entryPair : summaries[routinePair.second] )
+            {
+                const Summary& summary = entryPair.second;
+                os << "  " << entryPair.first << '\t' << summary.numCalls
+                   << '\t' << summary.bytesSent << '\t' << summary.bytesRecv
+                   << '\t' << summary.totalTime/commSize
+                   << '\t' << summary.maxTime << '\n';
+            }
+        }
+        os.flush();
+    }
+    tracing = wasTracing;
+}
+
+void FinalizeTrace()
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FinalizeTrace"))
+    if( !tracingWasEnabled )
+        return;
+    tracing = false;
+    if( traceFile.empty() )
+        PrintTrace( std::cout );
+    else
+    {
+        // Only the root opens the file, but every process takes part in the
+        // gathers within PrintTrace, so the root's success must be shared
+        // before anyone can give up
+        std::ofstream file;
+        int opened = 1;
+        if( Rank(COMM_WORLD) == 0 )
+        {
+            file.open( traceFile.c_str() );
+            opened = file.is_open();
+        }
+        Broadcast( opened, 0, COMM_WORLD );
+        if( opened )
+            PrintTrace( file );
+        else
+        {
+            traceEntries.clear();
+            traceRoutines.clear();
+            tracingWasEnabled = false;
+            RuntimeError("Could not open ",traceFile);
+        }
+    }
+    traceEntries.clear();
+    traceRoutines.clear();
+    tracingWasEnabled = false;
+}
+
 // Cartesian communicator routines 
 // ===============================
 
@@ -355,6 +630,7 @@ void Translate
 void Barrier( Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Barrier"))
+    EL_TRACE_COMM("Barrier",comm,0,0)
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -372,6 +648,7 @@ bool Test( Request& request )
 void Wait( Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Wait"))
+    EL_TRACE_COMM("Wait",COMM_NULL,0,0)
     Status status;
     SafeMpi( MPI_Wait( &request, &status ) );
 }
@@ -380,6 +657,7 @@ void Wait( Request& request )
 void Wait( Request& request, Status& status )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Wait"))
+    EL_TRACE_COMM("Wait",COMM_NULL,0,0)
     SafeMpi( MPI_Wait( &request, &status ) );
 }
 
@@ -387,6 +665,7 @@ void Wait( Request& request, Status& status )
 void WaitAll( int numRequests, Request* requests )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::WaitAll"))
+    EL_TRACE_COMM("WaitAll",COMM_NULL,0,0)
     std::vector<Status> statuses( numRequests );
     SafeMpi( MPI_Waitall( numRequests, requests, statuses.data() ) );
 }
@@ -395,6 +674,7 @@ void WaitAll( int numRequests, Request* requests )
 void WaitAll( int numRequests, Request* requests, Status* statuses )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::WaitAll"))
+    EL_TRACE_COMM("WaitAll",COMM_NULL,0,0)
     SafeMpi( MPI_Waitall( numRequests, requests, statuses ) );
 }
 
@@ -431,10 +711,187 @@ template int GetCount<double>( Status& status );
 template int GetCount<Complex<float>>( Status& status );
 template int GetCount<Complex<double>>( Status& status );
 
+// Parallel file I/O
+// =================
+
+void FileOpen
+( Comm comm, const std::string& filename, bool write, File& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileOpen"))
+    const int mode = 
+        ( write ? MPI_MODE_CREATE | MPI_MODE_WRONLY : MPI_MODE_RDONLY );
+    const int error = 
+        MPI_File_open
+        ( comm.comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL,
+          &file.file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+}
+
+void FileClose( File& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileClose"))
+    SafeMpi( MPI_File_close( &file.file ) );
+}
+
+Offset FileSize( File file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileSize"))
+    Offset numBytes;
+    SafeMpi( MPI_File_get_size( file.file, &numBytes ) );
+    return numBytes;
+}
+
+void FileSetSize( File file, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileSetSize"))
+    SafeMpi( MPI_File_set_size( file.file, numBytes ) );
+}
+
+template<typename T>
+void FileReadAt( File file, Offset offset, T* buf, int count )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAt"))
+    Status status;
+    SafeMpi
+    ( MPI_File_read_at
+      ( file.file, offset, buf, count*sizeof(T), MPI_BYTE, &status ) );
+}
+
+template<typename T>
+void FileWriteAt( File file, Offset offset, const T* buf, int count )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAt"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_at
+      ( file.file, offset, const_cast<T*>(buf), count*sizeof(T), MPI_BYTE, 
+        &status ) );
+}
+
+namespace {
+
+// Set the view of the file to the strided entries of the local matrix and
+// build the datatype describing the local buffer. Both are built from an
+// opaque entry type so that no conversion is performed on the data.
+template<typename T>
+void StridedView
+( File file, Offset offset, Int height, 
+  Int localHeight, Int colShift, Int colStride,
+  Int localWidth,  Int rowShift, Int rowStride, Int ldim,
+  Datatype& entryType, Datatype& memType, int& count )
+{
+    SafeMpi( MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType ) );
+    SafeMpi( MPI_Type_commit( &entryType ) );
+    if( localHeight == 0 || localWidth == 0 )
+    {
+        SafeMpi
+        ( MPI_File_set_view
+          ( file.file, offset, entryType, entryType, 
+            const_cast<char*>("native"), MPI_INFO_NULL ) );
+        memType = entryType;
+        count = 0;
+        return;
+    }
+
+    Datatype colType, fileType;
+    SafeMpi
+    ( MPI_Type_vector( localHeight, 1, colStride, entryType, &colType ) );
+    SafeMpi
+    ( MPI_Type_create_hvector
+      ( localWidth, 1, Aint(rowStride)*height*sizeof(T), colType, 
+        &fileType ) );
+    SafeMpi( MPI_Type_commit( &fileType ) );
+    const Offset disp = offset + (colShift+Offset(rowShift)*height)*sizeof(T);
+    SafeMpi
+    ( MPI_File_set_view
+      ( file.file, disp, entryType, fileType, const_cast<char*>("native"), 
+        MPI_INFO_NULL ) );
+    SafeMpi( MPI_Type_free( &fileType ) );
+    SafeMpi( MPI_Type_free( &colType ) );
+
+    SafeMpi
+    ( MPI_Type_vector( localWidth, localHeight, ldim, entryType, &memType ) );
+    SafeMpi( MPI_Type_commit( &memType ) );
+    count = 1;
+}
+
+// Return to the default view of the file as a sequence of bytes and free
+// the datatypes built by StridedView
+void ResetView( File file, Datatype& entryType, Datatype& memType )
+{
+    SafeMpi
+    ( MPI_File_set_view
+      ( file.file, 0, MPI_BYTE, MPI_BYTE, const_cast<char*>("native"),
+        MPI_INFO_NULL ) );
+    if( memType != entryType )
+        SafeMpi( MPI_Type_free( &memType ) );
+    SafeMpi( MPI_Type_free( &entryType ) );
+}
+
+} // anonymous namespace
+
+template<typename T>
+void FileReadAll
+( File file, Offset offset, Int height,
+  Int localHeight, Int colShift, Int colStride,
+  Int localWidth,  Int rowShift, Int rowStride, T* buf, Int ldim )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAll"))
+    Datatype entryType, memType;
+    int count;
+    StridedView<T>
+    ( file, offset, height, localHeight, colShift, colStride, 
+      localWidth, rowShift, rowStride, ldim, entryType, memType, count );
+    Status status;
+    SafeMpi( MPI_File_read_all( file.file, buf, count, memType, &status ) );
+    ResetView( file, entryType, memType );
+}
+
+template<typename T>
+void FileWriteAll
+( File file, Offset offset, Int height,
+  Int localHeight, Int colShift, Int colStride,
+  Int localWidth,  Int rowShift, Int rowStride, const T* buf, Int ldim )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAll"))
+    Datatype entryType, memType;
+    int count;
+    StridedView<T>
+    ( file, offset, height, localHeight, colShift, colStride, 
+      localWidth, rowShift, rowStride, ldim, entryType, memType, count );
+    Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( file.file, const_cast<T*>(buf), count, memType, &status ) );
+    ResetView( file, entryType, memType );
+}
+
+#define PROTO_FILE(T) \
+  template void FileReadAt( File file, Offset offset, T* buf, int count ); \
+  template void FileWriteAt \
+  ( File file, Offset offset, const T* buf, int count ); \
+  template void FileReadAll \
+  ( File file, Offset offset, Int height, \
+    Int localHeight, Int colShift, Int colStride, \
+    Int localWidth,  Int rowShift, Int rowStride, T* buf, Int ldim ); \
+  template void FileWriteAll \
+  ( File file, Offset offset, Int height, \
+    Int localHeight, Int colShift, Int colStride, \
+    Int localWidth,  Int rowShift, Int rowStride, const T* buf, Int ldim );
+PROTO_FILE(byte)
+PROTO_FILE(Int)
+PROTO_FILE(float)
+PROTO_FILE(double)
+PROTO_FILE(Complex<float>)
+PROTO_FILE(Complex<double>)
+#undef PROTO_FILE
+
 template<typename R>
 void TaggedSend( const R* buf, int count, int to, int tag, Comm comm )
 { 
     DEBUG_ONLY(CallStackEntry cse("mpi::Send"))
+    EL_TRACE_COMM("Send",comm,Bytes<R>(count),0)
     SafeMpi( 
         MPI_Send( const_cast<R*>(buf), count, TypeMap<R>(), to, tag, comm.comm )
     );
@@ -444,6 +901,7 @@ template<typename R>
 void TaggedSend( const Complex<R>* buf, int count, int to, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Send"))
+    EL_TRACE_COMM("Send",comm,Bytes<Complex<R>>(count),0)
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -530,6 +988,7 @@ void TaggedISend
 ( const R* buf, int count, int to, int tag, Comm comm, Request& request )
 { 
     DEBUG_ONLY(CallStackEntry cse("mpi::ISend"))
+    EL_TRACE_COMM("ISend",comm,Bytes<R>(count),0)
     SafeMpi
     ( MPI_Isend
       ( const_cast<R*>(buf), count, TypeMap<R>(), to, 
@@ -542,6 +1001,7 @@ void TaggedISend
   Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISend"))
+    EL_TRACE_COMM("ISend",comm,Bytes<Complex<R>>(count),0)
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -629,6 +1089,7 @@ void TaggedISSend
 ( const R* buf, int count, int to, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISSend"))
+    EL_TRACE_COMM("ISSend",comm,Bytes<R>(count),0)
     SafeMpi
     ( MPI_Issend
       ( const_cast<R*>(buf), count, TypeMap<R>(), to, 
@@ -641,6 +1102,7 @@ void TaggedISSend
   Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISSend"))
+    EL_TRACE_COMM("ISSend",comm,Bytes<Complex<R>>(count),0)
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -708,6 +1170,7 @@ template<typename R>
 void TaggedRecv( R* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Recv"))
+    EL_TRACE_COMM("Recv",comm,0,Bytes<R>(count))
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<R>(), from, tag, comm.comm, &status ) );
@@ -717,6 +1180,7 @@ template<typename R>
 void TaggedRecv( Complex<R>* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Recv"))
+    EL_TRACE_COMM("Recv",comm,0,Bytes<Complex<R>>(count))
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -801,6 +1265,7 @@ void TaggedIRecv
 ( R* buf, int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IRecv"))
+    EL_TRACE_COMM("IRecv",comm,0,Bytes<R>(count))
     SafeMpi
     ( MPI_Irecv( buf, count, TypeMap<R>(), from, tag, comm.comm, &request ) );
 }
@@ -810,6 +1275,7 @@ void TaggedIRecv
 ( Complex<R>* buf, int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IRecv"))
+    EL_TRACE_COMM("IRecv",comm,0,Bytes<Complex<R>>(count))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv( buf, 2*count, TypeMap<R>(), from, tag, comm.comm, &request ) );
@@ -894,6 +1360,7 @@ void TaggedSendRecv
         R* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    EL_TRACE_COMM("SendRecv",comm,Bytes<R>(sc),Bytes<R>(rc))
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -908,6 +1375,7 @@ void TaggedSendRecv
         Complex<R>* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    EL_TRACE_COMM("SendRecv",comm,Bytes<Complex<R>>(sc),Bytes<Complex<R>>(rc))
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1061,6 +1529,7 @@ void TaggedSendRecv
 ( R* buf, int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    EL_TRACE_COMM("SendRecv",comm,Bytes<R>(count),Bytes<R>(count))
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1072,6 +1541,10 @@ void TaggedSendRecv
 ( Complex<R>* buf, int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    EL_TRACE_COMM
+    ( "SendRecv", comm,
+      Bytes<Complex<R>>(count),
+      Bytes<Complex<R>>(count) )
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1146,6 +1619,10 @@ template<typename R>
 void Broadcast( R* buf, int count, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Broadcast"))
+    EL_TRACE_COMM
+    ( "Broadcast", comm,
+      ( Rank(comm)==root ? Bytes<R>(count) : 0 ),
+      ( Rank(comm)==root ? 0 : Bytes<R>(count) ) )
     SafeMpi( MPI_Bcast( buf, count, TypeMap<R>(), root, comm.comm ) );
 }
 
@@ -1153,6 +1630,10 @@ template<typename R>
 void Broadcast( Complex<R>* buf, int count, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Broadcast"))
+    EL_TRACE_COMM
+    ( "Broadcast", comm,
+      ( Rank(comm)==root ? Bytes<Complex<R>>(count) : 0 ),
+      ( Rank(comm)==root ? 0 : Bytes<Complex<R>>(count) ) )
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<R>(), root, comm.comm ) );
 #else
@@ -1197,6 +1678,10 @@ template<typename R>
 void IBroadcast( R* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IBroadcast"))
+    EL_TRACE_COMM
+    ( "IBroadcast", comm,
+      ( Rank(comm)==root ? Bytes<R>(count) : 0 ),
+      ( Rank(comm)==root ? 0 : Bytes<R>(count) ) )
     SafeMpi
     ( MPI_Ibcast( buf, count, TypeMap<R>(), root, comm.comm, &request ) );
 }
@@ -1206,6 +1691,10 @@ void IBroadcast
 ( Complex<R>* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IBroadcast"))
+    EL_TRACE_COMM
+    ( "IBroadcast", comm,
+      ( Rank(comm)==root ? Bytes<Complex<R>>(count) : 0 ),
+      ( Rank(comm)==root ? 0 : Bytes<Complex<R>>(count) ) )
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Ibcast( buf, 2*count, TypeMap<R>(), root, comm.comm, &request ) );
@@ -1255,6 +1744,10 @@ void Gather
         R* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    EL_TRACE_COMM
+    ( "Gather", comm,
+      Bytes<R>(sc),
+      ( Rank(comm)==root ? Bytes<R>(rc*Size(comm)) : 0 ) )
     SafeMpi
     ( MPI_Gather
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1267,6 +1760,10 @@ void Gather
         Complex<R>* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    EL_TRACE_COMM
+    ( "Gather", comm,
+      Bytes<Complex<R>>(sc),
+      ( Rank(comm)==root ? Bytes<Complex<R>>(rc*Size(comm)) : 0 ) )
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1302,6 +1799,10 @@ void IGather
         R* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IGather"))
+    EL_TRACE_COMM
+    ( "IGather", comm,
+      Bytes<R>(sc),
+      ( Rank(comm)==root ? Bytes<R>(rc*Size(comm)) : 0 ) )
     SafeMpi
     ( MPI_Igather
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1314,6 +1815,10 @@ void IGather
         Complex<R>* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IGather"))
+    EL_TRACE_COMM
+    ( "IGather", comm,
+      Bytes<Complex<R>>(sc),
+      ( Rank(comm)==root ? Bytes<Complex<R>>(rc*Size(comm)) : 0 ) )
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Igather
@@ -1372,6 +1877,10 @@ void Gather
         R* rbuf, const int* rcs, const int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    EL_TRACE_COMM
+    ( "Gather", comm,
+      Bytes<R>(sc),
+      ( Rank(comm)==root ? Bytes<R>(rcs,Size(comm)) : 0 ) )
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<R*>(sbuf), 
@@ -1391,6 +1900,10 @@ void Gather
         Complex<R>* rbuf, const int* rcs, const int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    EL_TRACE_COMM
+    ( "Gather", comm,
+      Bytes<Complex<R>>(sc),
+      ( Rank(comm)==root ? Bytes<Complex<R>>(rcs,Size(comm)) : 0 ) )
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1469,6 +1982,7 @@ void AllGather
         R* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    EL_TRACE_COMM("AllGather",comm,Bytes<R>(sc),Bytes<R>(rc*Size(comm)))
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1489,6 +2003,10 @@ void AllGather
         Complex<R>* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    EL_TRACE_COMM
+    ( "AllGather", comm,
+      Bytes<Complex<R>>(sc),
+      Bytes<Complex<R>>(rc*Size(comm)) )
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1530,6 +2048,7 @@ void AllGather
         R* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    EL_TRACE_COMM("AllGather",comm,Bytes<R>(sc),Bytes<R>(rcs,Size(comm)))
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1563,6 +2082,10 @@ void AllGather
         Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    EL_TRACE_COMM
+    ( "AllGather", comm,
+      Bytes<Complex<R>>(sc),
+      Bytes<Complex<R>>(rcs,Size(comm)) )
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1646,6 +2169,10 @@ void Scatter
         R* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    EL_TRACE_COMM
+    ( "Scatter", comm,
+      ( Rank(comm)==root ? Bytes<R>(sc*Size(comm)) : 0 ),
+      Bytes<R>(rc) )
     SafeMpi
     ( MPI_Scatter
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1658,6 +2185,10 @@ void Scatter
         Complex<R>* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    EL_TRACE_COMM
+    ( "Scatter", comm,
+      ( Rank(comm)==root ? Bytes<Complex<R>>(sc*Size(comm)) : 0 ),
+      Bytes<Complex<R>>(rc) )
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1712,6 +2243,10 @@ template<typename R>
 void Scatter( R* buf, int sc, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    EL_TRACE_COMM
+    ( "Scatter", comm,
+      ( Rank(comm)==root ? Bytes<R>(sc*Size(comm)) : 0 ),
+      Bytes<R>(rc) )
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1743,6 +2278,10 @@ template<typename R>
 void Scatter( Complex<R>* buf, int sc, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    EL_TRACE_COMM
+    ( "Scatter", comm,
+      ( Rank(comm)==root ? Bytes<Complex<R>>(sc*Size(comm)) : 0 ),
+      Bytes<Complex<R>>(rc) )
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1814,6 +2353,10 @@ void AllToAll
         R* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    EL_TRACE_COMM
+    ( "AllToAll", comm,
+      Bytes<R>(sc*Size(comm)),
+      Bytes<R>(rc*Size(comm)) )
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1826,6 +2369,10 @@ void AllToAll
         Complex<R>* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    EL_TRACE_COMM
+    ( "AllToAll", comm,
+      Bytes<Complex<R>>(sc*Size(comm)),
+      Bytes<Complex<R>>(rc*Size(comm)) )
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1881,6 +2428,10 @@ void AllToAll
         R* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    EL_TRACE_COMM
+    ( "AllToAll", comm,
+      Bytes<R>(scs,Size(comm)),
+      Bytes<R>(rcs,Size(comm)) )
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<R*>(sbuf), 
@@ -1900,6 +2451,10 @@ void AllToAll
         Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    EL_TRACE_COMM
+    ( "AllToAll", comm,
+      Bytes<Complex<R>>(scs,Size(comm)),
+      Bytes<Complex<R>>(rcs,Size(comm)) )
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1976,6 +2531,10 @@ void Reduce
 ( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    EL_TRACE_COMM
+    ( "Reduce", comm,
+      Bytes<T>(count),
+      ( Rank(comm)==root ? Bytes<T>(count) : 0 ) )
     if( count != 0 )
     {
         SafeMpi
@@ -1991,6 +2550,10 @@ void Reduce
         Complex<R>* rbuf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    EL_TRACE_COMM
+    ( "Reduce", comm,
+      Bytes<Complex<R>>(count),
+      ( Rank(comm)==root ? Bytes<Complex<R>>(count) : 0 ) )
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2121,6 +2684,10 @@ template<typename T>
 void Reduce( T* buf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    EL_TRACE_COMM
+    ( "Reduce", comm,
+      Bytes<T>(count),
+      ( Rank(comm)==root ? Bytes<T>(count) : 0 ) )
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2151,6 +2718,10 @@ template<typename R>
 void Reduce( Complex<R>* buf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    EL_TRACE_COMM
+    ( "Reduce", comm,
+      Bytes<Complex<R>>(count),
+      ( Rank(comm)==root ? Bytes<Complex<R>>(count) : 0 ) )
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2276,6 +2847,7 @@ template<typename T>
 void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    EL_TRACE_COMM("AllReduce",comm,Bytes<T>(count),Bytes<T>(count))
     if( count != 0 )
     {
         SafeMpi
@@ -2290,6 +2862,10 @@ void AllReduce
 ( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    EL_TRACE_COMM
+    ( "AllReduce", comm,
+      Bytes<Complex<R>>(count),
+      Bytes<Complex<R>>(count) )
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2412,6 +2988,7 @@ template<typename T>
 void AllReduce( T* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    EL_TRACE_COMM("AllReduce",comm,Bytes<T>(count),Bytes<T>(count))
     if( count != 0 )
     {
 #ifdef EL_HAVE_MPI_IN_PLACE
@@ -2432,6 +3009,10 @@ template<typename R>
 void AllReduce( Complex<R>* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    EL_TRACE_COMM
+    ( "AllReduce", comm,
+      Bytes<Complex<R>>(count),
+      Bytes<Complex<R>>(count) )
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2532,6 +3113,7 @@ template<typename R>
 void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    EL_TRACE_COMM("ReduceScatter",comm,Bytes<R>(rc*Size(comm)),Bytes<R>(rc))
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2553,6 +3135,10 @@ void ReduceScatter
 ( Complex<R>* sbuf, Complex<R>* rbuf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    EL_TRACE_COMM
+    ( "ReduceScatter", comm,
+      Bytes<Complex<R>>(rc*Size(comm)),
+      Bytes<Complex<R>>(rc) )
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2647,6 +3233,7 @@ template<typename R>
 void ReduceScatter( R* buf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    EL_TRACE_COMM("ReduceScatter",comm,Bytes<R>(rc*Size(comm)),Bytes<R>(rc))
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2678,6 +3265,10 @@ template<typename R>
 void ReduceScatter( Complex<R>* buf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    EL_TRACE_COMM
+    ( "ReduceScatter", comm,
+      Bytes<Complex<R>>(rc*Size(comm)),
+      Bytes<Complex<R>>(rc) )
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2756,6 +3347,10 @@ void ReduceScatter
 ( const R* sbuf, R* rbuf, const int* rcs, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    EL_TRACE_COMM
+    ( "ReduceScatter", comm,
+      Bytes<R>(rcs,Size(comm)),
+      Bytes<R>(rcs[Rank(comm)]) )
     SafeMpi
     ( MPI_Reduce_scatter
       ( const_cast<R*>(sbuf), 
@@ -2767,6 +3362,10 @@ void ReduceScatter
 ( const Complex<R>* sbuf, Complex<R>* rbuf, const int* rcs, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    EL_TRACE_COMM
+    ( "ReduceScatter", comm,
+      Bytes<Complex<R>>(rcs,Size(comm)),
+      Bytes<Complex<R>>(rcs[Rank(comm)]) )
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -7,12 +7,20 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#ifdef EL_HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
 
+#include "./Text.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
+#include "./Read/Sharded.hpp"
 
 namespace El {
 
@@ -54,14 +62,25 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename ); 
 
-    if( U == A.UGath && V == A.VGath )
+    if( format == BINARY_SHARDED )
+        read::Sharded( A, filename );
+    else if( U == A.UGath && V == A.VGath )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
             Read( A.Matrix(), filename, format );
             A.Resize( A.Matrix().Height(), A.Matrix().Width() );
         }
+        // MakeSizeConsistent only broadcasts over the cross communicator,
+        // so the redundant copies must first be sent the new dimensions
+        if( A.CrossRank() == A.Root() )
+        {
+            Int dims[2] = { A.Height(), A.Width() };
+            mpi::Broadcast( dims, 2, 0, A.RedundantComm() );
+            A.Resize( dims[0], dims[1] );
+        }
         A.MakeSizeConsistent();
+        A.BroadcastOver( A.RedundantComm(), 0 );
     }
     else if( sequential )
     {
@@ -118,7 +137,16 @@ void Read
             Read( A.Matrix(), filename, format );
             A.Resize( A.Matrix().Height(), A.Matrix().Width() );
         }
+        // MakeSizeConsistent only broadcasts over the cross communicator,
+        // so the redundant copies must first be sent the new dimensions
+        if( A.CrossRank() == A.Root() )
+        {
+            Int dims[2] = { A.Height(), A.Width() };
+            mpi::Broadcast( dims, 2, 0, A.RedundantComm() );
+            A.Resize( dims[0], dims[1] );
+        }
         A.MakeSizeConsistent();
+        A.BroadcastOver( A.RedundantComm(), 0 );
     }
     else if( sequential )
     {
@@ -159,6 +187,27 @@ void Read
     }
 }
 
+template<typename T>
+MappedMatrix<T>::MappedMatrix( const std::string filename )
+: mapping_(nullptr), mappingSize_(0)
+{
+    DEBUG_ONLY(CallStackEntry cse("MappedMatrix::MappedMatrix"))
+#ifdef EL_HAVE_MMAP
+    read::MappedBinary( A_, filename, mapping_, mappingSize_ );
+#else
+    read::Binary( A_, filename );
+#endif
+}
+
+template<typename T>
+MappedMatrix<T>::~MappedMatrix()
+{
+#ifdef EL_HAVE_MMAP
+    if( mapping_ != nullptr )
+        munmap( mapping_, mappingSize_ );
+#endif
+}
+
 template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, const std::string filename, FileFormat format,
@@ -196,6 +245,7 @@ void Read
     bool sequential );
 
 #define PROTO(T) \
+  template class MappedMatrix<T>; \
   template void Read \
   ( Matrix<T>& A, const std::string filename, FileFormat format ); \
   template void Read \
@@ -18,95 +18,19 @@ inline void
 Ascii( Matrix<T>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::Ascii"))
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
-    Int height=0, width=0;
-    std::string line;
-    while( std::getline( file, line ) )
-    {
-        std::stringstream lineStream( line );
-        Int numCols=0;
-        T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
-        {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
-        }
-    }
-    file.clear();
-    file.seekg(0,file.beg);
-
-    // Resize the matrix and then read it
-    A.Resize( height, width );
-    Int i=0;
-    while( std::getline( file, line ) )
-    {
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
-    }
+    text::ReadRows( A, filename, 0, text::FileSize(filename) );
 }
 
+// Each process parses a contiguous share of the lines of the file, and each
+// row is then sent directly to its owner in a [VC,STAR] distribution
 template<typename T,Dist U,Dist V>
 inline void
 Ascii( DistMatrix<T,U,V>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::Ascii"))
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    // Walk through the file once to both count the number of rows and
-    // columns and to ensure that the number of columns is consistent
-    Int height=0, width=0;
-    std::string line;
-    while( std::getline( file, line ) )
-    {
-        std::stringstream lineStream( line );
-        Int numCols=0;
-        T value;
-        while( lineStream >> value ) ++numCols;
-        if( numCols != 0 )
-        {
-            if( numCols != width && width != 0 )
-                LogicError("Inconsistent number of columns");
-            else
-                width = numCols;
-            ++height;
-        }
-    }
-    file.clear();
-    file.seekg(0,file.beg);
-
-    // Resize the matrix and then read in our local portion
-    A.Resize( height, width );
-    Int i=0;
-    while( std::getline( file, line ) )
-    {
-        std::stringstream lineStream( line );
-        Int j=0;
-        T value;
-        while( lineStream >> value )
-        {
-            A.Set( i, j, value );
-            ++j;
-        }
-        ++i;
-    }
+    DistMatrix<T,VC,STAR> A_VC_STAR( A.Grid() );
+    text::ReadRows( A_VC_STAR, filename, 0, text::FileSize(filename) );
+    A = A_VC_STAR;
 }
 
 template<typename T,Dist U,Dist V>
@@ -13,15 +13,30 @@
 namespace El {
 namespace read {
 
+// The entries lie between the first '[' and the last ']' of the file, with
+// each row of the matrix on its own line
+inline void
+MatlabBody
+( const std::string filename, std::streamoff& begin, std::streamoff& end )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MatlabBody"))
+    const std::streamoff numBytes = text::FileSize( filename );
+    begin = text::Find( filename, '[', 0, numBytes );
+    end = -1;
+    if( begin >= 0 )
+        end = text::Find( filename, ']', begin, numBytes, true );
+}
+
 template<typename T>
 inline void
 AsciiMatlab( Matrix<T>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::AsciiMatlab"))
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-    LogicError("Not yet written");
+    std::streamoff begin, end;
+    MatlabBody( filename, begin, end );
+    if( end < 0 )
+        RuntimeError("Could not find the brackets in ",filename);
+    text::ReadRows( A, filename, begin+1, end );
 }
 
 template<typename T,Dist U,Dist V>
@@ -29,10 +44,36 @@ inline void
 AsciiMatlab( DistMatrix<T,U,V>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::AsciiMatlab"))
-    std::ifstream file( filename.c_str() );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-    LogicError("Not yet written");
+    mpi::Comm comm = A.Grid().ViewingComm();
+
+    // The root locates the brackets, and a range beginning at -2 signals
+    // that the file could not be read
+    long long range[2];
+    std::string bodyError;
+    if( mpi::Rank(comm) == 0 )
+    {
+        try
+        {
+            std::streamoff begin, end;
+            MatlabBody( filename, begin, end );
+            range[0] = begin;
+            range[1] = end;
+        }
+        catch( std::exception& e )
+        {
+            range[0] = range[1] = -2;
+            bodyError = e.what();
+        }
+    }
+    mpi::Broadcast( range, 2, 0, comm );
+    if( range[0] == -2 )
+        RuntimeError("Could not read ",filename," ",bodyError);
+    if( range[1] < 0 )
+        RuntimeError("Could not find the brackets in ",filename);
+
+    DistMatrix<T,VC,STAR> A_VC_STAR( A.Grid() );
+    text::ReadRows( A_VC_STAR, filename, range[0]+1, range[1] );
+    A = A_VC_STAR;
 }
 
 template<typename T,Dist U,Dist V>
@@ -41,68 +41,91 @@ Binary( Matrix<T>& A, const std::string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// Every process collectively reads its local entries (and those of the
+// processes it redundantly stores) directly from the file with MPI-IO
 template<typename T,Dist U,Dist V>
 inline void
 Binary( DistMatrix<T,U,V>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, false, file );
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    Int dims[2];
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileReadAt( file, 0, dims, 2 );
+    mpi::Broadcast( dims, 2, 0, comm );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const mpi::Offset numBytes = mpi::FileSize( file );
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset dataBytes = mpi::Offset(height)*width*sizeof(T);
+    const mpi::Offset numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    if( U == A.UGath && V == A.VGath )
+    mpi::FileReadAll
+    ( file, metaBytes, height, 
+      A.LocalHeight(), A.ColShift(), A.ColStride(), 
+      A.LocalWidth(),  A.RowShift(), A.RowStride(), A.Buffer(), A.LDim() );
+    mpi::FileClose( file );
+}
+
+#ifdef EL_HAVE_MMAP
+// Map the entire file into memory and attach A to the entries which follow
+// its two-Int header
+template<typename T>
+inline void
+MappedBinary
+( Matrix<T>& A, const std::string filename, 
+  void*& mapping, std::size_t& mappingSize )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MappedBinary"))
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd == -1 )
+        RuntimeError("Could not open ",filename);
+
+    Int height=0, width=0;
+    struct stat fileStat;
+    const bool readMeta = 
+        fstat( fd, &fileStat ) == 0 &&
+        pread( fd, &height, sizeof(Int), 0 ) == sizeof(Int) &&
+        pread( fd, &width, sizeof(Int), sizeof(Int) ) == sizeof(Int);
+    if( !readMeta )
     {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
+        close( fd );
+        RuntimeError("Could not read the header of ",filename);
     }
-    else if( U == A.UGath )
+    const std::size_t numBytes = fileStat.st_size;
+    const std::size_t metaBytes = 2*sizeof(Int);
+    const std::size_t numBytesExp = 
+        metaBytes + std::size_t(height)*width*sizeof(T);
+    if( numBytes != numBytesExp )
     {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
+        close( fd );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
     }
-    else
+
+    // The mapping remains valid after the file descriptor is closed
+    mapping = mmap( nullptr, numBytes, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( mapping == MAP_FAILED )
     {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
+        mapping = nullptr;
+        RuntimeError("Could not map ",filename);
     }
+    mappingSize = numBytes;
+    const T* buffer = (const T*)((const char*)mapping + metaBytes);
+    A.LockedAttach( height, width, buffer, Max(height,1) );
 }
+#endif // ifdef EL_HAVE_MMAP
 
 template<typename T,Dist U,Dist V>
 inline void
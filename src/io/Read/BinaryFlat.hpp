@@ -36,63 +36,32 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const std::string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
+// As in read::Binary, but the dimensions must be provided
 template<typename T,Dist U,Dist V>
 inline void
 BinaryFlat
 ( DistMatrix<T,U,V>& A, Int height, Int width, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, false, file );
 
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
+    const mpi::Offset numBytes = mpi::FileSize( file );
+    const mpi::Offset numBytesExp = mpi::Offset(height)*width*sizeof(T);
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    if( U == A.UGath && V == A.VGath )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( U == A.UGath )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    mpi::FileReadAll
+    ( file, 0, height, 
+      A.LocalHeight(), A.ColShift(), A.ColStride(), 
+      A.LocalWidth(),  A.RowShift(), A.RowStride(), A.Buffer(), A.LDim() );
+    mpi::FileClose( file );
 }
 
 template<typename T,Dist U,Dist V>
@@ -13,13 +13,20 @@
 namespace El {
 namespace read {
 
-template<typename T>
-inline void
-MatrixMarket( Matrix<T>& A, const std::string filename )
+struct MatrixMarketHeader
 {
-    DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
-    typedef Base<T> Real;
-    std::ifstream file( filename.c_str() );
+    bool isMatrix, isArray, isComplex, isPattern;
+    bool isSymmetric, isSkewSymmetric, isHermitian;
+    Int m, n, numNonzero;
+    // The position of the first byte following the size line
+    long long dataBegin;
+};
+
+inline MatrixMarketHeader
+ReadMatrixMarketHeader( const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::ReadMatrixMarketHeader"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
@@ -46,34 +53,36 @@ MatrixMarket( Matrix<T>& A, const std::string filename )
     }
     // Ensure that the header components are individually valid
     // --------------------------------------------------------
-    const bool isMatrix = ( object == std::string("matrix") );
-    const bool isArray = ( format == std::string("array") );
-    const bool isComplex = ( field == std::string("complex") );
-    const bool isPattern = ( field == std::string("pattern") );
+    MatrixMarketHeader header;
+    header.isMatrix = ( object == std::string("matrix") );
+    header.isArray = ( format == std::string("array") );
+    header.isComplex = ( field == std::string("complex") );
+    header.isPattern = ( field == std::string("pattern") );
     const bool isGeneral = ( symmetry == std::string("general") );
-    const bool isSymmetric = ( symmetry == std::string("symmetric") );
-    const bool isSkewSymmetric = ( symmetry == std::string("skew-symmetric") );
-    const bool isHermitian = ( symmetry == std::string("hermitian") );
-    if( !isMatrix && object != std::string("vector") )
+    header.isSymmetric = ( symmetry == std::string("symmetric") );
+    header.isSkewSymmetric = ( symmetry == std::string("skew-symmetric") );
+    header.isHermitian = ( symmetry == std::string("hermitian") );
+    if( !header.isMatrix && object != std::string("vector") )
         RuntimeError("Invalid Matrix Market object: ",object);
-    if( !isArray && format != std::string("coordinate") )
+    if( !header.isArray && format != std::string("coordinate") )
         RuntimeError("Invalid Matrix Market format: ",format);
-    if( !isComplex && !isPattern && 
+    if( !header.isComplex && !header.isPattern && 
         field != std::string("real") && 
         field != std::string("double") &&
         field != std::string("integer") )
         RuntimeError("Invalid Matrix Market field: ",field);
-    if( !isGeneral && !isSymmetric && !isSkewSymmetric && !isHermitian )
+    if( !isGeneral && !header.isSymmetric && !header.isSkewSymmetric && 
+        !header.isHermitian )
         RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
     // Ensure that the components are consistent
     // -----------------------------------------
-    if( isArray && isPattern )
+    if( header.isArray && header.isPattern )
         RuntimeError("Pattern field requires coordinate format");
     // NOTE: This constraint is only enforced because of the note located at
     //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
-    if( isSkewSymmetric && isPattern )
+    if( header.isSkewSymmetric && header.isPattern )
         RuntimeError("Pattern field incompatible with skew-symmetry");
-    if( isHermitian && !isComplex )
+    if( header.isHermitian && !header.isComplex )
         RuntimeError("Hermitian symmetry requires complex data");
 
     // Skip the comment lines
@@ -81,157 +90,244 @@ MatrixMarket( Matrix<T>& A, const std::string filename )
     while( file.peek() == '%' ) 
         std::getline( file, line );
   
-    int m, n;
+    // Read in the dimensions (and number of nonzeros)
+    // ===============================================
     if( !std::getline( file, line ) )
         RuntimeError("Could not extract the size line");
-    if( isArray )
-    {
-        // Read in the matrix dimensions
-        // =============================
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-        }
+    std::stringstream lineStream( line );
+    if( !(lineStream >> header.m) )
+        RuntimeError("Missing height: ",line);
+    header.n = 1;
+    if( header.isMatrix && !(lineStream >> header.n) )
+        RuntimeError("Missing matrix width: ",line);
+    header.numNonzero = header.m*header.n;
+    if( !header.isArray && !(lineStream >> header.numNonzero) )
+        RuntimeError("Missing nonzeros entry: ",line);
+    header.dataBegin = file.tellg();
+    if( header.dataBegin < 0 )
+        header.dataBegin = text::FileSize( filename );
+    return header;
+}
 
-        // Resize the matrix
-        // =================
-        Zeros( A, m, n );
+template<typename T,class MatrixType>
+inline void
+SymmetrizeMatrixMarket( const MatrixMarketHeader& header, MatrixType& A )
+{
+    if( header.isSymmetric )
+        MakeSymmetric( LOWER, A );
+    if( header.isHermitian )
+        MakeHermitian( LOWER, A );
+    // I'm not certain of what the MM standard is for complex skew-symmetry,
+    // so I'll default to assuming no conjugation
+    const bool conjugateSkew = false;
+    if( header.isSkewSymmetric )
+    {
+        MakeSymmetric( LOWER, A, conjugateSkew );
+        ScaleTrapezoid( T(-1), UPPER, A, 1 );
+    }
+}
 
-        // Now read in the data
-        // ====================
-        Real realPart, imagPart;
-        for( Int j=0; j<n; ++j )
+template<typename T>
+inline void
+MatrixMarket( Matrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
+    typedef Base<T> Real;
+    const MatrixMarketHeader header = ReadMatrixMarketHeader( filename );
+    if( header.isComplex && !IsComplex<T>::val )
+        LogicError("Cannot read complex Matrix Market data into real matrix");
+    const Int m = header.m;
+    const Int n = header.n;
+    std::vector<char> buffer;
+    text::ReadLines
+    ( filename, header.dataBegin, text::FileSize(filename), mpi::COMM_SELF,
+      buffer );
+    Zeros( A, m, n );
+    if( header.isArray )
+    {
+        // The entries are stored in column-major order, one per line, with
+        // their real and imaginary parts separated by whitespace
+        std::vector<Real> values;
+        Int numEntries;
+        const Int width = text::ParseRows( buffer, values, numEntries );
+        if( numEntries != m*n || 
+            (numEntries > 0 && width != (header.isComplex ? 2 : 1)) )
+            RuntimeError("Expected ",m*n," entries in ",filename);
+        for( Int k=0; k<numEntries; ++k )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                if( !std::getline( file, line ) )
-                    RuntimeError("Could not get entry (",i,",",j,")");
-                std::stringstream lineStream( line );
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.SetRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.SetImagPart( i, j, imagPart );
-                }
-            }
+            A.SetRealPart( k%m, k/m, values[k*width] );
+            if( header.isComplex )
+                A.SetImagPart( k%m, k/m, values[k*width+1] );
         }
     }
     else
     {
-        // Read in the matrix dimensions and number of nonzeros
-        // ====================================================
-        int numNonzero;
-        if( isMatrix )
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing matrix height: ",line);
-            if( !(lineStream >> n) )
-                RuntimeError("Missing matrix width: ",line);
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-        else
-        {
-            std::stringstream lineStream( line );
-            if( !(lineStream >> m) )
-                RuntimeError("Missing vector height: ",line);
-            n = 1;
-            if( !(lineStream >> numNonzero) )
-                RuntimeError("Missing nonzeros entry: ",line);
-        }
-
-        // Create a matrix of zeros
-        // ========================
-        Zeros( A, m, n );
-
-        // Fill in the nonzero entries
-        // ===========================
-        int i, j;
-        Real realPart, imagPart;
+        std::vector<Int> indices;
+        std::vector<T> values;
+        if( !text::ParseCoordinates
+             ( buffer, header.isMatrix, header.isPattern, header.isComplex,
+               indices, values ) )
+            RuntimeError("Invalid nonzero entry in ",filename);
+        const Int numNonzero = values.size();
+        if( numNonzero != header.numNonzero )
+            RuntimeError
+            ("Expected ",header.numNonzero," nonzeros but found ",numNonzero);
         for( Int k=0; k<numNonzero; ++k )
         {
-            if( !std::getline( file, line ) )
-                RuntimeError("Could not get nonzero ",k);
-            std::stringstream lineStream( line );
-            if( !(lineStream >> i) )
-                RuntimeError("Could not extract row coordinate of nonzero ",k);
-            --i; // convert from Fortran to C indexing
-            if( isMatrix )
-            {
-                if( !(lineStream >> j) )
-                    RuntimeError
-                    ("Could not extract col coordinate of nonzero ",k);
-                --j;
-            }
-            else
-                j = 0;
-
-            if( isPattern )
-            {
+            const Int i = indices[2*k];
+            const Int j = indices[2*k+1];
+            if( i >= m || j >= n )
+                RuntimeError("Nonzero (",i,",",j,") is out of bounds");
+            if( header.isPattern )
                 A.Set( i, j, T(1) );
-            }
             else
-            {
-                if( !(lineStream >> realPart) )
-                    RuntimeError
-                    ("Could not extract real part of entry (",i,",",j,")");
-                A.UpdateRealPart( i, j, realPart );
-                if( isComplex )
-                {
-                    if( !(lineStream >> imagPart) )
-                        RuntimeError
-                        ("Could not extract imag part of entry (",i,",",j,")");
-                    A.UpdateImagPart( i, j, imagPart );
-                }
-            }
+                A.Update( i, j, values[k] );
         }
     }
-
-    if( isSymmetric )
-        MakeSymmetric( LOWER, A );
-    if( isHermitian )
-        MakeHermitian( LOWER, A );
-    // I'm not certain of what the MM standard is for complex skew-symmetry,
-    // so I'll default to assuming no conjugation
-    const bool conjugateSkew = false;
-    if( isSkewSymmetric )
-    {
-        MakeSymmetric( LOWER, A, conjugateSkew );
-        ScaleTrapezoid( T(-1), UPPER, A, 1 );
-    }
+    SymmetrizeMatrixMarket<T>( header, A );
 }
 
+// Every process parses a contiguous share of the lines following the header
+// and sends each entry directly to its owner in a [VC,STAR] distribution
 template<typename T,Dist U,Dist V>
 inline void
 MatrixMarket( DistMatrix<T,U,V>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
-    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+    typedef Base<T> Real;
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.ViewingComm();
+
+    // The root parses and validates the header
+    MatrixMarketHeader header = MatrixMarketHeader();
+    Int info[10];
+    std::string headerError;
+    if( mpi::Rank(comm) == 0 )
     {
-        MatrixMarket( A_CIRC_CIRC.Matrix(), filename );
-        A_CIRC_CIRC.Resize
-        ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+        try 
+        { 
+            header = ReadMatrixMarketHeader( filename ); 
+            info[0] = 1;
+        }
+        catch( std::exception& e ) 
+        { 
+            info[0] = 0; 
+            headerError = e.what();
+        }
+        info[1] = header.isMatrix;
+        info[2] = header.isArray;
+        info[3] = header.isComplex;
+        info[4] = header.isPattern;
+        info[5] = header.isSymmetric;
+        info[6] = header.isSkewSymmetric;
+        info[7] = header.isHermitian;
+        info[8] = header.m;
+        info[9] = header.n;
     }
-    A_CIRC_CIRC.MakeSizeConsistent();
-    A = A_CIRC_CIRC;
+    long long extra[2] = { header.numNonzero, header.dataBegin };
+    mpi::Broadcast( info, 10, 0, comm );
+    mpi::Broadcast( extra, 2, 0, comm );
+    if( !info[0] )
+        RuntimeError
+        ("Could not read the Matrix Market header of ",filename," ",
+         headerError);
+    header.isMatrix = info[1];
+    header.isArray = info[2];
+    header.isComplex = info[3];
+    header.isPattern = info[4];
+    header.isSymmetric = info[5];
+    header.isSkewSymmetric = info[6];
+    header.isHermitian = info[7];
+    header.m = info[8];
+    header.n = info[9];
+    header.numNonzero = extra[0];
+    header.dataBegin = extra[1];
+    if( header.isComplex && !IsComplex<T>::val )
+        LogicError("Cannot read complex Matrix Market data into real matrix");
+    const Int m = header.m;
+    const Int n = header.n;
+    const Int p = g.VCSize();
+
+    std::vector<char> buffer;
+    text::ReadLines
+    ( filename, header.dataBegin, text::FileSize(filename), comm, buffer );
+    DistMatrix<T,VC,STAR> A_VC_STAR(g);
+    A_VC_STAR.Align( 0, 0 );
+    Zeros( A_VC_STAR, m, n );
+    if( header.isArray )
+    {
+        // Entry k of the file is entry (k%m,k/m) of the matrix
+        std::vector<Real> values;
+        Int numEntries;
+        const Int width = text::ParseRows( buffer, values, numEntries );
+        std::vector<char>().swap( buffer );
+        Int totalEntries, totalWidth, firstEntry;
+        const bool consistent = 
+            text::AgreeOnRows
+            ( numEntries, width, comm, totalEntries, totalWidth, firstEntry );
+        if( !consistent || totalEntries != m*n || 
+            (totalEntries > 0 && totalWidth != (header.isComplex ? 2 : 1)) )
+            RuntimeError("Expected ",m*n," entries in ",filename);
+        std::vector<int> owners( numEntries );
+        for( Int k=0; k<numEntries; ++k )
+            owners[k] = g.VCToViewingMap( ((firstEntry+k) % m) % p );
+        std::vector<Real> recvBuf;
+        text::Route( values, totalWidth, owners, comm, recvBuf );
+
+        // Our entries were received in column-major order
+        const Int localHeight = A_VC_STAR.LocalHeight();
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Real* entry = &recvBuf[(iLoc+j*localHeight)*totalWidth];
+                A_VC_STAR.SetLocalRealPart( iLoc, j, entry[0] );
+                if( header.isComplex )
+                    A_VC_STAR.SetLocalImagPart( iLoc, j, entry[1] );
+            }
+        }
+    }
+    else
+    {
+        std::vector<Int> indices;
+        std::vector<T> values;
+        Int myError = !text::ParseCoordinates
+            ( buffer, header.isMatrix, header.isPattern, header.isComplex,
+              indices, values );
+        std::vector<char>().swap( buffer );
+        const Int numNonzero = values.size();
+        for( Int k=0; k<numNonzero && !myError; ++k )
+            if( indices[2*k] >= m || indices[2*k+1] >= n )
+                myError = 1;
+        if( mpi::AllReduce( myError, mpi::MAX, comm ) )
+            RuntimeError("Invalid nonzero entry in ",filename);
+        const Int totalNonzero = mpi::AllReduce( numNonzero, comm );
+        if( totalNonzero != header.numNonzero )
+            RuntimeError
+            ("Expected ",header.numNonzero," nonzeros but found ",
+             totalNonzero);
+
+        std::vector<int> owners( numNonzero );
+        for( Int k=0; k<numNonzero; ++k )
+            owners[k] = g.VCToViewingMap( indices[2*k] % p );
+        std::vector<Int> recvIndices;
+        std::vector<T> recvValues;
+        text::Route( indices, 2, owners, comm, recvIndices );
+        text::Route( values, 1, owners, comm, recvValues );
+
+        const Int numRecv = recvValues.size();
+        for( Int k=0; k<numRecv; ++k )
+        {
+            const Int iLoc = recvIndices[2*k] / p;
+            const Int j = recvIndices[2*k+1];
+            if( header.isPattern )
+                A_VC_STAR.SetLocal( iLoc, j, T(1) );
+            else
+                A_VC_STAR.UpdateLocal( iLoc, j, recvValues[k] );
+        }
+    }
+    A = A_VC_STAR;
+    SymmetrizeMatrixMarket<T>( header, A );
 }
 
 template<typename T,Dist U,Dist V>
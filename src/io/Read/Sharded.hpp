@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_READ_SHARDED_HPP
+#define EL_READ_SHARDED_HPP
+
+#include "../Sharded.hpp"
+
+namespace El {
+namespace read {
+
+// The root reads the headers of the index and of every shard and broadcasts
+// their layouts, then each process reads the portions of the shards which
+// overlap its local entries. The checkpoint may have been written from any
+// distribution on a grid of any shape and size.
+template<typename T,Dist U,Dist V>
+inline void
+Sharded( DistMatrix<T,U,V>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::Sharded"))
+    using namespace El::sharded;
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const Int commRank = mpi::Rank( comm );
+
+    // Gather the layouts of the shards on the root. The number of shards is
+    // set to -1 to signal a failure to the other processes.
+    Int dims[3] = { 0, 0, -1 };
+    std::vector<Int> layouts;
+    if( commRank == 0 )
+    {
+        try
+        {
+            HeaderInt header[NUM_HEADER_FIELDS];
+            std::ifstream index( filename.c_str(), std::ios::binary );
+            if( !index.is_open() )
+                RuntimeError("Could not open ",filename);
+            index.read( (char*)header, HEADER_BYTES );
+            if( !index )
+                RuntimeError("Could not read the header of ",filename);
+            CheckHeader<T>( header, filename );
+            const Int numShards = header[NUM_SHARDS];
+            layouts.resize( numShards*NUM_SHARD_FIELDS );
+            for( Int shard=0; shard<numShards; ++shard )
+            {
+                const std::string shardName = ShardName( filename, shard );
+                std::ifstream file( shardName.c_str(), std::ios::binary );
+                if( !file.is_open() )
+                    RuntimeError("Could not open ",shardName);
+                HeaderInt shardHeader[NUM_HEADER_FIELDS];
+                file.read( (char*)shardHeader, HEADER_BYTES );
+                if( !file )
+                    RuntimeError("Could not read the header of ",shardName);
+                CheckHeader<T>( shardHeader, shardName );
+                if( shardHeader[HEIGHT] != header[HEIGHT] || 
+                    shardHeader[WIDTH] != header[WIDTH] || 
+                    shardHeader[SHARD] != shard )
+                    RuntimeError(shardName," does not match ",filename);
+                Int* layout = &layouts[shard*NUM_SHARD_FIELDS];
+                layout[SHARD_COL_SHIFT] = shardHeader[COL_SHIFT];
+                layout[SHARD_COL_STRIDE] = shardHeader[COL_STRIDE];
+                layout[SHARD_ROW_SHIFT] = shardHeader[ROW_SHIFT];
+                layout[SHARD_ROW_STRIDE] = shardHeader[ROW_STRIDE];
+                layout[SHARD_LOCAL_HEIGHT] = shardHeader[LOCAL_HEIGHT];
+                layout[SHARD_LOCAL_WIDTH] = shardHeader[LOCAL_WIDTH];
+            }
+            dims[0] = header[HEIGHT];
+            dims[1] = header[WIDTH];
+            dims[2] = numShards;
+        }
+        catch( std::exception& e )
+        {
+            mpi::Broadcast( dims, 3, 0, comm );
+            throw;
+        }
+    }
+    mpi::Broadcast( dims, 3, 0, comm );
+    const Int numShards = dims[2];
+    if( numShards < 0 )
+        RuntimeError("Could not read the sharded checkpoint ",filename);
+    layouts.resize( numShards*NUM_SHARD_FIELDS );
+    mpi::Broadcast( layouts.data(), layouts.size(), 0, comm );
+
+    A.Resize( dims[0], dims[1] );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    std::vector<Int> localRows, shardRows, localCols, shardCols;
+    std::vector<T> column;
+    for( Int shard=0; shard<numShards; ++shard )
+    {
+        const Int* layout = &layouts[shard*NUM_SHARD_FIELDS];
+        const Int shardHeight = layout[SHARD_LOCAL_HEIGHT];
+        const Int shardWidth = layout[SHARD_LOCAL_WIDTH];
+        if( shardHeight == 0 || shardWidth == 0 )
+            continue;
+        Overlap
+        ( localHeight, A.ColShift(), A.ColStride(),
+          layout[SHARD_COL_SHIFT], layout[SHARD_COL_STRIDE], 
+          localRows, shardRows );
+        Overlap
+        ( localWidth, A.RowShift(), A.RowStride(),
+          layout[SHARD_ROW_SHIFT], layout[SHARD_ROW_STRIDE], 
+          localCols, shardCols );
+        if( localRows.empty() || localCols.empty() )
+            continue;
+
+        const std::string shardName = ShardName( filename, shard );
+        std::ifstream file( shardName.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",shardName);
+        // Read the contiguous range of each shard column which contains the 
+        // overlapping entries
+        const Int firstRow = shardRows.front();
+        const Int numRows = shardRows.back()-firstRow+1;
+        column.resize( numRows );
+        for( std::size_t k=0; k<localCols.size(); ++k )
+        {
+            const std::streamoff pos = 
+                HEADER_BYTES + 
+                (std::streamoff(shardCols[k])*shardHeight+firstRow)*sizeof(T);
+            file.seekg( pos );
+            file.read( (char*)column.data(), numRows*sizeof(T) );
+            if( !file )
+                RuntimeError("Could not read from ",shardName);
+            T* localCol = A.Buffer(0,localCols[k]);
+            for( std::size_t l=0; l<localRows.size(); ++l )
+                localCol[localRows[l]] = column[shardRows[l]-firstRow];
+        }
+    }
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_SHARDED_HPP
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_IO_SHARDED_HPP
+#define EL_IO_SHARDED_HPP
+
+namespace El {
+namespace sharded {
+
+// A sharded checkpoint with basename 'name' consists of an index file,
+// name.shard, and one shard per process of the grid's viewing communicator,
+// name.shard.<rank>. Each file begins with the header below, which records
+// the DistData and grid of the matrix that was written; each shard follows
+// its header with the local entries of the process (or no entries, if the
+// process was not the first owner of its data) in column-major order. Since
+// each shard also records the shifts and strides of its rows and columns, a
+// reader need not know the original grid in order to locate any entry.
+enum HeaderField
+{
+    MAGIC,
+    VERSION,
+    ENTRY_SIZE,
+    IS_COMPLEX,
+    HEIGHT,
+    WIDTH,
+    COL_DIST,
+    ROW_DIST,
+    COL_ALIGN,
+    ROW_ALIGN,
+    ROOT,
+    GRID_HEIGHT,
+    GRID_WIDTH,
+    GRID_ORDER,
+    NUM_SHARDS,
+    SHARD,
+    COL_SHIFT,
+    COL_STRIDE,
+    ROW_SHIFT,
+    ROW_STRIDE,
+    LOCAL_HEIGHT,
+    LOCAL_WIDTH,
+    NUM_HEADER_FIELDS
+};
+
+// The header is stored with a fixed width regardless of the size of Int
+typedef long long HeaderInt;
+const HeaderInt MAGIC_NUMBER = 0x456c5368617264; // "ElShard"
+const HeaderInt FORMAT_VERSION = 1;
+const std::streamoff HEADER_BYTES = NUM_HEADER_FIELDS*sizeof(HeaderInt);
+
+inline std::string
+ShardName( const std::string& indexName, Int shard )
+{
+    std::ostringstream os;
+    os << indexName << "." << shard;
+    return os.str();
+}
+
+template<typename T>
+inline void
+FillHeader
+( const AbstractDistMatrix<T>& A, Int shard, Int numShards, bool owner,
+  HeaderInt* header )
+{
+    const Grid& g = A.Grid();
+    const El::DistData data = A.DistData();
+    header[MAGIC] = MAGIC_NUMBER;
+    header[VERSION] = FORMAT_VERSION;
+    header[ENTRY_SIZE] = sizeof(T);
+    header[IS_COMPLEX] = IsComplex<T>::val;
+    header[HEIGHT] = A.Height();
+    header[WIDTH] = A.Width();
+    header[COL_DIST] = data.colDist;
+    header[ROW_DIST] = data.rowDist;
+    header[COL_ALIGN] = data.colAlign;
+    header[ROW_ALIGN] = data.rowAlign;
+    header[ROOT] = data.root;
+    header[GRID_HEIGHT] = g.Height();
+    header[GRID_WIDTH] = g.Width();
+    header[GRID_ORDER] = g.Order();
+    header[NUM_SHARDS] = numShards;
+    header[SHARD] = shard;
+    header[COL_SHIFT] = ( owner ? A.ColShift() : 0 );
+    header[COL_STRIDE] = A.ColStride();
+    header[ROW_SHIFT] = ( owner ? A.RowShift() : 0 );
+    header[ROW_STRIDE] = A.RowStride();
+    header[LOCAL_HEIGHT] = ( owner ? A.LocalHeight() : 0 );
+    header[LOCAL_WIDTH] = ( owner ? A.LocalWidth() : 0 );
+}
+
+template<typename T>
+inline void
+CheckHeader( const HeaderInt* header, const std::string& filename )
+{
+    if( header[MAGIC] != MAGIC_NUMBER )
+        RuntimeError(filename," is not a sharded checkpoint");
+    if( header[VERSION] != FORMAT_VERSION )
+        RuntimeError
+        ("Unsupported sharded checkpoint version ",header[VERSION]);
+    if( header[ENTRY_SIZE] != HeaderInt(sizeof(T)) ||
+        header[IS_COMPLEX] != HeaderInt(IsComplex<T>::val) )
+        RuntimeError("Datatype of ",filename," does not match the matrix");
+}
+
+// The shard-local indices of the local indices shift:stride:n-1 which also
+// lie in shardShift:shardStride:n-1
+inline void
+Overlap
+( Int localLength, Int shift, Int stride, Int shardShift, Int shardStride,
+  std::vector<Int>& localInds, std::vector<Int>& shardInds )
+{
+    localInds.clear();
+    shardInds.clear();
+    // The progressions only intersect if their shifts agree modulo the GCD
+    // of the strides
+    if( (shift-shardShift) % GCD(stride,shardStride) != 0 )
+        return;
+    for( Int iLoc=0; iLoc<localLength; ++iLoc )
+    {
+        const Int i = shift + iLoc*stride;
+        if( i >= shardShift && (i-shardShift) % shardStride == 0 )
+        {
+            localInds.push_back( iLoc );
+            shardInds.push_back( (i-shardShift)/shardStride );
+        }
+    }
+}
+
+// The fields of each shard header which are needed to locate its entries
+enum ShardField
+{
+    SHARD_COL_SHIFT,
+    SHARD_COL_STRIDE,
+    SHARD_ROW_SHIFT,
+    SHARD_ROW_STRIDE,
+    SHARD_LOCAL_HEIGHT,
+    SHARD_LOCAL_WIDTH,
+    NUM_SHARD_FIELDS
+};
+
+} // namespace sharded
+} // namespace El
+
+#endif // ifndef EL_IO_SHARDED_HPP
@@ -0,0 +1,842 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_IO_TEXT_HPP
+#define EL_IO_TEXT_HPP
+
+// Building blocks for the ASCII, ASCII_MATLAB, and MATRIX_MARKET formats:
+// the lines of a file are split by byte range between the processes of a
+// communicator (and between threads within each process) and parsed without
+// streams, while writers format fixed-width entries so that each process can
+// compute the file offsets of its rows (or columns) without communication.
+
+namespace El {
+namespace text {
+
+// Parsing
+// =======
+
+inline bool IsDigit( char c ) { return c >= '0' && c <= '9'; }
+inline bool IsSpace( char c )
+{ return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v'; }
+
+inline void SkipSpace( const char*& p, const char* end )
+{ while( p != end && IsSpace(*p) ) ++p; }
+
+// The largest power of ten which is exactly representable and the number of
+// bits in the significand, which together determine when a decimal
+// significand and exponent may be converted with a single exact
+// multiplication or division (Clinger's fast path)
+template<typename Real> struct FastPath;
+template<> struct FastPath<float>  { static const int maxExp = 10; };
+template<> struct FastPath<double> { static const int maxExp = 22; };
+
+template<typename Real>
+inline Real PowerOfTen( int exponent )
+{
+    static const double powers[] =
+    { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9, 1e10,
+      1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+      1e22 };
+    return Real(powers[exponent]);
+}
+
+inline double StringToReal( const char* str, char** end, double )
+{ return std::strtod( str, end ); }
+inline float StringToReal( const char* str, char** end, float )
+{ return std::strtof( str, end ); }
+
+// Parse a real number starting at p (which must not point to whitespace) and
+// advance p past it. Numbers whose significands have more digits than can
+// be represented exactly, whose exponents are out of the fast-path range, or
+// which are not in decimal notation (e.g., inf or nan) are handed to strtod.
+template<typename Real>
+inline bool ParseReal( const char*& p, const char* end, Real& value )
+{
+    const char* start = p;
+    bool negative = false;
+    if( p != end && (*p == '-' || *p == '+') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+
+    unsigned long long significand = 0;
+    int numDigits=0, exponent=0;
+    bool sawDigit=false, truncated=false;
+    for( ; p != end && IsDigit(*p); ++p )
+    {
+        sawDigit = true;
+        if( numDigits < 19 )
+        {
+            significand = 10*significand + (*p-'0');
+            if( significand != 0 )
+                ++numDigits;
+        }
+        else
+        {
+            truncated = true;
+            ++exponent;
+        }
+    }
+    if( p != end && *p == '.' )
+    {
+        for( ++p; p != end && IsDigit(*p); ++p )
+        {
+            sawDigit = true;
+            if( numDigits < 19 )
+            {
+                significand = 10*significand + (*p-'0');
+                if( significand != 0 )
+                    ++numDigits;
+                --exponent;
+            }
+            else
+                truncated = true;
+        }
+    }
+    if( sawDigit && p != end && (*p == 'e' || *p == 'E') )
+    {
+        const char* expStart = p;
+        ++p;
+        bool negativeExp = false;
+        if( p != end && (*p == '-' || *p == '+') )
+        {
+            negativeExp = ( *p == '-' );
+            ++p;
+        }
+        if( p == end || !IsDigit(*p) )
+            p = expStart;
+        else
+        {
+            int explicitExp = 0;
+            for( ; p != end && IsDigit(*p); ++p )
+                if( explicitExp < 100000 )
+                    explicitExp = 10*explicitExp + (*p-'0');
+            exponent += ( negativeExp ? -explicitExp : explicitExp );
+        }
+    }
+
+    const unsigned long long maxExact =
+        1ull << std::numeric_limits<Real>::digits;
+    if( sawDigit && !truncated && significand <= maxExact &&
+        exponent >= -FastPath<Real>::maxExp &&
+        exponent <= FastPath<Real>::maxExp )
+    {
+        value = Real(significand);
+        if( exponent < 0 )
+            value /= PowerOfTen<Real>(-exponent);
+        else
+            value *= PowerOfTen<Real>(exponent);
+        if( negative )
+            value = -value;
+        return true;
+    }
+
+    // Fall back to the C library on a null-terminated copy of the entire
+    // token, which may be arbitrarily long (e.g., for long decimal expansions)
+    const char* tokenEnd = start;
+    while( tokenEnd != end && !IsSpace(*tokenEnd) && *tokenEnd != '\n' )
+        ++tokenEnd;
+    const std::string token( start, tokenEnd );
+    char* parsedEnd;
+    value = StringToReal( token.c_str(), &parsedEnd, Real(0) );
+    if( parsedEnd == token.c_str() )
+    {
+        p = start;
+        return false;
+    }
+    p = start + (parsedEnd-token.c_str());
+    return true;
+}
+
+// Real scalars
+template<typename Real>
+inline bool ParseScalar( const char*& p, const char* end, Real& value )
+{ return ParseReal( p, end, value ); }
+
+// Integers are parsed exactly
+inline bool ParseScalar( const char*& p, const char* end, Int& value )
+{
+    const char* start = p;
+    const bool negative = ( p != end && *p == '-' );
+    if( p != end && (*p == '-' || *p == '+') )
+        ++p;
+    if( p == end || !IsDigit(*p) )
+    {
+        p = start;
+        return false;
+    }
+    value = 0;
+    for( ; p != end && IsDigit(*p); ++p )
+        value = 10*value + (*p-'0');
+    if( negative )
+        value = -value;
+    return true;
+}
+
+// Complex scalars may be written as 'a', 'a+bi', 'a-bi', 'bi', or '(a,b)'
+template<typename Real>
+inline bool
+ParseScalar( const char*& p, const char* end, Complex<Real>& value )
+{
+    const char* start = p;
+    Real realPart, imagPart=0;
+    if( p != end && *p == '(' )
+    {
+        ++p;
+        if( !ParseReal( p, end, realPart ) || p == end || *p != ',' )
+        {
+            p = start;
+            return false;
+        }
+        ++p;
+        if( !ParseReal( p, end, imagPart ) || p == end || *p != ')' )
+        {
+            p = start;
+            return false;
+        }
+        ++p;
+        value = Complex<Real>(realPart,imagPart);
+        return true;
+    }
+
+    if( !ParseReal( p, end, realPart ) )
+        return false;
+    if( p != end && *p == 'i' )
+    {
+        ++p;
+        value = Complex<Real>(0,realPart);
+        return true;
+    }
+    if( p != end && (*p == '+' || *p == '-') )
+    {
+        const char* imagStart = p;
+        if( ParseReal( p, end, imagPart ) && p != end && *p == 'i' )
+            ++p;
+        else
+        {
+            p = imagStart;
+            imagPart = 0;
+        }
+    }
+    value = Complex<Real>(realPart,imagPart);
+    return true;
+}
+
+// Parse a (1-based) index
+inline bool ParseIndex( const char*& p, const char* end, Int& index )
+{
+    if( p == end || !IsDigit(*p) )
+        return false;
+    index = 0;
+    for( ; p != end && IsDigit(*p); ++p )
+        index = 10*index + (*p-'0');
+    return true;
+}
+
+// Splitting files into lines
+// ==========================
+
+// The first position in [pos,end) which begins a line (either the beginning
+// of the range or the position following a newline)
+inline std::streamoff
+NextLineStart
+( std::ifstream& file, std::streamoff begin, std::streamoff pos,
+  std::streamoff end )
+{
+    if( pos <= begin )
+        return begin;
+    const std::streamoff windowSize = 1<<16;
+    std::vector<char> window( windowSize );
+    std::streamoff windowStart = pos-1;
+    while( windowStart < end )
+    {
+        const std::streamoff numBytes = Min(windowSize,end-windowStart);
+        file.seekg( windowStart );
+        file.read( window.data(), numBytes );
+        const void* newline = std::memchr( window.data(), '\n', numBytes );
+        if( newline != nullptr )
+            return windowStart + ((const char*)newline-window.data()) + 1;
+        windowStart += numBytes;
+    }
+    return end;
+}
+
+// Read the lines of the byte range [begin,end) of the file whose first byte
+// lies within this process's contiguous share of the range
+inline void
+ReadLines
+( const std::string& filename, std::streamoff begin, std::streamoff end,
+  mpi::Comm comm, std::vector<char>& buffer )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::ReadLines"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    const std::streamoff numBytes = end-begin;
+    const std::streamoff shareBegin = begin + (numBytes*commRank)/commSize;
+    const std::streamoff shareEnd = begin + (numBytes*(commRank+1))/commSize;
+    const std::streamoff lineBegin =
+        NextLineStart( file, begin, shareBegin, end );
+    const std::streamoff lineEnd =
+        ( commRank == commSize-1 ? end :
+          NextLineStart( file, begin, shareEnd, end ) );
+    buffer.resize( Max(lineEnd-lineBegin,std::streamoff(0)) );
+    if( !buffer.empty() )
+    {
+        file.clear();
+        file.seekg( lineBegin );
+        file.read( buffer.data(), buffer.size() );
+        if( !file )
+            RuntimeError("Could not read ",filename);
+    }
+}
+
+inline std::streamoff FileSize( const std::string& filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::FileSize"))
+    std::ifstream file( filename.c_str(), std::ios::binary | std::ios::ate );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    return file.tellg();
+}
+
+// The position of the first (or, if 'last' is true, the last) occurrence of
+// the character c within [begin,end) of the file, or -1 if there is none
+inline std::streamoff
+Find
+( const std::string& filename, char c, std::streamoff begin, 
+  std::streamoff end, bool last=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::Find"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const std::streamoff windowSize = 1<<16;
+    std::vector<char> window( windowSize );
+    const std::streamoff numWindows = (end-begin+windowSize-1)/windowSize;
+    for( std::streamoff k=0; k<numWindows; ++k )
+    {
+        const std::streamoff windowStart = 
+            ( last ? Max(end-(k+1)*windowSize,begin) : begin+k*windowSize );
+        const std::streamoff numBytes =
+            ( last ? end-k*windowSize-windowStart 
+                   : Min(windowSize,end-windowStart) );
+        file.seekg( windowStart );
+        file.read( window.data(), numBytes );
+        if( last )
+        {
+            for( std::streamoff i=numBytes-1; i>=0; --i )
+                if( window[i] == c )
+                    return windowStart + i;
+        }
+        else
+        {
+            const void* match = std::memchr( window.data(), c, numBytes );
+            if( match != nullptr )
+                return windowStart + ((const char*)match-window.data());
+        }
+    }
+    return -1;
+}
+
+// The offsets of the beginnings of the lines within the buffer, followed by
+// the offset of its end
+inline void
+LineStarts( const std::vector<char>& buffer, std::vector<std::size_t>& starts )
+{
+    starts.clear();
+    const char* data = buffer.data();
+    const std::size_t size = buffer.size();
+    std::size_t pos = 0;
+    while( pos < size )
+    {
+        starts.push_back( pos );
+        const void* newline = std::memchr( data+pos, '\n', size-pos );
+        pos = ( newline==nullptr ? size : ((const char*)newline-data)+1 );
+    }
+    starts.push_back( size );
+}
+
+inline Int NumThreads()
+{
+#ifdef EL_HAVE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// Rows of whitespace-separated entries
+// ------------------------------------
+// Parse the lines into rows (skipping lines which do not begin with a number,
+// such as blank lines and titles), in parallel over contiguous blocks of
+// lines, and return the number of entries per row (or -1 if the rows are of
+// inconsistent widths)
+template<typename T>
+inline Int
+ParseRows
+( const std::vector<char>& buffer, std::vector<T>& values, Int& numRows )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::ParseRows"))
+    std::vector<std::size_t> starts;
+    LineStarts( buffer, starts );
+    const Int numLines = starts.size()-1;
+    const Int numBlocks = Max(Min(NumThreads(),numLines),Int(1));
+    std::vector<std::vector<T>> blockValues( numBlocks );
+    std::vector<Int> blockRows( numBlocks, 0 ), blockWidths( numBlocks, 0 );
+    std::vector<Int> blockErrors( numBlocks, 0 );
+
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int firstLine = (numLines*block)/numBlocks;
+        const Int lastLine = (numLines*(block+1))/numBlocks;
+        std::vector<T>& myValues = blockValues[block];
+        Int& width = blockWidths[block];
+        for( Int line=firstLine; line<lastLine; ++line )
+        {
+            const char* p = buffer.data() + starts[line];
+            const char* end = buffer.data() + starts[line+1];
+            Int numCols=0;
+            T value;
+            while( true )
+            {
+                SkipSpace( p, end );
+                if( p == end || *p == '\n' )
+                    break;
+                if( !ParseScalar( p, end, value ) )
+                {
+                    // Lines which begin with text (e.g., titles) are skipped
+                    if( numCols != 0 )
+                        blockErrors[block] = 1;
+                    break;
+                }
+                myValues.push_back( value );
+                ++numCols;
+                // Semicolons (as in MATLAB) are treated as whitespace
+                while( p != end && *p == ';' )
+                    ++p;
+            }
+            if( numCols != 0 )
+            {
+                if( width != 0 && numCols != width )
+                    blockErrors[block] = 1;
+                width = numCols;
+                ++blockRows[block];
+            }
+        }
+    }
+
+    Int width = 0;
+    numRows = 0;
+    values.clear();
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        if( blockErrors[block] )
+            return -1;
+        if( blockRows[block] == 0 )
+            continue;
+        if( width != 0 && blockWidths[block] != width )
+            return -1;
+        width = blockWidths[block];
+        numRows += blockRows[block];
+        values.insert
+        ( values.end(), blockValues[block].begin(), blockValues[block].end() );
+    }
+    return width;
+}
+
+// Coordinate-format entries
+// -------------------------
+// Parse lines of the form 'i j value' (or 'i value' for vectors), where the
+// value is omitted for patterns and is given by its real and imaginary parts
+// for complex fields, converting the indices from Fortran to C indexing
+template<typename T>
+inline bool
+ParseCoordinates
+( const std::vector<char>& buffer, bool isMatrix, bool isPattern,
+  bool isComplex, std::vector<Int>& indices, std::vector<T>& values )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::ParseCoordinates"))
+    typedef Base<T> Real;
+    std::vector<std::size_t> starts;
+    LineStarts( buffer, starts );
+    const Int numLines = starts.size()-1;
+    const Int numBlocks = Max(Min(NumThreads(),numLines),Int(1));
+    std::vector<std::vector<Int>> blockIndices( numBlocks );
+    std::vector<std::vector<T>> blockValues( numBlocks );
+    std::vector<Int> blockErrors( numBlocks, 0 );
+
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int firstLine = (numLines*block)/numBlocks;
+        const Int lastLine = (numLines*(block+1))/numBlocks;
+        for( Int line=firstLine; line<lastLine; ++line )
+        {
+            const char* p = buffer.data() + starts[line];
+            const char* end = buffer.data() + starts[line+1];
+            SkipSpace( p, end );
+            if( p == end || *p == '\n' )
+                continue;
+            Int i, j=1;
+            Real realPart=1, imagPart=0;
+            bool valid = ParseIndex( p, end, i );
+            if( valid && isMatrix )
+            {
+                SkipSpace( p, end );
+                valid = ParseIndex( p, end, j );
+            }
+            if( valid && !isPattern )
+            {
+                SkipSpace( p, end );
+                valid = ParseScalar( p, end, realPart );
+                if( valid && isComplex )
+                {
+                    SkipSpace( p, end );
+                    valid = ParseScalar( p, end, imagPart );
+                }
+            }
+            if( !valid || i < 1 || j < 1 )
+            {
+                blockErrors[block] = 1;
+                break;
+            }
+            T value = realPart;
+            if( isComplex )
+                SetImagPart( value, imagPart );
+            blockIndices[block].push_back( i-1 );
+            blockIndices[block].push_back( j-1 );
+            blockValues[block].push_back( value );
+        }
+    }
+
+    indices.clear();
+    values.clear();
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        if( blockErrors[block] )
+            return false;
+        indices.insert
+        ( indices.end(), 
+          blockIndices[block].begin(), blockIndices[block].end() );
+        values.insert
+        ( values.end(), blockValues[block].begin(), blockValues[block].end() );
+    }
+    return true;
+}
+
+// Distributing parsed data
+// ========================
+
+// Send each record of 'recordSize' consecutive entries to the process of comm
+// given by the corresponding entry of 'owners'. The records received from
+// each process retain their order and are concatenated in order of rank.
+template<typename T>
+inline void
+Route
+( const std::vector<T>& sendBuf, Int recordSize, 
+  const std::vector<int>& owners, mpi::Comm comm, std::vector<T>& recvBuf )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::Route"))
+    const Int commSize = mpi::Size( comm );
+    const Int numRecords = owners.size();
+    std::vector<int> sendCounts(commSize,0), sendDispls(commSize);
+    for( Int k=0; k<numRecords; ++k )
+        sendCounts[owners[k]] += recordSize;
+    std::vector<int> recvCounts(commSize), recvDispls(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    Int totalSend=0, totalRecv=0;
+    for( Int q=0; q<commSize; ++q )
+    {
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    std::vector<T> packed( totalSend );
+    std::vector<int> offsets = sendDispls;
+    for( Int k=0; k<numRecords; ++k )
+    {
+        std::copy
+        ( sendBuf.data()+k*recordSize, sendBuf.data()+(k+1)*recordSize, 
+          packed.data()+offsets[owners[k]] );
+        offsets[owners[k]] += recordSize;
+    }
+    recvBuf.resize( totalRecv );
+    mpi::AllToAll
+    ( packed.data(), sendCounts.data(), sendDispls.data(),
+      recvBuf.data(), recvCounts.data(), recvDispls.data(), comm );
+}
+
+// Given the number of rows parsed by each process and their width (which is
+// -1 if they were inconsistent), determine the total number of rows, their
+// common width, and the index of the first of our rows. False is returned
+// if the widths are inconsistent.
+inline bool
+AgreeOnRows
+( Int numRows, Int width, mpi::Comm comm, 
+  Int& height, Int& globalWidth, Int& firstRow )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::AgreeOnRows"))
+    const Int commSize = mpi::Size( comm );
+    const Int commRank = mpi::Rank( comm );
+    Int mySizes[2] = { numRows, width };
+    std::vector<Int> sizes( 2*commSize );
+    mpi::AllGather( mySizes, 2, sizes.data(), 2, comm );
+    height = 0;
+    globalWidth = 0;
+    firstRow = 0;
+    bool consistent = true;
+    for( Int q=0; q<commSize; ++q )
+    {
+        const Int qRows = sizes[2*q];
+        const Int qWidth = sizes[2*q+1];
+        if( qWidth < 0 || (qRows > 0 && height > 0 && qWidth != globalWidth) )
+            consistent = false;
+        if( qRows > 0 )
+            globalWidth = qWidth;
+        if( q == commRank )
+            firstRow = height;
+        height += qRows;
+    }
+    return consistent;
+}
+
+// Read and parse all of the rows of the byte range [begin,end) of the file
+template<typename T>
+inline void
+ReadRows
+( Matrix<T>& A, const std::string& filename, 
+  std::streamoff begin, std::streamoff end )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::ReadRows"))
+    std::vector<char> buffer;
+    ReadLines( filename, begin, end, mpi::COMM_SELF, buffer );
+    std::vector<T> values;
+    Int height;
+    const Int width = ParseRows( buffer, values, height );
+    if( width < 0 )
+        RuntimeError("Inconsistent number of columns in ",filename);
+    A.Resize( height, width );
+    for( Int i=0; i<height; ++i )
+        for( Int j=0; j<width; ++j )
+            A.Set( i, j, values[i*width+j] );
+}
+
+// Every process of the grid's viewing communicator parses the rows of its
+// share of the byte range [begin,end) of the file, and the rows are then
+// sent to their owners in a [VC,STAR] distribution (aligned with the first 
+// process) in which each row of the file is a row of the matrix
+template<typename T>
+inline void
+ReadRows
+( DistMatrix<T,VC,STAR>& A, const std::string& filename,
+  std::streamoff begin, std::streamoff end )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::ReadRows"))
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.ViewingComm();
+    std::vector<char> buffer;
+    ReadLines( filename, begin, end, comm, buffer );
+    std::vector<T> values;
+    Int numRows;
+    const Int width = ParseRows( buffer, values, numRows );
+    std::vector<char>().swap( buffer );
+
+    Int height, firstRow, globalWidth;
+    if( !AgreeOnRows( numRows, width, comm, height, globalWidth, firstRow ) )
+        RuntimeError("Inconsistent number of columns in ",filename);
+
+    const Int p = g.VCSize();
+    std::vector<int> owners( numRows );
+    for( Int k=0; k<numRows; ++k )
+        owners[k] = g.VCToViewingMap( (firstRow+k) % p );
+    std::vector<T> recvBuf;
+    Route( values, globalWidth, owners, comm, recvBuf );
+
+    // Our rows were received in increasing order
+    A.Align( 0, 0 );
+    A.Resize( height, globalWidth );
+    const Int localHeight = A.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( Int j=0; j<globalWidth; ++j )
+            A.SetLocal( iLoc, j, recvBuf[iLoc*globalWidth+j] );
+}
+
+// Formatting
+// ==========
+
+// Entries are written in scientific notation with enough digits to recover
+// them exactly and are padded to a fixed width
+template<typename Real>
+inline int Precision() { return std::numeric_limits<Real>::max_digits10-1; }
+template<typename Real>
+inline int RealWidth() { return Precision<Real>()+8; }
+
+template<typename Real>
+inline void FormatReal( Real value, char* buf, int width, bool forceSign )
+{
+    char tmp[64];
+    const int length =
+        std::snprintf
+        ( tmp, 64, ( forceSign ? "%+.*e" : "%.*e" ),
+          Precision<Real>(), double(value) );
+    const int copied = Min(length,width);
+    std::memcpy( buf, tmp, copied );
+    std::memset( buf+copied, ' ', width-copied );
+}
+
+// Real entries are written as 'a' and complex entries as 'a+bi' (matching
+// Print) or, if 'separate' is true, as 'a b' (as in Matrix Market)
+template<typename Real>
+inline int EntryWidth( Real, bool separate ) { return RealWidth<Real>(); }
+template<typename Real>
+inline int EntryWidth( Complex<Real>, bool separate )
+{ return 2*RealWidth<Real>()+1; }
+
+inline int EntryWidth( Int, bool separate )
+{ return std::numeric_limits<Int>::digits10+2; }
+
+template<typename Real>
+inline void FormatEntry( Real value, char* buf, bool separate )
+{ FormatReal( value, buf, RealWidth<Real>(), false ); }
+
+template<typename Real>
+inline void FormatEntry( Complex<Real> value, char* buf, bool separate )
+{
+    const int width = RealWidth<Real>();
+    if( separate )
+    {
+        FormatReal( value.real(), buf, width, false );
+        buf[width] = ' ';
+        FormatReal( value.imag(), buf+width+1, width, false );
+    }
+    else
+    {
+        // Keep the 'i' adjacent to the imaginary part
+        char tmp[64];
+        const int length =
+            std::snprintf
+            ( tmp, 64, "%.*e%+.*ei", Precision<Real>(), double(value.real()),
+              Precision<Real>(), double(value.imag()) );
+        const int copied = Min(length,2*width+1);
+        std::memcpy( buf, tmp, copied );
+        std::memset( buf+copied, ' ', 2*width+1-copied );
+    }
+}
+
+inline void FormatEntry( Int value, char* buf, bool separate )
+{
+    const int width = EntryWidth( value, separate );
+    char tmp[64];
+    const int length = std::snprintf( tmp, 64, "%lld", (long long)value );
+    std::memcpy( buf, tmp, length );
+    std::memset( buf+length, ' ', width-length );
+}
+
+// Format the rows (or columns, if 'transposed') of the local matrix A as
+// fixed-length records of entries which are each followed by the separator
+// character 'sep', except for the last entry of each record, which is
+// followed by a newline
+template<typename T>
+inline void
+FormatRecords
+( const Matrix<T>& A, bool transposed, bool separate, char sep,
+  std::vector<char>& buffer, Int& recordBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::FormatRecords"))
+    const Int numRecords = ( transposed ? A.Width() : A.Height() );
+    const Int recordLength = ( transposed ? A.Height() : A.Width() );
+    const Int entryBytes = EntryWidth( T(0), separate ) + 1;
+    recordBytes = recordLength*entryBytes;
+    buffer.resize( numRecords*recordBytes );
+
+    EL_PARALLEL_FOR
+    for( Int record=0; record<numRecords; ++record )
+    {
+        char* rec = &buffer[record*recordBytes];
+        for( Int k=0; k<recordLength; ++k )
+        {
+            const T value = ( transposed ? A.Get(k,record) : A.Get(record,k) );
+            FormatEntry( value, rec+k*entryBytes, separate );
+            rec[(k+1)*entryBytes-1] = ( k==recordLength-1 ? '\n' : sep );
+        }
+    }
+}
+
+// Write the header from the root of comm, and the records which this process
+// formatted, which are records shift:stride:numRecords-1 of the file,
+// collectively with MPI-IO
+inline void
+WriteRecords
+( const std::string& filename, const std::string& header,
+  const std::string& footer, Int numRecords, Int recordBytes,
+  Int shift, Int stride, const std::vector<char>& buffer, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::WriteRecords"))
+    const mpi::Offset headerBytes = header.size();
+    const mpi::Offset bodyBytes = mpi::Offset(numRecords)*recordBytes;
+    mpi::File file;
+    mpi::FileOpen( comm, filename, true, file );
+    mpi::FileSetSize( file, headerBytes+bodyBytes+footer.size() );
+    if( mpi::Rank(comm) == 0 )
+    {
+        mpi::FileWriteAt
+        ( file, 0, (const byte*)header.data(), header.size() );
+        mpi::FileWriteAt
+        ( file, headerBytes+bodyBytes, (const byte*)footer.data(),
+          footer.size() );
+    }
+    // Each record is treated as a column of a byte matrix
+    if( recordBytes > 0 )
+    {
+        const Int localRecords = buffer.size() / recordBytes;
+        mpi::FileWriteAll
+        ( file, headerBytes, recordBytes, recordBytes, 0, 1,
+          localRecords, shift, stride, (const byte*)buffer.data(),
+          recordBytes );
+    }
+    mpi::FileClose( file );
+}
+
+// Write the local matrix sequentially, formatting and writing a bounded
+// number of records at a time
+template<typename T>
+inline void
+WriteRecords
+( std::ofstream& file, const Matrix<T>& A, bool transposed, bool separate,
+  char sep )
+{
+    DEBUG_ONLY(CallStackEntry cse("text::WriteRecords"))
+    const Int numRecords = ( transposed ? A.Width() : A.Height() );
+    const Int blocksize = 1024;
+    std::vector<char> buffer;
+    Int recordBytes;
+    for( Int s=0; s<numRecords; s+=blocksize )
+    {
+        const Int nb = Min(blocksize,numRecords-s);
+        auto ABlock =
+            ( transposed ? LockedView( A, 0, s, A.Height(), nb )
+                         : LockedView( A, s, 0, nb, A.Width() ) );
+        FormatRecords
+        ( ABlock, transposed, separate, sep, buffer, recordBytes );
+        file.write( buffer.data(), buffer.size() );
+    }
+}
+
+} // namespace text
+} // namespace El
+
+#endif // ifndef EL_IO_TEXT_HPP
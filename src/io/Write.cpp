@@ -8,11 +8,13 @@
 */
 #include "El.hpp"
 
+#include "./Text.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
 #include "./Write/BinaryFlat.hpp"
 #include "./Write/Image.hpp"
+#include "./Write/Sharded.hpp"
 #include "./Write/MatrixMarket.hpp"
 
 namespace El {
@@ -49,16 +51,32 @@ void Write
   std::string basename, FileFormat format, std::string title )
 {
     DEBUG_ONLY(CallStackEntry cse("Write"))
-    if( U == A.UGath && V == A.VGath )
+    if( format == BINARY_SHARDED )
+        write::Sharded( A, basename );
+    else if( U == A.UGath && V == A.VGath )
     {
+        // Ensure that the file is complete before any process returns, as in
+        // the collective writes below
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
+        mpi::Barrier( A.Grid().ViewingComm() );
     }
+    else if( format == BINARY )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT )
+        write::BinaryFlat( A, basename );
+    else if( format == ASCII )
+        write::Ascii( A, basename, title );
+    else if( format == ASCII_MATLAB )
+        write::AsciiMatlab( A, basename, title );
+    else if( format == MATRIX_MARKET )
+        write::MatrixMarket( A, basename );
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
         if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
             Write( A_CIRC_CIRC.LockedMatrix(), basename, format, title );
+        mpi::Barrier( A.Grid().ViewingComm() );
     }
 }
 
@@ -19,12 +19,39 @@ Ascii( const Matrix<T>& A, std::string basename="matrix", std::string title="" )
 {
     DEBUG_ONLY(CallStackEntry cse("write::Ascii"))
     std::string filename = basename + "." + FileExtension(ASCII);
-    std::ofstream file( filename.c_str() );
+    std::ofstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    file.setf( std::ios::scientific );
-    Print( A, title, file );
+    if( title != "" )
+        file << title << "\n";
+    text::WriteRecords( file, A, false, false, ' ' );
+    file << "\n";
+}
+
+// Each row is formatted as a fixed-width record by its owner in a [VC,STAR]
+// distribution and written directly to its offset in the file
+template<typename T,Dist U,Dist V>
+inline void
+Ascii
+( const DistMatrix<T,U,V>& A, std::string basename="matrix", 
+  std::string title="" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::Ascii"))
+    std::string filename = basename + "." + FileExtension(ASCII);
+    DistMatrix<T,VC,STAR> A_VC_STAR( A.Grid() );
+    A_VC_STAR.Align( 0, 0 );
+    A_VC_STAR = A;
+
+    std::vector<char> buffer;
+    Int recordBytes;
+    text::FormatRecords
+    ( A_VC_STAR.LockedMatrix(), false, false, ' ', buffer, recordBytes );
+    const std::string header = ( title == "" ? title : title+"\n" );
+    text::WriteRecords
+    ( filename, header, "\n", A.Height(), recordBytes, 
+      A_VC_STAR.ColShift(), A_VC_STAR.ColStride(), buffer, 
+      A.Grid().ViewingComm() );
 }
 
 } // namespace write
@@ -25,16 +25,43 @@ AsciiMatlab
         title = "matrix";
 
     std::string filename = basename + "." + FileExtension(ASCII_MATLAB);
-    std::ofstream file( filename.c_str() );
+    std::ofstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    file.setf( std::ios::scientific );
     file << title << " = [\n";
-    Print( A, "", file );
+    text::WriteRecords( file, A, false, false, ' ' );
     file << "];\n";
 }
 
+// Each row is formatted as a fixed-width record by its owner in a [VC,STAR]
+// distribution and written directly to its offset in the file
+template<typename T,Dist U,Dist V>
+inline void
+AsciiMatlab
+( const DistMatrix<T,U,V>& A, std::string basename="matrix", 
+  std::string title="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::AsciiMatlab"))
+    // Empty titles are not legal
+    if( title == "" )
+        title = "matrix";
+
+    std::string filename = basename + "." + FileExtension(ASCII_MATLAB);
+    DistMatrix<T,VC,STAR> A_VC_STAR( A.Grid() );
+    A_VC_STAR.Align( 0, 0 );
+    A_VC_STAR = A;
+
+    std::vector<char> buffer;
+    Int recordBytes;
+    text::FormatRecords
+    ( A_VC_STAR.LockedMatrix(), false, false, ' ', buffer, recordBytes );
+    text::WriteRecords
+    ( filename, title+" = [\n", "];\n", A.Height(), recordBytes, 
+      A_VC_STAR.ColShift(), A_VC_STAR.ColStride(), buffer, 
+      A.Grid().ViewingComm() );
+}
+
 } // namespace write
 } // namespace El
 
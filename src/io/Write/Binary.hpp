@@ -36,6 +36,40 @@ Binary( const Matrix<T>& A, std::string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Every process writes its local entries directly to their offsets in the
+// file with collective MPI-IO, so that no process ever holds more than its
+// own portion of the matrix
+template<typename T,Dist U,Dist V>
+inline void
+Binary( const DistMatrix<T,U,V>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::Binary"))
+    
+    std::string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const Int commRank = mpi::Rank( comm );
+    mpi::File file;
+    mpi::FileOpen( comm, filename, true, file );
+
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset dataBytes = mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, metaBytes + dataBytes );
+    if( commRank == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        mpi::FileWriteAt( file, 0, dims, 2 );
+    }
+
+    // Only one copy of each redundantly-stored entry is written
+    const bool writing = A.Participating() && A.RedundantRank() == 0;
+    mpi::FileWriteAll
+    ( file, metaBytes, A.Height(), 
+      ( writing ? A.LocalHeight() : 0 ), A.ColShift(), A.ColStride(), 
+      ( writing ? A.LocalWidth()  : 0 ), A.RowShift(), A.RowStride(), 
+      A.LockedBuffer(), A.LDim() );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
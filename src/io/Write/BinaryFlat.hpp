@@ -31,6 +31,30 @@ BinaryFlat( const Matrix<T>& A, std::string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// As in write::Binary, but without the dimensions at the head of the file
+template<typename T,Dist U,Dist V>
+inline void
+BinaryFlat( const DistMatrix<T,U,V>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryFlat"))
+    
+    std::string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, true, file );
+    const mpi::Offset dataBytes = mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, dataBytes );
+
+    // Only one copy of each redundantly-stored entry is written
+    const bool writing = A.Participating() && A.RedundantRank() == 0;
+    mpi::FileWriteAll
+    ( file, 0, A.Height(), 
+      ( writing ? A.LocalHeight() : 0 ), A.ColShift(), A.ColStride(), 
+      ( writing ? A.LocalWidth()  : 0 ), A.RowShift(), A.RowStride(), 
+      A.LockedBuffer(), A.LDim() );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
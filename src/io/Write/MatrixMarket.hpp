@@ -13,6 +13,20 @@
 namespace El {
 namespace write {
 
+template<typename T>
+inline std::string MatrixMarketHeader( Int m, Int n )
+{
+    std::ostringstream os;
+    os << "%%MatrixMarket matrix array ";
+    if( IsComplex<T>::val )
+        os << "complex "; 
+    else
+        os << "real ";
+    os << "general\n";
+    os << m << " " << n << "\n";
+    return os.str();
+}
+
 template<typename T>
 inline void
 MatrixMarket( const Matrix<T>& A, std::string basename="matrix" )
@@ -24,43 +38,35 @@ MatrixMarket( const Matrix<T>& A, std::string basename="matrix" )
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    // Write the header
-    // ================
-    {
-        std::ostringstream os;
-        os << "%%MatrixMarket matrix array ";
-        if( IsComplex<T>::val )
-            os << "complex "; 
-        else
-            os << "real ";
-        os << "general\n";
-        file << os.str();
-    }
-    
-    // Write the size line
-    // ===================
-    const Int m = A.Height();
-    const Int n = A.Width();
-    {
-        std::ostringstream os; 
-        os << m << " " << n << "\n";
-        file << os.str();
-    }
+    // Write the header and size line
+    // ==============================
+    file << MatrixMarketHeader<T>( A.Height(), A.Width() );
     
-    // Write the entries
-    // =================
-    for( Int j=0; j<n; ++j )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            std::ostringstream os;
-            os << A.GetRealPart(i,j);
-            if( IsComplex<T>::val )
-                os << " " << A.GetImagPart(i,j);
-            os << "\n";
-            file << os.str();
-        }
-    }
+    // Write the entries, one per line, in column-major order
+    // ======================================================
+    text::WriteRecords( file, A, true, true, '\n' );
+}
+
+// Each column is formatted as a fixed-width record by its owner in a 
+// [STAR,VR] distribution and written directly to its offset in the file
+template<typename T,Dist U,Dist V>
+inline void
+MatrixMarket( const DistMatrix<T,U,V>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::MatrixMarket"))
+    std::string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    DistMatrix<T,STAR,VR> A_STAR_VR( A.Grid() );
+    A_STAR_VR.Align( 0, 0 );
+    A_STAR_VR = A;
+
+    std::vector<char> buffer;
+    Int recordBytes;
+    text::FormatRecords
+    ( A_STAR_VR.LockedMatrix(), true, true, '\n', buffer, recordBytes );
+    text::WriteRecords
+    ( filename, MatrixMarketHeader<T>( A.Height(), A.Width() ), "", 
+      A.Width(), recordBytes, A_STAR_VR.RowShift(), A_STAR_VR.RowStride(), 
+      buffer, A.Grid().ViewingComm() );
 }
 
 } // namespace write
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_WRITE_SHARDED_HPP
+#define EL_WRITE_SHARDED_HPP
+
+#include "../Sharded.hpp"
+
+namespace El {
+namespace write {
+
+// Each process independently writes its own shard (and the root also writes
+// the index); the only communication is agreement on whether every file
+// could be opened and written, which also ensures that the checkpoint is
+// complete when any process returns
+template<typename T,Dist U,Dist V>
+inline void
+Sharded( const DistMatrix<T,U,V>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::Sharded"))
+    using namespace sharded;
+    const std::string indexName = 
+        basename + "." + FileExtension(BINARY_SHARDED);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    // Only one copy of each redundantly-stored entry is written
+    const bool owner = A.Participating() && A.RedundantRank() == 0;
+    HeaderInt header[NUM_HEADER_FIELDS];
+    FillHeader( A, commRank, commSize, owner, header );
+
+    // A process which cannot open its files must not throw on its own, as the
+    // others would then wait forever, so the open status is agreed upon first
+    std::ofstream index;
+    std::string failedName;
+    if( commRank == 0 )
+    {
+        index.open( indexName.c_str(), std::ios::binary );
+        if( !index.is_open() )
+            failedName = indexName;
+    }
+    const std::string shardName = ShardName( indexName, commRank );
+    std::ofstream file( shardName.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        failedName = shardName;
+    const int opened = failedName.empty();
+    if( !mpi::AllReduce( opened, mpi::MIN, comm ) )
+    {
+        if( opened )
+            RuntimeError
+            ("Another process could not open its part of ",indexName);
+        else
+            RuntimeError("Could not open ",failedName);
+    }
+
+    if( commRank == 0 )
+    {
+        index.write( (const char*)header, HEADER_BYTES );
+        index.close();
+        if( index.fail() )
+            failedName = indexName;
+    }
+    file.write( (const char*)header, HEADER_BYTES );
+    if( owner )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        if( localHeight == A.LDim() )
+            file.write
+            ( (const char*)A.LockedBuffer(), 
+              localHeight*localWidth*sizeof(T) );
+        else
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                file.write
+                ( (const char*)A.LockedBuffer(0,jLoc), 
+                  localHeight*sizeof(T) );
+    }
+    file.close();
+    if( file.fail() )
+        failedName = shardName;
+
+    // The reduction doubles as the barrier which guarantees that the 
+    // checkpoint is complete when any process returns
+    const int written = failedName.empty();
+    if( !mpi::AllReduce( written, mpi::MIN, comm ) )
+    {
+        if( written )
+            RuntimeError
+            ("Another process could not write its part of ",indexName);
+        else
+            RuntimeError("Could not write ",failedName);
+    }
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_SHARDED_HPP
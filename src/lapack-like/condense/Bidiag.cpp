@@ -8,9 +8,11 @@
 */
 #include "El.hpp"
 
+#include "./BulgeReflectors.hpp"
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/L.hpp"
 #include "./Bidiag/U.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -99,7 +101,30 @@ void Bidiag( DistMatrix<F>& A )
   template void bidiag::ApplyP \
   ( LeftOrRight side, Orientation orientation, \
     const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, \
-          DistMatrix<F>& B );
+          DistMatrix<F>& B ); \
+  template void bidiag::TwoStage \
+  ( Matrix<F>& A, Matrix<F>& tP, Matrix<F>& tQ, \
+    BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ ); \
+  template void bidiag::TwoStage \
+  ( DistMatrix<F>& A, \
+    DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ, \
+    BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ ); \
+  template void bidiag::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const Matrix<F>& A, const Matrix<F>& t, \
+    const BulgeReflectors<F>& bulge, Matrix<F>& B ); \
+  template void bidiag::ApplyQ \
+  ( LeftOrRight side, Orientation orientation, \
+    const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, \
+    const BulgeReflectors<F>& bulge, DistMatrix<F>& B ); \
+  template void bidiag::ApplyP \
+  ( LeftOrRight side, Orientation orientation, \
+    const Matrix<F>& A, const Matrix<F>& t, \
+    const BulgeReflectors<F>& bulge, Matrix<F>& B ); \
+  template void bidiag::ApplyP \
+  ( LeftOrRight side, Orientation orientation, \
+    const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, \
+    const BulgeReflectors<F>& bulge, DistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
@@ -101,6 +101,124 @@ void ApplyP
     ApplyP( side, orientation, A, tDiag, B );
 }
 
+// Q = Q1 Q2, where Q1 is from the dense-to-band stage and Q2 only acts on
+// the leading n rows (or columns)
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation, 
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeReflectors<F>& bulge,
+  Matrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::ApplyQ"))
+    if( A.Height() < A.Width() )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        ApplyP( side, orientation, AAdj, t, bulge, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const Int n = A.Width();
+    auto BLead = 
+      ( onLeft ? View( B, 0, 0, n, B.Width() ) : View( B, 0, 0, B.Height(), n ) );
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, BLead );
+    ApplyQ( side, orientation, A, t, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, BLead );
+}
+
+// P = P1 P2, where P1 is from the dense-to-band stage
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation, 
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeReflectors<F>& bulge,
+  Matrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::ApplyP"))
+    if( A.Height() < A.Width() )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        ApplyQ( side, orientation, AAdj, t, bulge, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
+    const Int offset = bulge.bandwidth;
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+    if( t.Height() > 0 )
+        ApplyPackedReflectors
+        ( side, UPPER, HORIZONTAL, direction, conjugation, offset, A, t, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, Orientation orientation, 
+  const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, 
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::ApplyQ"))
+    if( A.Height() < A.Width() )
+    {
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        ApplyP( side, orientation, AAdj, t, bulge, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const Int n = A.Width();
+    auto BLead = 
+      ( onLeft ? View( B, 0, 0, n, B.Width() ) : View( B, 0, 0, B.Height(), n ) );
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, BLead );
+    ApplyQ( side, orientation, A, t, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, BLead );
+}
+
+template<typename F>
+void ApplyP
+( LeftOrRight side, Orientation orientation, 
+  const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, 
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::ApplyP"))
+    if( A.Height() < A.Width() )
+    {
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        ApplyQ( side, orientation, AAdj, t, bulge, B );
+        return;
+    }
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? UNCONJUGATED : CONJUGATED );
+    const Int offset = bulge.bandwidth;
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+    if( t.Height() > 0 )
+    {
+        DistMatrix<F,MD,STAR> tDiag(A.Grid());
+        tDiag.SetRoot( A.DiagonalRoot(offset) );
+        tDiag.AlignCols( A.DiagonalAlign(offset) );
+        tDiag = t;
+        ApplyPackedReflectors
+        ( side, UPPER, HORIZONTAL, direction, conjugation, offset, 
+          A, tDiag, B );
+    }
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+}
+
 } // namespace bidiag
 } // namespace El
 
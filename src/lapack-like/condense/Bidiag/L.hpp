@@ -38,7 +38,7 @@ inline void L( Matrix<F>& A, Matrix<F>& tP, Matrix<F>& tQ )
 
     Matrix<F> X, Y;
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Bidiag");
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -112,7 +112,7 @@ L( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ )
     DistMatrix<F,MC,  STAR> AB1_MC_STAR(g);
     DistMatrix<F,STAR,MR  > A1R_STAR_MR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Bidiag",g);
     for( Int k=0; k<m; k+=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -0,0 +1,401 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace bidiag {
+
+// Reduce a matrix which is at least as tall as it is wide to an upper band of
+// width b by alternating between the QR factorization of a column panel and
+// the LQ factorization (via the QR factorization of the adjoint) of the row
+// panel to its right. The left reflectors are stored below the diagonal, as
+// in the one-stage reduction, while the right reflector which annihilates
+// A(j,j+b+1:n-1) is stored above the b'th superdiagonal, with its implicit
+// unit entry in position (j,j+b).
+template<typename F>
+inline void
+DenseToBand( Matrix<F>& A, Matrix<F>& tP, Matrix<F>& tQ, Int b )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::DenseToBand"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    tQ.Resize( n, 1 );
+    tP.Resize( Max(n-b,0), 1 );
+
+    Matrix<F> tPan, X, XLow, XLowTrans, ARowNew;
+    Matrix<Base<F>> dPan;
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        auto APan   = ViewRange( A, k,    k,    m,    k+nb );
+        auto ARight = ViewRange( A, k,    k+nb, m,    n    );
+        auto ARow   = ViewRange( A, k,    k+nb, k+nb, n    );
+        auto A22    = ViewRange( A, k+nb, k+nb, m,    n    );
+        auto tQ1 = View( tQ, k, 0, nb, 1 );
+
+        // APan = Q R, with R left within the band. Since we need Q to be the
+        // product of the Householder reflectors, undo the normalization of R
+        QR( APan, tPan, dPan );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, APan );
+        tQ1 = tPan;
+        if( k+nb == n )
+            break;
+
+        // ARight := Q^H ARight
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, APan, tPan, ARight );
+
+        // ARow^H = Q R, so that ARow Q = R^H is lower trapezoidal and lies
+        // within the band. Since the right reflectors are applied as
+        // I - conj(tau) v v^H, store the conjugated scalings.
+        Adjoint( ARow, X );
+        QR( X, tPan, dPan );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, X );
+        auto tP1 = View( tP, k, 0, tPan.Height(), 1 );
+        tP1 = tPan;
+        Conjugate( tP1 );
+
+        // A22 := A22 Q
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, X, tPan, A22 );
+
+        // ARow := R^H, with the transposed reflectors stored to its right
+        XLow = X;
+        MakeTrapezoidal( LOWER, XLow, -1 );
+        MakeTriangular( UPPER, X );
+        Adjoint( X, ARowNew );
+        Transpose( XLow, XLowTrans );
+        Axpy( F(1), XLowTrans, ARowNew );
+        ARow = ARowNew;
+    }
+}
+
+template<typename F>
+inline void
+DenseToBand
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ,
+  Int b )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::DenseToBand"))
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    tQ.Resize( n, 1 );
+    tP.Resize( Max(n-b,0), 1 );
+
+    DistMatrix<F,MD,STAR> tPan(g);
+    DistMatrix<Base<F>,MD,STAR> dPan(g);
+    DistMatrix<F> X(g), XLow(g), XLowTrans(g), ARowNew(g);
+    for( Int k=0; k<n; k+=b )
+    {
+        const Int nb = Min(b,n-k);
+        auto APan   = ViewRange( A, k,    k,    m,    k+nb );
+        auto ARight = ViewRange( A, k,    k+nb, m,    n    );
+        auto ARow   = ViewRange( A, k,    k+nb, k+nb, n    );
+        auto A22    = ViewRange( A, k+nb, k+nb, m,    n    );
+        auto tQ1 = View( tQ, k, 0, nb, 1 );
+
+        // APan = Q R, with R left within the band. Since we need Q to be the
+        // product of the Householder reflectors, undo the normalization of R
+        QR( APan, tPan, dPan );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, APan );
+        tQ1 = tPan;
+        if( k+nb == n )
+            break;
+
+        // ARight := Q^H ARight
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, UNCONJUGATED, 0, APan, tPan, ARight );
+
+        // ARow^H = Q R, so that ARow Q = R^H is lower trapezoidal and lies
+        // within the band. Since the right reflectors are applied as
+        // I - conj(tau) v v^H, store the conjugated scalings.
+        X.AlignWith( A22 );
+        Adjoint( ARow, X );
+        QR( X, tPan, dPan );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, X );
+        auto tP1 = View( tP, k, 0, tPan.Height(), 1 );
+        tP1 = tPan;
+        Conjugate( tP1 );
+
+        // A22 := A22 Q
+        ApplyPackedReflectors
+        ( RIGHT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, X, tPan, A22 );
+
+        // ARow := R^H, with the transposed reflectors stored to its right
+        XLow = X;
+        MakeTrapezoidal( LOWER, XLow, -1 );
+        MakeTriangular( UPPER, X );
+        ARowNew.AlignWith( ARow );
+        Adjoint( X, ARowNew );
+        XLowTrans.AlignWith( ARow );
+        Transpose( XLow, XLowTrans );
+        Axpy( F(1), XLowTrans, ARowNew );
+        ARow = ARowNew;
+    }
+}
+
+// Copy the window A(iBeg:iEnd-1,jBeg:jEnd-1) out of (or back into) a band
+// matrix, where ABand(upper+i-j,j) holds A(i,j)
+template<typename F>
+inline void
+GetBandWindow
+( const Matrix<F>& ABand, Int upper,
+  Int iBeg, Int iEnd, Int jBeg, Int jEnd, Matrix<F>& Z )
+{
+    const Int lower = ABand.Height()-1-upper;
+    Zeros( Z, iEnd-iBeg, jEnd-jBeg );
+    for( Int j=jBeg; j<jEnd; ++j )
+        for( Int i=Max(iBeg,j-upper); i<Min(iEnd,j+lower+1); ++i )
+            Z.Set( i-iBeg, j-jBeg, ABand.Get(upper+i-j,j) );
+}
+
+template<typename F>
+inline void
+SetBandWindow
+( Matrix<F>& ABand, Int upper,
+  Int iBeg, Int iEnd, Int jBeg, Int jEnd, const Matrix<F>& Z )
+{
+    const Int lower = ABand.Height()-1-upper;
+    for( Int j=jBeg; j<jEnd; ++j )
+        for( Int i=Max(iBeg,j-upper); i<Min(iEnd,j+lower+1); ++i )
+            ABand.Set( upper+i-j, j, Z.Get(i-iBeg,j-jBeg) );
+}
+
+// Reduce an upper band matrix to real upper bidiagonal form by chasing bulges
+// with short Householder reflectors. ABand(2*bandwidth+i-j,j) holds A(i,j),
+// and ABand must have room for 2*bandwidth superdiagonals and bandwidth
+// subdiagonals to hold the bulges. The right reflectors are returned in
+// bulgeP and the left reflectors in bulgeQ, so that the band matrix equals
+// Q2 B P2^H. The sweeps are chased in a pipeline over the processes of comm
+// (see ChaseBulges), each of which only keeps the reflectors of its own
+// sweeps.
+template<typename F>
+inline void
+BandToBidiag
+( Matrix<F>& ABand, Matrix<Base<F>>& d, Matrix<Base<F>>& e,
+  BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ, mpi::Comm comm )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("bidiag::BandToBidiag");
+        if( bulgeP.bandwidth != bulgeQ.bandwidth )
+            LogicError("Bandwidths of bulge reflectors do not match");
+        if( ABand.Height() < 3*bulgeP.bandwidth+1 )
+            LogicError("ABand must have room for the bulges");
+    )
+    const Int n = ABand.Width();
+    const Int b = bulgeP.bandwidth;
+    const Int upper = 2*b;
+    const Int lower = ABand.Height()-1-upper;
+    bulgeP.groupSize = bulgeQ.groupSize = b;
+    bulgeP.numOwners = bulgeQ.numOwners = mpi::Size( comm );
+
+    // Step k of sweep i annihilates A(r,c+1:c+len-1), where c = i+1+k*b and
+    // r is i in the first step and c-b afterwards, with a right reflector
+    // acting on columns [c,c+len). The following left reflector annihilates
+    // the first column of the resulting bulge, A(c+1:c+len-1,c), by acting
+    // on rows [c,c+len).
+    auto footprint = [&]( Int i, Int k )
+    {
+        const Int c = i+1+k*b;
+        const Int len = Min(b,n-c);
+        return std::pair<Int,Int>( Max(c-lower,0), Min(c+len+upper,n) );
+    };
+
+    std::vector<F> VPBuf, tPBuf, VQBuf, tQBuf;
+    bulgeP.sweeps.clear();
+    bulgeP.steps.clear();
+    bulgeP.offsets.clear();
+    bulgeQ.sweeps.clear();
+    bulgeQ.steps.clear();
+    bulgeQ.offsets.clear();
+    Matrix<F> Z, chi, x, v, z;
+    auto step = [&]( Int i, Int k )
+    {
+        const Int c = i+1+k*b;
+        const Int r = ( k == 0 ? i : c-b );
+        const Int len = Min(b,n-c);
+
+        // Right reflector
+        {
+            const Int iBeg = Max(c-upper,0);
+            const Int iEnd = Min(c+len+lower,n);
+            GetBandWindow( ABand, upper, iBeg, iEnd, c, c+len, Z );
+
+            // Find tau and v such that A(r,c:c+len-1) H = beta e0^T,
+            // where H = I - conj(tau) v v^H
+            auto aRow = ViewRange( Z, r-iBeg, 0, r-iBeg+1, len );
+            Copy( LockedViewRange( aRow, 0, 0, 1, 1   ), chi );
+            Copy( LockedViewRange( aRow, 0, 1, 1, len ), x   );
+            const F tauP = RightReflector( chi, x );
+            v.Resize( len, 1 );
+            v.Set( 0, 0, F(1) );
+            for( Int l=1; l<len; ++l )
+                v.Set( l, 0, x.Get(0,l-1) );
+
+            if( tauP != F(0) )
+            {
+                // Z := Z H
+                Zeros( z, Z.Height(), 1 );
+                Gemv( NORMAL, F(1), Z, v, F(0), z );
+                Ger( -tauP, z, v, Z );
+                Zero( aRow );
+                aRow.Set( 0, 0, chi.Get(0,0) );
+                SetBandWindow( ABand, upper, iBeg, iEnd, c, c+len, Z );
+                PushBulgeReflector
+                ( i, k, c, Conj(tauP), v, bulgeP, tPBuf, VPBuf );
+            }
+        }
+
+        // Left reflector
+        {
+            const Int jBeg = Max(c-lower,0);
+            const Int jEnd = Min(c+len+upper,n);
+            GetBandWindow( ABand, upper, c, c+len, jBeg, jEnd, Z );
+
+            // Find tau and v such that H A(c:c+len-1,c) = beta e0,
+            // where H = I - tau v v^H
+            auto aCol = ViewRange( Z, 0, c-jBeg, len, c-jBeg+1 );
+            Copy( LockedViewRange( aCol, 0, 0, 1,   1 ), chi );
+            Copy( LockedViewRange( aCol, 1, 0, len, 1 ), x   );
+            const F tauQ = LeftReflector( chi, x );
+            v.Resize( len, 1 );
+            v.Set( 0, 0, F(1) );
+            for( Int l=1; l<len; ++l )
+                v.Set( l, 0, x.Get(l-1,0) );
+
+            if( tauQ != F(0) )
+            {
+                // Z := H Z
+                Zeros( z, Z.Width(), 1 );
+                Gemv( ADJOINT, F(1), Z, v, F(0), z );
+                Ger( -tauQ, v, z, Z );
+                Zero( aCol );
+                aCol.Set( 0, 0, chi.Get(0,0) );
+                SetBandWindow( ABand, upper, c, c+len, jBeg, jEnd, Z );
+                PushBulgeReflector( i, k, c, tauQ, v, bulgeQ, tQBuf, VQBuf );
+            }
+        }
+
+        // A single-row reflector is a scaling, which creates no bulge
+        return len > 1 && c+b < n;
+    };
+    ChaseBulges( ABand, Max(n-1,0), b, footprint, step, comm );
+    FormBulgeReflectors( tPBuf, VPBuf, bulgeP );
+    FormBulgeReflectors( tQBuf, VQBuf, bulgeQ );
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,0), 1 );
+    for( Int j=0; j<n; ++j )
+        d.Set( j, 0, RealPart(ABand.Get(upper,j)) );
+    for( Int j=0; j<n-1; ++j )
+        e.Set( j, 0, RealPart(ABand.Get(upper-1,j+1)) );
+}
+
+template<typename F>
+inline void
+TwoStage
+( Matrix<F>& A, Matrix<F>& tP, Matrix<F>& tQ,
+  BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ )
+{
+    DEBUG_ONLY(CallStackEntry cse("bidiag::TwoStage"))
+    if( A.Height() < A.Width() )
+    {
+        // A^H = Q B P^H implies that A = P B^H Q^H
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStage( AAdj, tQ, tP, bulgeQ, bulgeP );
+        Adjoint( AAdj, A );
+        return;
+    }
+    const Int n = A.Width();
+    const Int b = Max(Min(Blocksize<F>("BidiagTwoStage"),n-1),1);
+    bulgeP.bandwidth = b;
+    bulgeQ.bandwidth = b;
+    DenseToBand( A, tP, tQ, b );
+
+    Matrix<F> ABand;
+    Zeros( ABand, 3*b+1, n );
+    for( Int offset=0; offset<=Min(b,n-1); ++offset )
+    {
+        auto diag = A.GetDiagonal( offset );
+        for( Int j=0; j<n-offset; ++j )
+            ABand.Set( 2*b-offset, j+offset, diag.Get(j,0) );
+    }
+    Matrix<Base<F>> d, e;
+    BandToBidiag( ABand, d, e, bulgeP, bulgeQ, mpi::COMM_SELF );
+
+    for( Int j=0; j<n; ++j )
+        A.Set( j, j, d.Get(j,0) );
+    for( Int j=0; j<n-1; ++j )
+        A.Set( j, j+1, e.Get(j,0) );
+    for( Int offset=2; offset<=Min(b,n-1); ++offset )
+        SetDiagonal( A, F(0), offset );
+}
+
+template<typename F>
+inline void
+TwoStage
+( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ,
+  BulgeReflectors<F>& bulgeP, BulgeReflectors<F>& bulgeQ )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("bidiag::TwoStage");
+        if( A.Grid() != tP.Grid() || tP.Grid() != tQ.Grid() )
+            LogicError("Process grids do not match");
+    )
+    if( A.Height() < A.Width() )
+    {
+        // A^H = Q B P^H implies that A = P B^H Q^H
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        TwoStage( AAdj, tQ, tP, bulgeQ, bulgeP );
+        Adjoint( AAdj, A );
+        return;
+    }
+    ProfileRegion region("bidiag::TwoStage");
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+    const Int b = Max(Min(Blocksize<F>("BidiagTwoStage",g),n-1),1);
+    bulgeP.bandwidth = b;
+    bulgeQ.bandwidth = b;
+    DenseToBand( A, tP, tQ, b );
+
+    // Every process gathers the O(n b) band, and then the sweeps are chased
+    // in a pipeline over the processes, so that each stores and applies
+    // roughly 1/p of the O(n^2) bulge reflectors
+    Matrix<F> ABand;
+    Zeros( ABand, 3*b+1, n );
+    DistMatrix<F,STAR,STAR> diag_STAR_STAR(g);
+    for( Int offset=0; offset<=Min(b,n-1); ++offset )
+    {
+        auto diag = A.GetDiagonal( offset );
+        diag_STAR_STAR = diag;
+        for( Int j=0; j<n-offset; ++j )
+            ABand.Set( 2*b-offset, j+offset, diag_STAR_STAR.GetLocal(j,0) );
+    }
+    Matrix<Base<F>> d, e;
+    BandToBidiag( ABand, d, e, bulgeP, bulgeQ, g.Comm() );
+
+    for( Int j=0; j<n; ++j )
+        if( A.IsLocal(j,j) )
+            A.SetLocal( A.LocalRow(j), A.LocalCol(j), d.Get(j,0) );
+    for( Int j=0; j<n-1; ++j )
+        if( A.IsLocal(j,j+1) )
+            A.SetLocal( A.LocalRow(j), A.LocalCol(j+1), e.Get(j,0) );
+    for( Int offset=2; offset<=Min(b,n-1); ++offset )
+        SetDiagonal( A, F(0), offset );
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
@@ -36,7 +36,7 @@ inline void U( Matrix<F>& A, Matrix<F>& tP, Matrix<F>& tQ )
 
     Matrix<F> X, Y;
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Bidiag");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -108,7 +108,7 @@ U( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& tP, DistMatrix<F,STAR,STAR>& tQ )
     DistMatrix<F,MC,  STAR> AB1_MC_STAR(g);
     DistMatrix<F,STAR,MR  > A1R_STAR_MR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Bidiag",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -0,0 +1,430 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CONDENSE_BULGEREFLECTORS_HPP
+#define EL_CONDENSE_BULGEREFLECTORS_HPP
+
+namespace El {
+
+// Chase the bulges of sweeps 0, 1, ..., numSweeps-1 through the band matrix
+// ABand, where the j'th sweep consists of calls step(j,0), step(j,1), ...
+// until one returns false, and footprint(j,k) returns the half-open range of
+// columns of ABand which are read or written by step(j,k). The footprints of
+// each sweep must move to the right, and those of the first steps of the
+// sweeps must be nondecreasing.
+//
+// The sweeps are split into groups of groupSize consecutive sweeps, and
+// group g is chased by process g mod p of comm. A process works on all of
+// the sweeps of its group at once: a step is executed as soon as the columns
+// it touches have been passed on by the previous group and will no longer be
+// touched by the earlier sweeps of its own group. Finished columns are sent
+// on to the owner of the next group in chunks of groupSize columns, so that
+// the groups form a pipeline. Since each step is applied to the same data as
+// in the sequential ordering, the result is identical. On exit, every
+// process holds the final band, which requires that ABand.LDim() equal
+// ABand.Height().
+template<typename F,class Footprint,class Step>
+inline void
+ChaseBulges
+( Matrix<F>& ABand, Int numSweeps, Int groupSize,
+  Footprint footprint, Step step, mpi::Comm comm )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ChaseBulges");
+        if( ABand.LDim() != ABand.Height() )
+            LogicError("ABand must be contiguous");
+    )
+    const Int n = ABand.Width();
+    const Int bandHeight = ABand.Height();
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    const Int numGroups = (numSweeps+groupSize-1) / groupSize;
+    if( commSize == 1 )
+    {
+        for( Int j=0; j<numSweeps; ++j )
+            for( Int k=0; step(j,k); ++k );
+        return;
+    }
+    if( numGroups == 0 )
+        return;
+
+    // Group g finalizes the columns [groupBeg(g),groupBeg(g+1))
+    auto groupBeg = [&]( Int g )
+    { return ( g < numGroups ? footprint(g*groupSize,0).first : n ); };
+    const Int prev = (commRank+commSize-1) % commSize;
+    const Int next = (commRank+1) % commSize;
+
+    std::vector<Int> nextSteps;
+    std::vector<std::vector<F>> sendBufs;
+    std::vector<mpi::Request> requests;
+    std::vector<F> recvBuf;
+    std::vector<bool> finalCols( n, false );
+    for( Int g=commRank; g<numGroups; g+=commSize )
+    {
+        const Int firstSweep = g*groupSize;
+        const Int lastSweep = Min(firstSweep+groupSize,numSweeps);
+        const Int colBeg = groupBeg( g );
+        const Int nextColBeg = groupBeg( g+1 );
+        for( Int j=colBeg; j<nextColBeg; ++j )
+            finalCols[j] = true;
+
+        // Columns [colBeg,recvEnd) are up-to-date with the previous groups
+        // and [nextColBeg,sendEnd) have been passed on to the next group
+        Int recvEnd = ( g == 0 ? n : colBeg );
+        Int sendEnd = ( g == numGroups-1 ? n : nextColBeg );
+        nextSteps.assign( lastSweep-firstSweep, 0 );
+        Int numUnfinished = lastSweep-firstSweep;
+        while( numUnfinished > 0 || recvEnd < n || sendEnd < n )
+        {
+            // Advance each sweep as far as possible. Since the sweeps move
+            // to the right, the earliest column which an unfinished sweep
+            // can still touch is that of its next step.
+            bool progress = false;
+            Int minCol = n;
+            for( Int j=firstSweep; j<lastSweep; ++j )
+            {
+                Int& k = nextSteps[j-firstSweep];
+                if( k < 0 )
+                    continue;
+                while( true )
+                {
+                    const std::pair<Int,Int> cols = footprint( j, k );
+                    if( cols.second > Min(recvEnd,minCol) )
+                    {
+                        minCol = Min( minCol, cols.first );
+                        break;
+                    }
+                    progress = true;
+                    if( step( j, k ) )
+                    {
+                        ++k;
+                    }
+                    else
+                    {
+                        k = -1;
+                        --numUnfinished;
+                        break;
+                    }
+                }
+            }
+
+            // Pass on the chunks of columns which are no longer touched
+            const Int doneEnd = Min(recvEnd,minCol);
+            while( sendEnd < n && Min(sendEnd+groupSize,n) <= doneEnd )
+            {
+                const Int width = Min(groupSize,n-sendEnd);
+                const F* chunk = ABand.LockedBuffer(0,sendEnd);
+                sendBufs.emplace_back( chunk, chunk+width*bandHeight );
+                requests.emplace_back();
+                mpi::TaggedISend
+                ( sendBufs.back().data(), width*bandHeight, next, 0, comm,
+                  requests.back() );
+                sendEnd += width;
+                progress = true;
+            }
+
+            // Otherwise wait for the next chunk from the previous group
+            if( !progress )
+            {
+                if( recvEnd == n )
+                    LogicError("Bulge chasing stalled");
+                const Int width = Min(groupSize,n-recvEnd);
+                recvBuf.resize( width*bandHeight );
+                mpi::TaggedRecv
+                ( recvBuf.data(), width*bandHeight, prev, 0, comm );
+                MemCopy
+                ( ABand.Buffer(0,recvEnd), recvBuf.data(), width*bandHeight );
+                recvEnd += width;
+            }
+        }
+        if( requests.size() > 0 )
+            mpi::WaitAll( requests.size(), requests.data() );
+        requests.clear();
+        sendBufs.clear();
+    }
+
+    // Combine the columns finalized by each process
+    for( Int j=0; j<n; ++j )
+        if( !finalCols[j] )
+            MemZero( ABand.Buffer(0,j), bandHeight );
+    mpi::AllReduce( ABand.Buffer(), bandHeight*n, comm );
+}
+
+// Record the reflector generated by step 'step' of sweep 'sweep', which acts
+// on the indices [offset,offset+v.Height()) with H = I - tau v v^H
+template<typename F>
+inline void
+PushBulgeReflector
+( Int sweep, Int step, Int offset, F tau, const Matrix<F>& v,
+  BulgeReflectors<F>& bulge, std::vector<F>& tBuf, std::vector<F>& VBuf )
+{
+    const Int b = bulge.bandwidth;
+    bulge.sweeps.push_back( sweep );
+    bulge.steps.push_back( step );
+    bulge.offsets.push_back( offset );
+    tBuf.push_back( tau );
+    for( Int i=0; i<b; ++i )
+        VBuf.push_back( i<v.Height() ? v.Get(i,0) : F(0) );
+}
+
+// Sort the recorded reflectors by group, then step, then sweep, and store
+// them in bulge.V and bulge.t
+template<typename F>
+inline void
+FormBulgeReflectors
+( const std::vector<F>& tBuf, const std::vector<F>& VBuf,
+  BulgeReflectors<F>& bulge )
+{
+    const Int b = bulge.bandwidth;
+    const Int groupSize = bulge.groupSize;
+    const Int numReflectors = tBuf.size();
+    std::vector<Int> order( numReflectors );
+    for( Int j=0; j<numReflectors; ++j )
+        order[j] = j;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( Int i, Int j )
+      {
+          const Int iGroup = bulge.sweeps[i] / groupSize;
+          const Int jGroup = bulge.sweeps[j] / groupSize;
+          if( iGroup != jGroup )
+              return iGroup < jGroup;
+          if( bulge.steps[i] != bulge.steps[j] )
+              return bulge.steps[i] < bulge.steps[j];
+          return bulge.sweeps[i] < bulge.sweeps[j];
+      } );
+
+    const std::vector<Int> sweeps( bulge.sweeps ), steps( bulge.steps ),
+                           offsets( bulge.offsets );
+    bulge.V.Resize( b, numReflectors );
+    bulge.t.Resize( numReflectors, 1 );
+    for( Int j=0; j<numReflectors; ++j )
+    {
+        const Int jOld = order[j];
+        bulge.sweeps[j] = sweeps[jOld];
+        bulge.steps[j] = steps[jOld];
+        bulge.offsets[j] = offsets[jOld];
+        bulge.t.Set( j, 0, tBuf[jOld] );
+        for( Int i=0; i<b; ++i )
+            bulge.V.Set( i, j, VBuf[i+jOld*b] );
+    }
+}
+
+// Apply Q2 = H_0^H H_1^H ... H_{k-1}^H, the product of the reflectors from the
+// bulge-chasing stage of a two-stage reduction (in the order in which they
+// were generated).
+//
+// Since the reflectors from a later sweep commute with those from later steps
+// of earlier sweeps, the reflectors of each group can be reordered so that
+// those from the same step are consecutive. Each such block acts on at most
+// bandwidth+groupSize-1 consecutive indices and is applied as
+// I - V inv(S) V^H with level 3 operations, where S = triu(V^H V) with the
+// diagonal set to the inverses of the conjugated scalings.
+template<typename F>
+inline void
+ApplyBulgeReflectors
+( LeftOrRight side, Orientation orientation,
+  const BulgeReflectors<F>& bulge, Matrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("ApplyBulgeReflectors"))
+    if( bulge.numOwners != 1 )
+        LogicError("Distributed bulge reflectors require a DistMatrix");
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const bool backward = (normal==onLeft);
+    const Orientation triOrient = ( normal ? NORMAL : ADJOINT );
+    const Int n = ( onLeft ? B.Height() : B.Width() );
+    const Int b = bulge.bandwidth;
+    const Int groupSize = bulge.groupSize;
+    const Int numReflectors = bulge.offsets.size();
+
+    // Split the reflectors into blocks with the same group and step
+    std::vector<Int> blockBegs, groupBegs;
+    for( Int j=0; j<numReflectors; ++j )
+    {
+        const bool newGroup =
+          ( j == 0 ||
+            bulge.sweeps[j]/groupSize != bulge.sweeps[j-1]/groupSize );
+        if( newGroup )
+            groupBegs.push_back( blockBegs.size() );
+        if( newGroup || bulge.steps[j] != bulge.steps[j-1] )
+            blockBegs.push_back( j );
+    }
+    const Int numBlocks = blockBegs.size();
+    const Int numGroups = groupBegs.size();
+    blockBegs.push_back( numReflectors );
+    groupBegs.push_back( numBlocks );
+
+    // Q2 is the product of the groups in increasing order, and each group is
+    // the product of its blocks in decreasing order of their step
+    Matrix<F> V, S, W;
+    for( Int gg=0; gg<numGroups; ++gg )
+    {
+        const Int g = ( backward ? numGroups-1-gg : gg );
+        const Int numGroupBlocks = groupBegs[g+1]-groupBegs[g];
+        for( Int ll=0; ll<numGroupBlocks; ++ll )
+        {
+            const Int l =
+              ( backward ? groupBegs[g]+ll : groupBegs[g+1]-1-ll );
+            const Int jBeg = blockBegs[l];
+            const Int jEnd = blockBegs[l+1];
+            const Int nb = jEnd-jBeg;
+            const Int sBeg = bulge.offsets[jBeg];
+            Int sEnd = sBeg;
+            for( Int j=jBeg; j<jEnd; ++j )
+                sEnd = Max( sEnd, bulge.offsets[j]+Min(b,n-bulge.offsets[j]) );
+
+            Zeros( V, sEnd-sBeg, nb );
+            for( Int j=jBeg; j<jEnd; ++j )
+            {
+                const Int s = bulge.offsets[j];
+                const Int len = Min(b,n-s);
+                for( Int i=0; i<len; ++i )
+                    V.Set( s-sBeg+i, j-jBeg, bulge.V.Get(i,j) );
+            }
+            Zeros( S, nb, nb );
+            Herk( UPPER, ADJOINT, F(1), V, F(0), S );
+            for( Int j=0; j<nb; ++j )
+                S.Set( j, j, F(1)/Conj(bulge.t.Get(jBeg+j,0)) );
+
+            if( onLeft )
+            {
+                auto BRows = ViewRange( B, sBeg, 0, sEnd, B.Width() );
+                Gemm( ADJOINT, NORMAL, F(1), V, BRows, W );
+                Trsm( LEFT, UPPER, triOrient, NON_UNIT, F(1), S, W );
+                Gemm( NORMAL, NORMAL, F(-1), V, W, F(1), BRows );
+            }
+            else
+            {
+                auto BCols = ViewRange( B, 0, sBeg, B.Height(), sEnd );
+                Gemm( NORMAL, NORMAL, F(1), BCols, V, W );
+                Trsm( RIGHT, UPPER, triOrient, NON_UNIT, F(1), S, W );
+                Gemm( NORMAL, ADJOINT, F(-1), W, V, F(1), BCols );
+            }
+        }
+    }
+}
+
+// Broadcast the reflectors of the given group from the process which holds
+// them (group mod bulge.numOwners) into groupBulge
+template<typename F>
+inline void
+BroadcastBulgeGroup
+( const BulgeReflectors<F>& bulge, Int group, BulgeReflectors<F>& groupBulge,
+  mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("BroadcastBulgeGroup"))
+    const Int b = bulge.bandwidth;
+    const Int groupSize = bulge.groupSize;
+    const Int owner = group % bulge.numOwners;
+    groupBulge.bandwidth = b;
+    groupBulge.groupSize = groupSize;
+    groupBulge.numOwners = 1;
+
+    Int numReflectors;
+    std::vector<Int> indices;
+    if( mpi::Rank(comm) == owner )
+    {
+        // The locally held reflectors are sorted by group
+        const auto sweepBeg = bulge.sweeps.begin();
+        const auto sweepEnd = bulge.sweeps.end();
+        const Int jBeg =
+          std::partition_point
+          ( sweepBeg, sweepEnd,
+            [&]( Int sweep ) { return sweep/groupSize < group; } ) - sweepBeg;
+        const Int jEnd =
+          std::partition_point
+          ( sweepBeg, sweepEnd,
+            [&]( Int sweep ) { return sweep/groupSize <= group; } ) - sweepBeg;
+        numReflectors = jEnd-jBeg;
+        indices.resize( 3*numReflectors );
+        for( Int j=0; j<numReflectors; ++j )
+        {
+            indices[3*j  ] = bulge.sweeps[jBeg+j];
+            indices[3*j+1] = bulge.steps[jBeg+j];
+            indices[3*j+2] = bulge.offsets[jBeg+j];
+        }
+        Copy( LockedView( bulge.V, 0, jBeg, b, numReflectors ), groupBulge.V );
+        Copy( LockedView( bulge.t, jBeg, 0, numReflectors, 1 ), groupBulge.t );
+    }
+    mpi::Broadcast( numReflectors, owner, comm );
+    indices.resize( 3*numReflectors );
+    groupBulge.V.Resize( b, numReflectors );
+    groupBulge.t.Resize( numReflectors, 1 );
+    if( numReflectors > 0 )
+    {
+        mpi::Broadcast( indices.data(), 3*numReflectors, owner, comm );
+        mpi::Broadcast( groupBulge.V.Buffer(), b*numReflectors, owner, comm );
+        mpi::Broadcast( groupBulge.t.Buffer(), numReflectors, owner, comm );
+    }
+
+    groupBulge.sweeps.resize( numReflectors );
+    groupBulge.steps.resize( numReflectors );
+    groupBulge.offsets.resize( numReflectors );
+    for( Int j=0; j<numReflectors; ++j )
+    {
+        groupBulge.sweeps[j] = indices[3*j];
+        groupBulge.steps[j] = indices[3*j+1];
+        groupBulge.offsets[j] = indices[3*j+2];
+    }
+}
+
+// Q2 is applied to whole rows (or columns) of B, which are spread over all
+// processes. Unless every process holds all of the reflectors, each group of
+// reflectors is broadcast from its owner in turn.
+template<typename F>
+inline void
+ApplyBulgeReflectors
+( LeftOrRight side, Orientation orientation,
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("ApplyBulgeReflectors"))
+    const Grid& g = B.Grid();
+    mpi::Comm comm = g.Comm();
+    if( bulge.numOwners != 1 && bulge.numOwners != mpi::Size(comm) )
+        LogicError("Bulge reflectors were not distributed over this grid");
+    const bool backward = ( (orientation==NORMAL) == (side==LEFT) );
+
+    DistMatrix<F,STAR,VR> B_STAR_VR(g);
+    DistMatrix<F,VC,STAR> B_VC_STAR(g);
+    if( side == LEFT )
+        B_STAR_VR = B;
+    else
+        B_VC_STAR = B;
+    Matrix<F>& BLoc =
+      ( side == LEFT ? B_STAR_VR.Matrix() : B_VC_STAR.Matrix() );
+
+    if( bulge.numOwners == 1 )
+    {
+        ApplyBulgeReflectors( side, orientation, bulge, BLoc );
+    }
+    else
+    {
+        const Int numLocalGroups =
+          ( bulge.sweeps.size() > 0 ? bulge.sweeps.back()/bulge.groupSize+1
+                                    : 0 );
+        const Int numGroups = mpi::AllReduce( numLocalGroups, mpi::MAX, comm );
+        BulgeReflectors<F> groupBulge;
+        for( Int gg=0; gg<numGroups; ++gg )
+        {
+            const Int group = ( backward ? numGroups-1-gg : gg );
+            BroadcastBulgeGroup( bulge, group, groupBulge, comm );
+            ApplyBulgeReflectors( side, orientation, groupBulge, BLoc );
+        }
+    }
+
+    if( side == LEFT )
+        B = B_STAR_VR;
+    else
+        B = B_VC_STAR;
+}
+
+} // namespace El
+
+#endif // ifndef EL_CONDENSE_BULGEREFLECTORS_HPP
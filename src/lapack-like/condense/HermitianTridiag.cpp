@@ -13,6 +13,8 @@
 #include "./HermitianTridiag/U.hpp"
 #include "./HermitianTridiag/USquare.hpp"
 
+#include "./BulgeReflectors.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 #include "./HermitianTridiag/ApplyQ.hpp"
 
 namespace El {
@@ -39,6 +41,109 @@ void HermitianTridiag( UpperOrLower uplo, Matrix<F>& A )
         MakeTrapezoidal( UPPER, A, -1 );
 }
 
+namespace herm_tridiag {
+
+// A simple alpha-beta-gamma model of the time spent by each process when
+// tridiagonalizing an n x n matrix with the pipelined algorithm on the full
+// (possibly rectangular) r x c grid versus redistributing onto the largest 
+// square subgrid, running the square algorithm there, and redistributing 
+// back. The machine parameters are expressed relative to the time of a single
+// flop and are only meant to capture the relative costs of latency, bandwidth,
+// and computation on a typical cluster.
+template<typename F>
+bool UseSquareSubgrid( Int n, const Grid& g )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag::UseSquareSubgrid"))
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int pSqrt = Int(sqrt(double(p)));
+    if( r == c )
+        return false;
+
+    const double alpha = 1e4;
+    const double beta = 50;
+    const double flopScale = ( IsComplex<F>::val ? 4 : 1 );
+    const double wordScale = ( IsComplex<F>::val ? 2 : 1 );
+    const double nd = n;
+    const double flops = flopScale*4*nd*nd*nd/3;
+    const double panelWords = wordScale*nd*nd/2;
+    const double logR = std::log(double(r))/std::log(2.);
+    const double logC = std::log(double(c))/std::log(2.);
+    const double logSqrt = std::log(double(pSqrt))/std::log(2.);
+
+    // Each column of the pipelined algorithm requires a broadcast within the 
+    // process row, an [MC,* ] -> [MR,* ] transpose, an AllReduce and a
+    // ReduceScatter within the process column, a permutation, and a Reduce 
+    // within the process row
+    const double rectTime = 
+        flops/p + 
+        alpha*nd*(2*logC+4*logR+2) + 
+        beta*panelWords*(2./r+3./c+1./p);
+
+    // The square algorithm replaces the transposes with pairwise exchanges
+    // but leaves p-pSqrt^2 processes idle and requires two redistributions
+    const double squareTime = 
+        flops/(pSqrt*pSqrt) + 
+        alpha*nd*(4*logSqrt+3) + 
+        beta*panelWords*(4./pSqrt) +
+        2*(alpha*p + beta*wordScale*nd*nd/(pSqrt*pSqrt));
+
+    return squareTime < rectTime;
+}
+
+template<typename F>
+void SquareSubgrid
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
+  GridOrder order )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag::SquareSubgrid"))
+    const Grid& g = A.Grid();
+    const Int p = g.Size();
+    const Int pSqrt = Int(sqrt(double(p)));
+
+    std::vector<int> squareRanks(pSqrt*pSqrt);
+    if( order == g.Order() )
+    {
+        for( Int j=0; j<pSqrt; ++j )
+            for( Int i=0; i<pSqrt; ++i )
+                squareRanks[i+j*pSqrt] = i+j*pSqrt;
+    }
+    else
+    {
+        for( Int j=0; j<pSqrt; ++j )
+            for( Int i=0; i<pSqrt; ++i )
+                squareRanks[i+j*pSqrt] = j+i*pSqrt;
+    }
+
+    mpi::Group owningGroup = g.OwningGroup();
+    mpi::Group squareGroup;
+    mpi::Incl
+    ( owningGroup, squareRanks.size(), squareRanks.data(), squareGroup );
+
+    mpi::Comm viewingComm = g.ViewingComm();
+    const Grid squareGrid( viewingComm, squareGroup, pSqrt );
+    DistMatrix<F> ASquare(squareGrid);
+    DistMatrix<F,STAR,STAR> tSquare(squareGrid);
+
+    // Perform the fast tridiagonalization on the square grid
+    ASquare = A;
+    if( ASquare.Participating() )
+    {
+        if( uplo == LOWER )
+            LSquare( ASquare, tSquare );
+        else
+            USquare( ASquare, tSquare ); 
+    }
+    tSquare.MakeConsistent( true );
+    A = ASquare;
+    t = tSquare;
+
+    mpi::Free( squareGroup );
+}
+
+} // namespace herm_tridiag
+
 template<typename F> 
 void HermitianTridiag
 ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
@@ -57,52 +162,13 @@ void HermitianTridiag
     else if( ctrl.approach == HERMITIAN_TRIDIAG_SQUARE )
     {
         // Drop down to a square mesh 
-        const Int p = g.Size();
-        const Int pSqrt = Int(sqrt(double(p)));
-
-        std::vector<int> squareRanks(pSqrt*pSqrt);
-        if( ctrl.order == g.Order() )
-        {
-            for( Int j=0; j<pSqrt; ++j )
-                for( Int i=0; i<pSqrt; ++i )
-                    squareRanks[i+j*pSqrt] = i+j*pSqrt;
-        }
-        else
-        {
-            for( Int j=0; j<pSqrt; ++j )
-                for( Int i=0; i<pSqrt; ++i )
-                    squareRanks[i+j*pSqrt] = j+i*pSqrt;
-        }
-
-        mpi::Group owningGroup = g.OwningGroup();
-        mpi::Group squareGroup;
-        mpi::Incl
-        ( owningGroup, squareRanks.size(), squareRanks.data(), squareGroup );
-
-        mpi::Comm viewingComm = g.ViewingComm();
-        const Grid squareGrid( viewingComm, squareGroup, pSqrt );
-        DistMatrix<F> ASquare(squareGrid);
-        DistMatrix<F,STAR,STAR> tSquare(squareGrid);
-
-        // Perform the fast tridiagonalization on the square grid
-        ASquare = A;
-        if( ASquare.Participating() )
-        {
-            if( uplo == LOWER )
-                herm_tridiag::LSquare( ASquare, tSquare );
-            else
-                herm_tridiag::USquare( ASquare, tSquare ); 
-        }
-        tSquare.MakeConsistent( true );
-        A = ASquare;
-        t = tSquare;
-
-        mpi::Free( squareGroup );
+        herm_tridiag::SquareSubgrid( uplo, A, t, ctrl.order );
     }
     else
     {
-        // Use the normal approach unless we're already on a square 
-        // grid, in which case we use the fast square method.
+        // Use the fast square method if we're already on a square grid and
+        // otherwise let the cost model decide between running the pipelined
+        // algorithm on the full grid and dropping down to a square subgrid
         if( g.Height() == g.Width() )
         {
             if( uplo == LOWER )
@@ -110,6 +176,10 @@ void HermitianTridiag
             else
                 herm_tridiag::USquare( A, t ); 
         }
+        else if( herm_tridiag::UseSquareSubgrid<F>( A.Height(), g ) )
+        {
+            herm_tridiag::SquareSubgrid( uplo, A, t, ctrl.order );
+        }
         else
         {
             if( uplo == LOWER )
@@ -153,7 +223,21 @@ void HermitianTridiag
   template void herm_tridiag::ApplyQ \
   ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
     const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, \
-          DistMatrix<F>& B );
+          DistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t, \
+    BulgeReflectors<F>& bulge ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, \
+    BulgeReflectors<F>& bulge ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
+    const Matrix<F>& A, const Matrix<F>& t, \
+    const BulgeReflectors<F>& bulge, Matrix<F>& B ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, UpperOrLower uplo, Orientation orientation, \
+    const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, \
+    const BulgeReflectors<F>& bulge, DistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
@@ -59,6 +59,70 @@ void ApplyQ
     ApplyQ( side, uplo, orientation, A, tDiag, B );
 }
 
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation, 
+  const Matrix<F>& A, const Matrix<F>& t, const BulgeReflectors<F>& bulge,
+  Matrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag::ApplyQ"))
+    if( uplo == UPPER )
+    {
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        ApplyQ( side, LOWER, orientation, AAdj, t, bulge, B );
+        return;
+    }
+    // Q = Q1 Q2, where Q1 is from the dense-to-band stage
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const Int offset = -bulge.bandwidth;
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+    if( t.Height() > 0 )
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, offset, A, t, B );
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation, 
+  const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& t, 
+  const BulgeReflectors<F>& bulge, DistMatrix<F>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag::ApplyQ"))
+    if( uplo == UPPER )
+    {
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        ApplyQ( side, LOWER, orientation, AAdj, t, bulge, B );
+        return;
+    }
+    // Q = Q1 Q2, where Q1 is from the dense-to-band stage
+    const bool normal = (orientation==NORMAL);
+    const bool onLeft = (side==LEFT);
+    const ForwardOrBackward direction = ( normal==onLeft ? BACKWARD : FORWARD );
+    const Conjugation conjugation = ( normal ? CONJUGATED : UNCONJUGATED );
+    const Int offset = -bulge.bandwidth;
+    if( normal == onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+    if( t.Height() > 0 )
+    {
+        DistMatrix<F,MD,STAR> tDiag(A.Grid());
+        tDiag.SetRoot( A.DiagonalRoot(offset) );
+        tDiag.AlignCols( A.DiagonalAlign(offset) );
+        tDiag = t;
+        ApplyPackedReflectors
+        ( side, LOWER, VERTICAL, direction, conjugation, offset, A, tDiag, B );
+    }
+    if( normal != onLeft )
+        ApplyBulgeReflectors( side, orientation, bulge, B );
+}
+
 } // namespace herm_tridiag
 } // namespace El
 
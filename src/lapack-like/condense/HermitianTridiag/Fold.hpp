@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_FOLD_HPP
+#define EL_HERMITIANTRIDIAG_FOLD_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// On entry, p[MC,* ] and q[MR,* ] hold the unsummed local contributions of
+// the two halves of a local Hemv, so that p still requires a summation within
+// each process row and q within each process column. On exit, p[MC,* ] holds
+// contributions whose summation within each process row yields p+q.
+//
+// Rather than AllReducing all of q[MR,* ] within process columns and then
+// reducing a mostly-zero embedding of it into [MC,* ] within process rows,
+// we form q[VR,* ] with a ReduceScatter within process columns, permute it to
+// q[VC,* ] with a single SendRecv, and add it into our local portion of
+// p[MC,* ]. Each process then only communicates O(n/c + n/p) entries, and
+// every process of a rectangular grid takes part in the summation.
+template<typename F>
+void FoldPartialSums
+( DistMatrix<F,MR,STAR>& q_MR_STAR, DistMatrix<F,MC,STAR>& p_MC_STAR )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag::FoldPartialSums");
+        if( q_MR_STAR.Grid() != p_MC_STAR.Grid() )
+            LogicError("p and q must be distributed over the same grid");
+        if( q_MR_STAR.Height() != p_MC_STAR.Height() ||
+            q_MR_STAR.Width() != 1 || p_MC_STAR.Width() != 1 )
+            LogicError("p and q must be column vectors of the same height");
+    )
+    const Grid& g = p_MC_STAR.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int height = p_MC_STAR.Height();
+
+    // Any lifting of the [MR,* ] and [MC,* ] alignments to [VR,* ] and [VC,* ]
+    // alignments is consistent, so simply reuse them
+    const Int colAlignVR = q_MR_STAR.ColAlign();
+    const Int colAlignVC = p_MC_STAR.ColAlign();
+    const Int colShiftMR = q_MR_STAR.ColShift();
+    const Int colShiftMC = p_MC_STAR.ColShift();
+
+    const Int portionSize = mpi::Pad( MaxLength(height,p) );
+    std::vector<F> buffer( (r+1)*portionSize );
+    F* sendBuf = &buffer[0];
+    F* recvBuf = &buffer[r*portionSize];
+
+    // q[VR,* ] <- q[MR,* ] (summing within process columns)
+    {
+        const F* qBuffer = q_MR_STAR.Buffer();
+        for( Int row=0; row<r; ++row )
+        {
+            const Int shift = Shift(g.Col()+c*row,colAlignVR,p);
+            const Int offset = (shift-colShiftMR) / c;
+            const Int length = Length(height,shift,p);
+            F* data = &sendBuf[row*portionSize];
+            for( Int i=0; i<length; ++i )
+                data[i] = qBuffer[offset+i*r];
+        }
+        mpi::ReduceScatter( sendBuf, recvBuf, portionSize, g.ColComm() );
+    }
+
+    // q[VC,* ] <- q[VR,* ]
+    const Int shiftVR = Shift(g.VRRank(),colAlignVR,p);
+    const Int shiftVC = Shift(g.VCRank(),colAlignVC,p);
+    const Int sendLength = Length(height,shiftVR,p);
+    const Int recvLength = Length(height,shiftVC,p);
+    const Int sendRankCM = (g.VRRank()+(p+colAlignVC-colAlignVR)) % p;
+    const Int recvRankRM = (g.VCRank()+(p+colAlignVR-colAlignVC)) % p;
+    const Int recvRankCM = (recvRankRM/c)+r*(recvRankRM%c);
+    mpi::SendRecv
+    ( recvBuf, sendLength, sendRankCM,
+      sendBuf, recvLength, recvRankCM, g.VCComm() );
+
+    // p[MC,* ] += q[VC,* ]
+    const Int offset = (shiftVC-colShiftMC) / r;
+    F* pBuffer = p_MC_STAR.Buffer();
+    for( Int i=0; i<recvLength; ++i )
+        pBuffer[offset+i*c] += sendBuf[i];
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_FOLD_HPP
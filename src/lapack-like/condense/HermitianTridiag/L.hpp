@@ -9,6 +9,7 @@
 #ifndef EL_HERMITIANTRIDIAG_L_HPP
 #define EL_HERMITIANTRIDIAG_L_HPP
 
+#include "./Fold.hpp"
 #include "./LPan.hpp"
 
 namespace El {
@@ -63,6 +64,7 @@ void L( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
         if( A.Height() != A.Width() )
             LogicError("A must be square");
     )
+    ProfileRegion region("herm_tridiag::L");
     const Int n = A.Height();
     if( n == 0 )
     {
@@ -80,7 +82,7 @@ void L( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("HermitianTridiag",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k); 
@@ -43,6 +43,7 @@ void LPan
         if( !A.DiagonalAlignedWith(t,-1) )
             LogicError("t is not aligned with A's subdiagonal.");
     )
+    ProfileRegion region("herm_tridiag::LPan");
     typedef Base<F> Real;
     const Grid& g = A.Grid();
     const Int r = g.Height();
@@ -370,116 +371,46 @@ void LPan
         LocalGemv( ADJOINT, F(1), W20B, a21B_MC_STAR, F(0), x01_MR_STAR );
         LocalGemv( ADJOINT, F(1), A20B, a21B_MC_STAR, F(0), y01_MR_STAR );
 
-        // Combine the AllReduce column summations of x01[MR,* ], y01[MR,* ],
-        // and q21[MR,* ]
+        // AllReduce the column summations of x01[MR,* ] and y01[MR,* ]
         {
             const Int x01LocalHeight = x01_MR_STAR.LocalHeight();
-            const Int q21LocalHeight = q21_MR_STAR.LocalHeight();
-            std::vector<F> colSumSendBuffer(2*x01LocalHeight+q21LocalHeight),
-                           colSumRecvBuffer(2*x01LocalHeight+q21LocalHeight);
+            std::vector<F> colSumSendBuffer(2*x01LocalHeight),
+                           colSumRecvBuffer(2*x01LocalHeight);
             MemCopy
             ( colSumSendBuffer.data(), x01_MR_STAR.Buffer(), x01LocalHeight );
             MemCopy
             ( &colSumSendBuffer[x01LocalHeight],
               y01_MR_STAR.Buffer(), x01LocalHeight );
-            MemCopy
-            ( &colSumSendBuffer[2*x01LocalHeight],
-              q21_MR_STAR.Buffer(), q21LocalHeight );
             mpi::AllReduce
             ( colSumSendBuffer.data(), colSumRecvBuffer.data(),
-              2*x01LocalHeight+q21LocalHeight, g.ColComm() );
+              2*x01LocalHeight, g.ColComm() );
             MemCopy
-            ( x01_MR_STAR.Buffer(), 
-              colSumRecvBuffer.data(), x01LocalHeight );
+            ( x01_MR_STAR.Buffer(), colSumRecvBuffer.data(), x01LocalHeight );
             MemCopy
             ( y01_MR_STAR.Buffer(), 
               &colSumRecvBuffer[x01LocalHeight], x01LocalHeight );
-            MemCopy
-            ( q21_MR_STAR.Buffer(), 
-              &colSumRecvBuffer[2*x01LocalHeight], q21LocalHeight );
         }
 
         LocalGemv( NORMAL, F(-1), A20B, x01_MR_STAR, F(1), p21B_MC_STAR );
         LocalGemv( NORMAL, F(-1), W20B, y01_MR_STAR, F(1), p21B_MC_STAR );
 
+        // Fold the unsummed q21[MR,* ] into p21[MC,* ] so that only a
+        // summation within process rows remains
+        FoldPartialSums( q21_MR_STAR, p21_MC_STAR );
+
         if( W22.Width() > 0 )
         {
-            // This is not the last iteration of the panel factorization, 
-            // combine the Reduce to one of p21[MC,* ] with the redistribution 
-            // of q21[MR,* ] -> q21[MC,MR] to the next process column.
+            // This is not the last iteration of the panel factorization, so
+            // Reduce to one p21[MC,* ] within the next process column.
             const Int localHeight = p21_MC_STAR.LocalHeight();
-            std::vector<F> reduceToOneSendBuffer(2*localHeight),
-                           reduceToOneRecvBuffer(2*localHeight);
-
-            // Pack p21[MC,* ]
-            MemCopy
-            ( reduceToOneSendBuffer.data(), p21_MC_STAR.Buffer(), localHeight );
-
-            // Fill in contributions to q21[MC,MR] from q21[MR,* ]
-            const bool contributing = 
-                ( q21_MR_STAR.ColShift() % g.GCD() ==
-                  p21_MC_STAR.ColShift() % g.GCD() );
-            if( contributing )
-            {
-                if( r == c )
-                {
-                    MemCopy
-                    ( &reduceToOneSendBuffer[localHeight],
-                      q21_MR_STAR.Buffer(), localHeight );
-                }
-                else
-                {
-                    // Zero the entire buffer first
-                    MemZero( &reduceToOneSendBuffer[localHeight], localHeight );
-                    // Fill in the entries that we contribute to.
-                    // We seek to find the minimum s in N such that
-                    //   s*c = a0-b0 (mod r)
-                    // where a0 is the column shift of MC, b0 is the row shift
-                    // of MR, and s is our first local entry of MR that will 
-                    // contribute to MC. I cannot think of an O(1) method, so
-                    // I will instead use the worst-case O(lcm(c,r)/c) method.
-                    const Int sourcePeriod = g.LCM() / c;
-                    const Int targetPeriod = g.LCM() / r;
-                    const Int a0 = p21_MC_STAR.ColShift();
-                    const Int b0 = q21_MR_STAR.ColShift();
-
-                    Int sourceStart = 0;
-                    const Int f = (r+a0-b0) % r;
-                    for( Int s=0; s<sourcePeriod; ++s )
-                    {
-                        if( (s*c) % r == f )
-                        {
-                            sourceStart = s;
-                            break;
-                        }
-                    }
-
-                    const Int globalShift = b0+sourceStart*c;
-                    const Int targetStart = (globalShift-a0)/r;
-                    const Int localLength =
-                        Length(localHeight,targetStart,targetPeriod);
-                    const F* q21_MR_STAR_Buffer = q21_MR_STAR.Buffer();
-                    const Int offset = localHeight + targetStart;
-                    for( Int i=0; i<localLength; ++i )                        
-                        reduceToOneSendBuffer[offset+i*targetPeriod] = 
-                            q21_MR_STAR_Buffer[sourceStart+i*sourcePeriod];
-                }
-            }
-            else
-                MemZero( &reduceToOneSendBuffer[localHeight], localHeight );
-
+            std::vector<F> reduceToOneRecvBuffer(localHeight);
             const Int nextProcessRow = (alpha11.ColAlign()+1) % r;
             const Int nextProcessCol = (alpha11.RowAlign()+1) % c;
             mpi::Reduce
-            ( reduceToOneSendBuffer.data(), reduceToOneRecvBuffer.data(),
-              2*localHeight, nextProcessCol, g.RowComm() );
+            ( p21_MC_STAR.Buffer(), reduceToOneRecvBuffer.data(),
+              localHeight, nextProcessCol, g.RowComm() );
             if( g.Col() == nextProcessCol )
             {
-                // Combine the second half into the first half        
-                for( Int i=0; i<localHeight; ++i )
-                    reduceToOneRecvBuffer[i] +=
-                        reduceToOneRecvBuffer[i+localHeight];
-
                 // Finish computing w21. During its computation, ensure that 
                 // every process has a copy of the first element of the w21.
                 // We know a priori that the first element of a21 is one.
@@ -511,73 +442,10 @@ void LPan
             // w21[MC,* ] and w21[MR,* ] so that we may place them into W[MC,* ]
             // and W[MR,* ]
             const Int localHeight = p21_MC_STAR.LocalHeight();
-            std::vector<F> allReduceSendBuffer(2*localHeight),
-                           allReduceRecvBuffer(2*localHeight);
-
-            // Pack p21[MC,* ]
-            MemCopy
-            ( allReduceSendBuffer.data(), p21_MC_STAR.Buffer(), localHeight );
-
-            // Fill in contributions to q21[MC,* ] from q21[MR,* ]
-            const bool contributing = 
-                ( q21_MR_STAR.ColShift() % g.GCD() ==
-                  p21_MC_STAR.ColShift() % g.GCD() );
-            if( contributing )
-            {
-                if( r == c )
-                {
-                    MemCopy
-                    ( &allReduceSendBuffer[localHeight],
-                      q21_MR_STAR.Buffer(), localHeight );
-                }
-                else
-                {
-                    // Zero the entire buffer first
-                    MemZero( &allReduceSendBuffer[localHeight], localHeight );
-                    // Fill in the entries that we contribute to.
-                    // We seek to find the minimum s in N such that
-                    //   s*c = a0-b0 (mod r)
-                    // where a0 is the column shift of MC, b0 is the row shift
-                    // of MR, and s is our first local entry of MR that will 
-                    // contribute to MC. I cannot think of an O(1) method, so
-                    // I will instead use the worst-case O(lcm(c,r)/c) method.
-                    const Int sourcePeriod = g.LCM() / c;
-                    const Int targetPeriod = g.LCM() / r;
-                    const Int a0 = p21_MC_STAR.ColShift();
-                    const Int b0 = q21_MR_STAR.ColShift();
-
-                    Int sourceStart = 0;
-                    const Int f = (r+a0-b0) % r;
-                    for( Int s=0; s<sourcePeriod; ++s )
-                    {
-                        if( (s*c) % r == f )
-                        {
-                            sourceStart = s;
-                            break;
-                        }
-                    }
-
-                    const Int globalShift = b0+sourceStart*c;
-                    const Int targetStart = (globalShift-a0)/r;
-                    const Int localLength = 
-                        Length(localHeight,targetStart,targetPeriod);
-                    const F* q21_MR_STAR_Buffer = q21_MR_STAR.Buffer();
-                    const Int offset = localHeight + targetStart;
-                    for( Int i=0; i<localLength; ++i )
-                        allReduceSendBuffer[offset+i*targetPeriod] = 
-                            q21_MR_STAR_Buffer[sourceStart+i*sourcePeriod];
-                }
-            }
-            else
-                MemZero( &allReduceSendBuffer[localHeight], localHeight );
-
+            std::vector<F> allReduceRecvBuffer(localHeight);
             mpi::AllReduce
-            ( allReduceSendBuffer.data(), allReduceRecvBuffer.data(),
-              2*localHeight, g.RowComm() );
-
-            // Combine the second half into the first half        
-            for( Int i=0; i<localHeight; ++i )
-                allReduceRecvBuffer[i] += allReduceRecvBuffer[i+localHeight];
+            ( p21_MC_STAR.Buffer(), allReduceRecvBuffer.data(),
+              localHeight, g.RowComm() );
  
             // Finish computing w21.
             const F* a21_MC_STAR_Buffer = a21_MC_STAR.Buffer();
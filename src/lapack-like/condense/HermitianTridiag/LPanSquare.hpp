@@ -43,6 +43,7 @@ void LPanSquare
         if( !A.DiagonalAlignedWith(t,-1) )
             LogicError("t is not aligned with A's subdiagonal");
     )
+    ProfileRegion region("herm_tridiag::LPanSquare");
     typedef Base<F> Real;
     // Find the process holding our transposed data
     const Grid& g = A.Grid();
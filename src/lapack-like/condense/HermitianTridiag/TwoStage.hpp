@@ -0,0 +1,380 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// Reduce the lower triangle of a Hermitian matrix to a band of width b.
+// The reflector which annihilates A(j+b+1:n-1,j) is stored below the b'th
+// subdiagonal, with its implicit unit entry in position (j+b,j), so that
+// the accumulated transformation can be applied with ApplyPackedReflectors.
+template<typename F>
+inline void
+DenseToBand( Matrix<F>& A, Matrix<F>& t, Int b )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag::DenseToBand"))
+    const Int n = A.Height();
+    t.Resize( Max(n-b,0), 1 );
+
+    Matrix<F> tPan, V, S, X, W;
+    Matrix<Base<F>> dPan;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        auto APan  = ViewRange( A, k+b, k,    n, k+nb );
+        auto ARest = ViewRange( A, k+b, k+nb, n, k+b  );
+        auto A22   = ViewRange( A, k+b, k+b,  n, n    );
+        auto t1 = View( t, k, 0, nb, 1 );
+
+        // APan = Q R, with R left within the band. Since we need Q to be the
+        // product of the Householder reflectors, undo the normalization of R
+        QR( APan, tPan, dPan );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, APan );
+        t1 = tPan;
+
+        // Q = I - V inv(S) V^H, where S = triu(V^H V) with the diagonal
+        // set to the inverses of the conjugated scalings
+        V = APan;
+        MakeTriangular( LOWER, V );
+        SetDiagonal( V, F(1) );
+        Zeros( S, nb, nb );
+        Herk( UPPER, ADJOINT, F(1), V, F(0), S );
+        for( Int j=0; j<nb; ++j )
+            S.Set( j, j, F(1)/Conj(tPan.Get(j,0)) );
+
+        // ARest := Q^H ARest (only nonempty for a narrow final panel)
+        if( ARest.Width() > 0 )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), V, ARest, W );
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), S, W );
+            Gemm( NORMAL, NORMAL, F(-1), V, W, F(1), ARest );
+        }
+
+        // A22 := Q^H A22 Q = A22 - Z V^H - V Z^H, where
+        // X := A22 V inv(S) and Z := X - V inv(S)^H (V^H X) / 2
+        Zeros( X, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), S, X );
+        Gemm( ADJOINT, NORMAL, F(1), V, X, W );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), S, W );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, W, F(1), X );
+        Her2k( LOWER, NORMAL, F(-1), X, V, F(1), A22 );
+    }
+}
+
+template<typename F>
+inline void
+DenseToBand( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t, Int b )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag::DenseToBand"))
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    t.Resize( Max(n-b,0), 1 );
+
+    DistMatrix<F,MD,STAR> tPan(g);
+    DistMatrix<Base<F>,MD,STAR> dPan(g);
+    DistMatrix<F> V(g), X(g);
+    DistMatrix<F,VC,  STAR> V_VC_STAR(g), X_VC_STAR(g), ARest_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> S_STAR_STAR(g), W_STAR_STAR(g);
+
+    for( Int k=0; k<n-b; k+=b )
+    {
+        const Int nb = Min(b,n-b-k);
+        auto APan  = ViewRange( A, k+b, k,    n, k+nb );
+        auto ARest = ViewRange( A, k+b, k+nb, n, k+b  );
+        auto A22   = ViewRange( A, k+b, k+b,  n, n    );
+        auto t1 = View( t, k, 0, nb, 1 );
+
+        // APan = Q R, with R left within the band. Since we need Q to be the
+        // product of the Householder reflectors, undo the normalization of R
+        QR( APan, tPan, dPan );
+        DiagonalScaleTrapezoid( LEFT, UPPER, NORMAL, dPan, APan );
+        t1 = tPan;
+
+        // Q = I - V inv(S) V^H, where S = triu(V^H V) with the diagonal
+        // set to the inverses of the conjugated scalings
+        V.AlignWith( A22 );
+        V = APan;
+        MakeTriangular( LOWER, V );
+        SetDiagonal( V, F(1) );
+        V_VC_STAR.AlignWith( A22 );
+        V_VC_STAR = V;
+        Zeros( S_STAR_STAR, nb, nb );
+        Herk
+        ( UPPER, ADJOINT,
+          F(1), V_VC_STAR.LockedMatrix(), F(0), S_STAR_STAR.Matrix() );
+        S_STAR_STAR.SumOver( V_VC_STAR.ColComm() );
+        for( Int j=0; j<nb; ++j )
+            S_STAR_STAR.SetLocal( j, j, F(1)/Conj(t1.GetLocal(j,0)) );
+
+        // ARest := Q^H ARest (only nonempty for a narrow final panel)
+        if( ARest.Width() > 0 )
+        {
+            ARest_VC_STAR.AlignWith( A22 );
+            ARest_VC_STAR = ARest;
+            Zeros( W_STAR_STAR, nb, ARest.Width() );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), V_VC_STAR.LockedMatrix(), ARest_VC_STAR.LockedMatrix(),
+              F(0), W_STAR_STAR.Matrix() );
+            W_STAR_STAR.SumOver( V_VC_STAR.ColComm() );
+            Trsm
+            ( LEFT, UPPER, ADJOINT, NON_UNIT,
+              F(1), S_STAR_STAR.LockedMatrix(), W_STAR_STAR.Matrix() );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(-1), V_VC_STAR.LockedMatrix(), W_STAR_STAR.LockedMatrix(),
+              F(1), ARest_VC_STAR.Matrix() );
+            ARest = ARest_VC_STAR;
+        }
+
+        // A22 := Q^H A22 Q = A22 - Z V^H - V Z^H, where
+        // X := A22 V inv(S) and Z := X - V inv(S)^H (V^H X) / 2
+        X.AlignWith( A22 );
+        Zeros( X, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), X );
+        X_VC_STAR.AlignWith( A22 );
+        X_VC_STAR = X;
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), S_STAR_STAR, X_VC_STAR );
+        Zeros( W_STAR_STAR, nb, nb );
+        Gemm
+        ( ADJOINT, NORMAL,
+          F(1), V_VC_STAR.LockedMatrix(), X_VC_STAR.LockedMatrix(),
+          F(0), W_STAR_STAR.Matrix() );
+        W_STAR_STAR.SumOver( V_VC_STAR.ColComm() );
+        Trsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT,
+          F(1), S_STAR_STAR.LockedMatrix(), W_STAR_STAR.Matrix() );
+        Gemm
+        ( NORMAL, NORMAL,
+          F(-1)/F(2), V_VC_STAR.LockedMatrix(), W_STAR_STAR.LockedMatrix(),
+          F(1), X_VC_STAR.Matrix() );
+        X = X_VC_STAR;
+        Her2k( LOWER, NORMAL, F(-1), X, V, F(1), A22 );
+    }
+}
+
+// Reduce a Hermitian band matrix to real symmetric tridiagonal form by
+// chasing bulges with short Householder reflectors. ABand(i-j,j) holds the
+// lower triangle entry A(i,j), and ABand must have room for 2*bandwidth
+// subdiagonals to hold the bulges. The sweeps are chased in a pipeline over
+// the processes of comm (see ChaseBulges), each of which only keeps the
+// reflectors of its own sweeps.
+template<typename F>
+inline void
+BandToTridiag
+( Matrix<F>& ABand, Matrix<Base<F>>& d, Matrix<Base<F>>& e,
+  BulgeReflectors<F>& bulge, mpi::Comm comm )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag::BandToTridiag");
+        if( ABand.Height() < 2*bulge.bandwidth+1 )
+            LogicError("ABand must have room for the bulges");
+    )
+    typedef Base<F> Real;
+    const Int n = ABand.Width();
+    const Int b = bulge.bandwidth;
+    const Int maxDist = ABand.Height()-1;
+    bulge.groupSize = b;
+    bulge.numOwners = mpi::Size( comm );
+
+    // Step k of sweep j annihilates the first column of the bulge,
+    // A(s+1:s+len-1,c), with a reflector acting on rows [s,s+len), where the
+    // first step annihilates A(j+2:j+b,j)
+    auto footprint = [&]( Int j, Int k )
+    {
+        const Int c = ( k == 0 ? j : j+1+(k-1)*b );
+        const Int s = j+1+k*b;
+        const Int len = Min(b,n-s);
+        return std::pair<Int,Int>( c, Min(n,s+len+b) );
+    };
+
+    std::vector<F> VBuf, tBuf;
+    bulge.sweeps.clear();
+    bulge.steps.clear();
+    bulge.offsets.clear();
+    Matrix<F> Z, v, z;
+    auto step = [&]( Int j, Int k )
+    {
+        const Int c = ( k == 0 ? j : j+1+(k-1)*b );
+        const Int s = j+1+k*b;
+        const Int len = Min(b,n-s);
+        const Int w = Min(n,s+len+b) - c;
+        const Int sw = s-c;
+        if( len == 1 && ImagPart(ABand.Get(sw,c)) == Real(0) )
+            return false;
+
+        // Form the Hermitian window A(c:c+w-1,c:c+w-1)
+        Zeros( Z, w, w );
+        for( Int jj=0; jj<w; ++jj )
+        {
+            for( Int ii=jj; ii<Min(w,jj+maxDist+1); ++ii )
+            {
+                const F value = ABand.Get(ii-jj,c+jj);
+                Z.Set( ii, jj, value );
+                Z.Set( jj, ii, Conj(value) );
+            }
+        }
+
+        // Find tau and v such that H A(s:s+len-1,c) = beta e0, where
+        // H = I - tau v v^H
+        auto chi = ViewRange( Z, sw,   0, sw+1,   1 );
+        auto x   = ViewRange( Z, sw+1, 0, sw+len, 1 );
+        const F tau = LeftReflector( chi, x );
+        v.Resize( len, 1 );
+        v.Set( 0, 0, F(1) );
+        for( Int i=1; i<len; ++i )
+        {
+            v.Set( i, 0, x.Get(i-1,0) );
+            x.Set( i-1, 0, F(0) );
+        }
+
+        if( tau != F(0) )
+        {
+            // Z(s:s+len-1,c+1:end) := H Z(s:s+len-1,c+1:end)
+            auto ZRows = ViewRange( Z, sw, 1, sw+len, w );
+            Zeros( z, w-1, 1 );
+            Gemv( ADJOINT, F(1), ZRows, v, F(0), z );
+            Ger( -tau, v, z, ZRows );
+            // Z(c+1:end,s:s+len-1) := Z(c+1:end,s:s+len-1) H^H
+            auto ZCols = ViewRange( Z, 1, sw, w, sw+len );
+            Zeros( z, w-1, 1 );
+            Gemv( NORMAL, F(1), ZCols, v, F(0), z );
+            Ger( -Conj(tau), z, v, ZCols );
+            PushBulgeReflector( j, k, s, tau, v, bulge, tBuf, VBuf );
+        }
+
+        // Store the lower triangle of the window back into the band
+        for( Int jj=0; jj<w; ++jj )
+        {
+            ABand.Set( 0, c+jj, Z.GetRealPart(jj,jj) );
+            for( Int ii=jj+1; ii<Min(w,jj+maxDist+1); ++ii )
+                ABand.Set( ii-jj, c+jj, Z.Get(ii,jj) );
+        }
+
+        // A single-row reflector is a scaling, which creates no bulge
+        return len > 1 && s+len < n;
+    };
+    ChaseBulges( ABand, Max(n-1,0), bulge.groupSize, footprint, step, comm );
+    FormBulgeReflectors( tBuf, VBuf, bulge );
+
+    d.Resize( n, 1 );
+    e.Resize( Max(n-1,0), 1 );
+    for( Int j=0; j<n; ++j )
+        d.Set( j, 0, RealPart(ABand.Get(0,j)) );
+    for( Int j=0; j<n-1; ++j )
+        e.Set( j, 0, RealPart(ABand.Get(1,j)) );
+}
+
+template<typename F>
+inline void
+TwoStage
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& t, BulgeReflectors<F>& bulge )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag::TwoStage");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    if( uplo == UPPER )
+    {
+        // Work with the equivalent lower-triangular storage
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        TwoStage( LOWER, AAdj, t, bulge );
+        Adjoint( AAdj, A );
+        return;
+    }
+    const Int n = A.Height();
+    const Int b = Max(Min(Blocksize<F>("HermitianTridiagTwoStage"),n-1),1);
+    bulge.bandwidth = b;
+    DenseToBand( A, t, b );
+
+    Matrix<F> ABand;
+    Zeros( ABand, 2*b+1, n );
+    for( Int offset=0; offset<=Min(b,n-1); ++offset )
+    {
+        auto diag = A.GetDiagonal( -offset );
+        for( Int j=0; j<n-offset; ++j )
+            ABand.Set( offset, j, diag.Get(j,0) );
+    }
+    Matrix<Base<F>> d, e;
+    BandToTridiag( ABand, d, e, bulge, mpi::COMM_SELF );
+
+    for( Int j=0; j<n; ++j )
+        A.Set( j, j, d.Get(j,0) );
+    for( Int j=0; j<n-1; ++j )
+        A.Set( j+1, j, e.Get(j,0) );
+    for( Int offset=2; offset<=Min(b,n-1); ++offset )
+        SetDiagonal( A, F(0), -offset );
+}
+
+template<typename F>
+inline void
+TwoStage
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t,
+  BulgeReflectors<F>& bulge )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag::TwoStage");
+        if( A.Grid() != t.Grid() )
+            LogicError("{A,t} must be distributed over the same grid");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    if( uplo == UPPER )
+    {
+        // Work with the equivalent lower-triangular storage
+        DistMatrix<F> AAdj( A.Grid() );
+        Adjoint( A, AAdj );
+        TwoStage( LOWER, AAdj, t, bulge );
+        Adjoint( AAdj, A );
+        return;
+    }
+    ProfileRegion region("herm_tridiag::TwoStage");
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int b = Max(Min(Blocksize<F>("HermitianTridiagTwoStage",g),n-1),1);
+    bulge.bandwidth = b;
+    DenseToBand( A, t, b );
+
+    // Every process gathers the O(n b) band, and then the sweeps are chased
+    // in a pipeline over the processes, so that each stores and applies
+    // roughly 1/p of the O(n^2) bulge reflectors
+    Matrix<F> ABand;
+    Zeros( ABand, 2*b+1, n );
+    DistMatrix<F,STAR,STAR> diag_STAR_STAR(g);
+    for( Int offset=0; offset<=Min(b,n-1); ++offset )
+    {
+        auto diag = A.GetDiagonal( -offset );
+        diag_STAR_STAR = diag;
+        for( Int j=0; j<n-offset; ++j )
+            ABand.Set( offset, j, diag_STAR_STAR.GetLocal(j,0) );
+    }
+    Matrix<Base<F>> d, e;
+    BandToTridiag( ABand, d, e, bulge, g.Comm() );
+
+    for( Int j=0; j<n; ++j )
+        if( A.IsLocal(j,j) )
+            A.SetLocal( A.LocalRow(j), A.LocalCol(j), d.Get(j,0) );
+    for( Int j=0; j<n-1; ++j )
+        if( A.IsLocal(j+1,j) )
+            A.SetLocal( A.LocalRow(j+1), A.LocalCol(j), e.Get(j,0) );
+    for( Int offset=2; offset<=Min(b,n-1); ++offset )
+        SetDiagonal( A, F(0), -offset );
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
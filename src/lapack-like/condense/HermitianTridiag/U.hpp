@@ -9,6 +9,7 @@
 #ifndef EL_HERMITIANTRIDIAG_U_HPP
 #define EL_HERMITIANTRIDIAG_U_HPP
 
+#include "./Fold.hpp"
 #include "./UPan.hpp"
 
 namespace El {
@@ -62,6 +63,7 @@ void U( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
         if( A.Height() != A.Width() )
             LogicError("A must be square");
     )
+    ProfileRegion region("herm_tridiag::U");
     const Grid& g = A.Grid();
     const Int n = A.Height();
     if( n == 0 )
@@ -79,7 +81,7 @@ void U( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
     
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("HermitianTridiag",g);
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -38,6 +38,7 @@ void UPan
             LogicError
             ("t must be a column vector of the same length as W's width.");
     )
+    ProfileRegion region("herm_tridiag::UPan");
     typedef Base<F> Real;
     const Grid& g = A.Grid();
     const Int r = g.Height();
@@ -341,118 +342,46 @@ void UPan
         LocalGemv( ADJOINT, F(1), W02T, a01T_MC_STAR, F(0), x21_MR_STAR );
         LocalGemv( ADJOINT, F(1), A02T, a01T_MC_STAR, F(0), y21_MR_STAR );
 
-        // Combine the AllReduce column summations of x21[MR,* ], y21[MR,* ],
-        // and q01[MR,* ]
+        // AllReduce the column summations of x21[MR,* ] and y21[MR,* ]
         {
             const Int x21LocalHeight = x21_MR_STAR.LocalHeight();
-            const Int y21LocalHeight = y21_MR_STAR.LocalHeight();
-            const Int q01LocalHeight = q01_MR_STAR.LocalHeight();
-            const Int reduceSize = x21LocalHeight+y21LocalHeight+q01LocalHeight;
-            std::vector<F> colSumSendBuffer(reduceSize),
-                           colSumRecvBuffer(reduceSize);
+            std::vector<F> colSumSendBuffer(2*x21LocalHeight),
+                           colSumRecvBuffer(2*x21LocalHeight);
             MemCopy
             ( colSumSendBuffer.data(), x21_MR_STAR.Buffer(), x21LocalHeight );
             MemCopy
             ( &colSumSendBuffer[x21LocalHeight],
-              y21_MR_STAR.Buffer(), y21LocalHeight );
-            MemCopy
-            ( &colSumSendBuffer[x21LocalHeight+y21LocalHeight],
-              q01_MR_STAR.Buffer(), q01LocalHeight );
+              y21_MR_STAR.Buffer(), x21LocalHeight );
             mpi::AllReduce
             ( colSumSendBuffer.data(), colSumRecvBuffer.data(),
-              reduceSize, g.ColComm() );
+              2*x21LocalHeight, g.ColComm() );
             MemCopy
             ( x21_MR_STAR.Buffer(), colSumRecvBuffer.data(), x21LocalHeight );
             MemCopy
             ( y21_MR_STAR.Buffer(), 
-              &colSumRecvBuffer[x21LocalHeight], y21LocalHeight );
-            MemCopy
-            ( q01_MR_STAR.Buffer(), 
-              &colSumRecvBuffer[x21LocalHeight+y21LocalHeight], 
-              q01LocalHeight );
+              &colSumRecvBuffer[x21LocalHeight], x21LocalHeight );
         }
 
         LocalGemv( NORMAL, F(-1), A02T, x21_MR_STAR, F(1), p01T_MC_STAR );
         LocalGemv( NORMAL, F(-1), W02T, y21_MR_STAR, F(1), p01T_MC_STAR );
 
+        // Fold the unsummed q01[MR,* ] into p01[MC,* ] so that only a
+        // summation within process rows remains
+        FoldPartialSums( q01_MR_STAR, p01_MC_STAR );
+
         if( W00.Width() > 0 )
         {
-            // This is not the last iteration of the panel factorization, 
-            // combine the Reduce to one of p01[MC,* ] with the redistribution 
-            // of q01[MR,* ] -> q01[MC,MR] to the next process column.
+            // This is not the last iteration of the panel factorization, so
+            // Reduce to one p01[MC,* ] within the next process column.
             const Int localHeight = p01_MC_STAR.LocalHeight();
-            std::vector<F> reduceToOneSendBuffer(2*localHeight),
-                           reduceToOneRecvBuffer(2*localHeight);
-
-            // Pack p01[MC,* ]
-            MemCopy
-            ( reduceToOneSendBuffer.data(), p01_MC_STAR.Buffer(), localHeight );
-
-            // Fill in contributions to q01[MC,MR] from q01[MR,* ]
-            const bool contributing = 
-                ( q01_MR_STAR.ColShift() % g.GCD() ==
-                  p01_MC_STAR.ColShift() % g.GCD() );
-            if( contributing )
-            {
-                if( r == c )
-                {
-                    MemCopy
-                    ( &reduceToOneSendBuffer[localHeight],
-                      q01_MR_STAR.Buffer(), localHeight );
-                }
-                else
-                {
-                    // Zero the entire buffer first
-                    MemZero( &reduceToOneSendBuffer[localHeight], localHeight );
-                    // Fill in the entries that we contribute to.
-                    // We seek to find the minimum s in N such that
-                    //   s*c = a0-b0 (mod r)
-                    // where a0 is the column shift of MC, b0 is the row shift
-                    // of MR, and s is our first local entry of MR that will 
-                    // contribute to MC. I cannot think of an O(1) method, so
-                    // I will instead use the worst-case O(lcm(c,r)/c) method.
-                    const Int sourcePeriod = g.LCM() / c;
-                    const Int targetPeriod = g.LCM() / r;
-                    const Int a0 = p01_MC_STAR.ColShift();
-                    const Int b0 = q01_MR_STAR.ColShift();
-
-                    Int sourceStart = 0;
-                    const Int f = (r+a0-b0) % r;
-                    for( Int s=0; s<sourcePeriod; ++s )
-                    {
-                        if( (s*c) % r == f )
-                        {
-                            sourceStart = s;
-                            break;
-                        }
-                    }
-
-                    const Int globalShift = b0+sourceStart*c;
-                    const Int targetStart = (globalShift-a0)/r;
-                    const Int localLength =
-                        Length(localHeight,targetStart,targetPeriod);
-                    const F* q01_MR_STAR_Buffer = q01_MR_STAR.Buffer();
-                    const Int offset = localHeight + targetStart;
-                    for( Int i=0; i<localLength; ++i )                        
-                        reduceToOneSendBuffer[offset+i*targetPeriod] = 
-                            q01_MR_STAR_Buffer[sourceStart+i*sourcePeriod];
-                }
-            }
-            else
-                MemZero( &reduceToOneSendBuffer[localHeight], localHeight );
-
+            std::vector<F> reduceToOneRecvBuffer(localHeight);
             const Int nextProcessRow = (alpha11.ColAlign()+r-1) % r;
             const Int nextProcessCol = (alpha11.RowAlign()+c-1) % c;
             mpi::Reduce
-            ( reduceToOneSendBuffer.data(), reduceToOneRecvBuffer.data(),
-              2*localHeight, nextProcessCol, g.RowComm() );
+            ( p01_MC_STAR.Buffer(), reduceToOneRecvBuffer.data(),
+              localHeight, nextProcessCol, g.RowComm() );
             if( g.Col() == nextProcessCol )
             {
-                // Combine the second half into the first half        
-                for( Int i=0; i<localHeight; ++i )
-                    reduceToOneRecvBuffer[i] +=
-                        reduceToOneRecvBuffer[i+localHeight];
-
                 // Finish computing w01. During its computation, ensure that 
                 // every process has a copy of the last element of the w01.
                 // We know a priori that the last element of a01 is one.
@@ -484,73 +413,10 @@ void UPan
             // w01[MC,* ] and w01[MR,* ] so that we may place them into W[MC,* ]
             // and W[MR,* ]
             const Int localHeight = p01_MC_STAR.LocalHeight();
-            std::vector<F> allReduceSendBuffer(2*localHeight),
-                           allReduceRecvBuffer(2*localHeight);
-
-            // Pack p01[MC,* ]
-            MemCopy
-            ( allReduceSendBuffer.data(), p01_MC_STAR.Buffer(), localHeight );
-
-            // Fill in contributions to q01[MC,* ] from q01[MR,* ]
-            const bool contributing = 
-                ( q01_MR_STAR.ColShift() % g.GCD() ==
-                  p01_MC_STAR.ColShift() % g.GCD() );
-            if( contributing )
-            {
-                if( r == c )
-                {
-                    MemCopy
-                    ( &allReduceSendBuffer[localHeight],
-                      q01_MR_STAR.Buffer(), localHeight );
-                }
-                else
-                {
-                    // Zero the entire buffer first
-                    MemZero( &allReduceSendBuffer[localHeight], localHeight );
-                    // Fill in the entries that we contribute to.
-                    // We seek to find the minimum s in N such that
-                    //   s*c = a0-b0 (mod r)
-                    // where a0 is the column shift of MC, b0 is the row shift
-                    // of MR, and s is our first local entry of MR that will 
-                    // contribute to MC. I cannot think of an O(1) method, so
-                    // I will instead use the worst-case O(lcm(c,r)/c) method.
-                    const Int sourcePeriod = g.LCM() / c;
-                    const Int targetPeriod = g.LCM() / r;
-                    const Int a0 = p01_MC_STAR.ColShift();
-                    const Int b0 = q01_MR_STAR.ColShift();
-
-                    Int sourceStart = 0;
-                    const Int f = (r+a0-b0) % r;
-                    for( Int s=0; s<sourcePeriod; ++s )
-                    {
-                        if( (s*c) % r == f )
-                        {
-                            sourceStart = s;
-                            break;
-                        }
-                    }
-
-                    const Int globalShift = b0+sourceStart*c;
-                    const Int targetStart = (globalShift-a0)/r;
-                    const Int localLength = 
-                        Length(localHeight,targetStart,targetPeriod);
-                    const F* q01_MR_STAR_Buffer = q01_MR_STAR.Buffer();
-                    const Int offset = localHeight + targetStart;
-                    for( Int i=0; i<localLength; ++i )
-                        allReduceSendBuffer[offset+i*targetPeriod] = 
-                            q01_MR_STAR_Buffer[sourceStart+i*sourcePeriod];
-                }
-            }
-            else
-                MemZero( &allReduceSendBuffer[localHeight], localHeight );
-
+            std::vector<F> allReduceRecvBuffer(localHeight);
             mpi::AllReduce
-            ( allReduceSendBuffer.data(), allReduceRecvBuffer.data(),
-              2*localHeight, g.RowComm() );
-
-            // Combine the second half into the first half        
-            for( Int i=0; i<localHeight; ++i )
-                allReduceRecvBuffer[i] += allReduceRecvBuffer[i+localHeight];
+            ( p01_MC_STAR.Buffer(), allReduceRecvBuffer.data(),
+              localHeight, g.RowComm() );
  
             // Finish computing w01. During its computation, ensure that 
             // every process has a copy of the last element of the w01.
@@ -38,6 +38,7 @@ void UPanSquare
             LogicError
             ("t must be a column vector of the same length as W's width.");
     )
+    ProfileRegion region("herm_tridiag::UPanSquare");
     typedef Base<F> Real;
     const Grid& g = A.Grid();
     const Int r = g.Height();
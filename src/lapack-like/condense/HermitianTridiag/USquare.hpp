@@ -24,6 +24,7 @@ void USquare( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
         if( A.Height() != A.Width() )
             LogicError("A must be square");
     )
+    ProfileRegion region("herm_tridiag::USquare");
     const Grid& g = A.Grid();
     DEBUG_ONLY(
         if( g.Height() != g.Width() )
@@ -45,7 +46,7 @@ void USquare( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("HermitianTridiag",g);
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
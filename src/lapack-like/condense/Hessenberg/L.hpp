@@ -30,7 +30,7 @@ inline void L( Matrix<F>& A, Matrix<F>& t )
 
     Matrix<F> UB1, V01, VB1, G11;
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Hessenberg");
     for( Int k=0; k<n-1; k+=bsize )
     {
         const Int nb = Min(bsize,n-1-k);
@@ -87,7 +87,7 @@ inline void L( DistMatrix<F>& A, DistMatrix<F,STAR,STAR>& t )
     DistMatrix<F,MR,STAR> V01_MR_STAR(g), VB1_MR_STAR(g), UB1_MR_STAR(g);
     DistMatrix<F,STAR,STAR> G11_STAR_STAR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Hessenberg",g);
     for( Int k=0; k<n-1; k+=bsize )
     {
         const Int nb = Min(bsize,n-1-k);
@@ -90,6 +90,7 @@ ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl )
     ElHermitianTridiagCtrlDefault( &ctrl->tridiagCtrl );
     ElHermitianSdcCtrlDefault_s( &ctrl->sdcCtrl );
     ctrl->useSdc = false;
+    ctrl->useTwoStage = false;
     return EL_SUCCESS;
 }
 ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
@@ -97,6 +98,7 @@ ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
     ElHermitianTridiagCtrlDefault( &ctrl->tridiagCtrl );
     ElHermitianSdcCtrlDefault_d( &ctrl->sdcCtrl );
     ctrl->useSdc = false;
+    ctrl->useTwoStage = false;
     return EL_SUCCESS;
 }
 
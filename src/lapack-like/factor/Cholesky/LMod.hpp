@@ -10,217 +10,236 @@
 #ifndef EL_CHOLESKY_LMOD_HPP
 #define EL_CHOLESKY_LMOD_HPP
 
-// TODO: Blocked algorithms
-
 namespace El {
 namespace cholesky {
 
 namespace mod {
 
+// Apply the negative of a (possibly hyperbolic) Householder reflector from
+// the right:
+//   | l21 V2 | := -| l21 V2 | + gamma (l21 + sigma V2 u^T) | 1 conj(u) |,
+// where u^T is stored in v1. Standard reflectors use gamma = tau and
+// sigma = 1, while hyperbolic reflectors use gamma = 1/tau and sigma = -1.
 template<typename F>
 inline void
-LUpdate( Matrix<F>& L, Matrix<F>& V )
+ApplyLModReflector
+( F gamma, F sigma, const Matrix<F>& v1, Matrix<F>& l21, Matrix<F>& V2,
+  Matrix<F>& z21 )
 {
-    DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::LUpdate");
-        if( L.Height() != L.Width() )
-            LogicError("Cholesky factors must be square");
-        if( V.Height() != L.Height() )
-            LogicError("V is the wrong height");
-    )
-    const Int m = V.Height();
-    const Int n = V.Width();
+    z21 = l21;
+    Gemv( NORMAL, sigma, V2, v1, F(1), z21 );
+    Scale( F(-1), l21 );
+    Axpy( gamma, z21, l21 );
+    Scale( F(-1), V2 );
+    Ger( gamma, z21, v1, V2 );
+}
 
-    Matrix<F> z21;
+// Process the rows of the diagonal block L11 and of V1 one at a time, while
+// accumulating the product of the (negated) reflectors into the
+// (nb+n) x (nb+n) matrix Q so that the remaining rows can be updated with
+// level 3 operations via | L21 V2 | := | L21 V2 | Q
+template<typename F>
+inline void
+LModPanel( Matrix<F>& L11, Matrix<F>& V1, Matrix<F>& Q, bool downdate )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::LModPanel"))
+    const Int nb = L11.Height();
+    const Int n = V1.Width();
+    Identity( Q, nb+n, nb+n );
+    auto QV = ViewRange( Q, 0, nb, nb+n, nb+n );
 
-    F* LBuf = L.Buffer();
-    const Int ldl = L.LDim();
-    for( Int k=0; k<m; ++k )
+    Matrix<F> z21;
+    F* LBuf = L11.Buffer();
+    const Int ldl = L11.LDim();
+    for( Int k=0; k<nb; ++k )
     {
         F& lambda11 = LBuf[k+k*ldl];
-        auto l21 = ViewRange( L, k+1, k, m, k+1 );
+        auto l21 = ViewRange( L11, k+1, k, nb,   k+1 );
+        auto q1  = ViewRange( Q,   0,   k, nb+n, k+1 );
 
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
+        auto v1 = ViewRange( V1, k,   0, k+1, n );
+        auto V2 = ViewRange( V1, k+1, 0, nb,  n );
 
-        // Find tau and u such that
+        // Find tau and u such that either
         //  | lambda11 u | /I - tau | 1   | | 1 conj(u) |\ = | -beta 0 |
         //                 \        | u^T |              /
-        // where beta >= 0
-        const F tau = RightReflector( lambda11, v1 );
-
-        // Apply the negative Householder reflector from the right:
-        // | l21 V2 | := -| l21 V2 | + tau | l21 V2 | | 1   | | 1 conj(u) |
-        //                                           | u^T |
-        //             = -| l21 V2 | + tau (l21 + V2 u^T) | 1 conj(u) | 
-        lambda11 = -lambda11;
-        z21 = l21;
-        Gemv( NORMAL, F(1), V2, v1, F(1), z21 );
-        Scale( F(-1), l21 );
-        Axpy( tau, z21, l21 );
-        Scale( F(-1), V2  );
-        Ger( tau, z21, v1, V2 );
+        // or, for downdates,
+        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
+        //                 \                | u^T |              /
+        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
+        if( downdate )
+        {
+            const F tau = RightHyperbolicReflector( lambda11, v1 );
+            lambda11 = -lambda11;
+            ApplyLModReflector( F(1)/tau, F(-1), v1, l21, V2, z21 );
+            ApplyLModReflector( F(1)/tau, F(-1), v1, q1,  QV, z21 );
+        }
+        else
+        {
+            const F tau = RightReflector( lambda11, v1 );
+            lambda11 = -lambda11;
+            ApplyLModReflector( tau, F(1), v1, l21, V2, z21 );
+            ApplyLModReflector( tau, F(1), v1, q1,  QV, z21 );
+        }
     }
 }
 
+// Since Q is dense, applying it to a block of nb rows requires roughly
+// (nb^2 + 4 nb n + 2 n^2) flops per row rather than the 4 nb n of the 
+// unblocked algorithm, and so the blocksize is limited to a small multiple
+// of the rank of the modification
+inline Int ModBlocksize( Int bsize, Int n )
+{ return Max(Min(bsize,4*n),Int(1)); }
+
 template<typename F>
 inline void
-LUpdate( DistMatrix<F>& L, DistMatrix<F>& V )
+LMod( Matrix<F>& L, Matrix<F>& V, bool downdate )
 {
     DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::LUpdate");
+        CallStackEntry cse("cholesky::mod::LMod");
         if( L.Height() != L.Width() )
             LogicError("Cholesky factors must be square");
         if( V.Height() != L.Height() )
             LogicError("V is the wrong height");
-        if( L.Grid() != V.Grid() )
-            LogicError("L and V must have the same grid");
     )
     const Int m = V.Height();
     const Int n = V.Width();
+    const Int bsize = ModBlocksize( Blocksize<F>("CholeskyMod"), n );
 
-    const Grid& g = L.Grid();
-    DistMatrix<F,MC,STAR> z21_MC_STAR(g), b21_MC_STAR(g);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(g);
-    for( Int k=0; k<m; ++k )
+    Matrix<F> Q, L21Copy, V2Copy;
+    for( Int k=0; k<m; k+=bsize )
     {
-        F lambda11 = L.Get( k, k );
-        auto l21 = ViewRange( L, k+1, k, m, k+1 );
+        const Int nb = Min(bsize,m-k);
+        auto L11 = ViewRange( L, k,    k, k+nb, k+nb );
+        auto L21 = ViewRange( L, k+nb, k, m,    k+nb );
 
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
+        auto V1 = ViewRange( V, k,    0, k+nb, n );
+        auto V2 = ViewRange( V, k+nb, 0, m,    n );
 
-        // Find tau and u such that
-        //  | lambda11 u | /I - tau | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \        | u^T |              /
-        // where beta >= 0
-        const F tau = RightReflector( lambda11, v1 );
+        LModPanel( L11, V1, Q, downdate );
 
-        // Apply the negative Householder reflector from the right:
-        // | l21 V2 | := -| l21 V2 | + tau | l21 V2 | | 1   | | 1 conj(u) |
-        //                                            | u^T |
-        //             = -| l21 V2 | + tau (l21 + V2 u^T) | 1 conj(u) | 
-        L.Set( k, k, -lambda11 );
-        z21_MC_STAR.AlignWith( V2 );
-        b21_MC_STAR.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        z21_MC_STAR = l21;
-        v1_STAR_MR = v1;
-        Zeros( b21_MC_STAR, V2.Height(), 1 );
-        LocalGemv( NORMAL, F(1), V2, v1_STAR_MR, F(0), b21_MC_STAR );
-        b21_MC_STAR.SumOver( V2.RowComm() );
-        Axpy( F(1), b21_MC_STAR, z21_MC_STAR );
-        Scale( F(-1), l21 );
-        Axpy( tau, z21_MC_STAR, l21 );
-        Scale( F(-1), V2 );
-        LocalGer( tau, z21_MC_STAR, v1_STAR_MR, V2 );
+        // | L21 V2 | := | L21 V2 | | QTL QTV |
+        //                          | QVL QVV |
+        auto QTL = LockedViewRange( Q, 0,  0,  nb,   nb   );
+        auto QTV = LockedViewRange( Q, 0,  nb, nb,   nb+n );
+        auto QVL = LockedViewRange( Q, nb, 0,  nb+n, nb   );
+        auto QVV = LockedViewRange( Q, nb, nb, nb+n, nb+n );
+        L21Copy = L21;
+        V2Copy = V2;
+        Gemm( NORMAL, NORMAL, F(1), L21Copy, QTL, F(0), L21 );
+        Gemm( NORMAL, NORMAL, F(1), V2Copy,  QVL, F(1), L21 );
+        Gemm( NORMAL, NORMAL, F(1), L21Copy, QTV, F(0), V2  );
+        Gemm( NORMAL, NORMAL, F(1), V2Copy,  QVV, F(1), V2  );
     }
 }
 
+// Each diagonal block (along with the corresponding rows of V) is processed
+// redundantly, and the remaining rows are then updated with a single
+// redistribution of each of | L21 V2 | rather than with one matrix-vector
+// product (and its associated collectives) per row
 template<typename F>
 inline void
-LDowndate( Matrix<F>& L, Matrix<F>& V )
+LMod( DistMatrix<F>& L, DistMatrix<F>& V, bool downdate )
 {
     DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::LDowndate");
+        CallStackEntry cse("cholesky::mod::LMod");
         if( L.Height() != L.Width() )
             LogicError("Cholesky factors must be square");
         if( V.Height() != L.Height() )
             LogicError("V is the wrong height");
+        if( L.Grid() != V.Grid() )
+            LogicError("L and V must have the same grid");
     )
     const Int m = V.Height();
     const Int n = V.Width();
+    const Grid& g = L.Grid();
+    const Int bsize = ModBlocksize( Blocksize<F>("CholeskyMod",g), n );
 
-    Matrix<F> z21;
-
-    F* LBuf = L.Buffer();
-    const Int ldl = L.LDim();
-    for( Int k=0; k<m; ++k )
+    DistMatrix<F> L21New(g);
+    DistMatrix<F,MC,  STAR> L21_MC_STAR(g), V2_MC_STAR(g);
+    DistMatrix<F,STAR,MR  > QTL_STAR_MR(g), QTV_STAR_MR(g),
+                            QVL_STAR_MR(g), QVV_STAR_MR(g);
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), V1_STAR_STAR(g), Q_STAR_STAR(g);
+    for( Int k=0; k<m; k+=bsize )
     {
-        F& lambda11 = LBuf[k+k*ldl];
-        auto l21 = ViewRange( L, k+1, k, m, k+1 );
+        const Int nb = Min(bsize,m-k);
+        auto L11 = ViewRange( L, k,    k, k+nb, k+nb );
+        auto L21 = ViewRange( L, k+nb, k, m,    k+nb );
 
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
+        auto V1 = ViewRange( V, k,    0, k+nb, n );
+        auto V2 = ViewRange( V, k+nb, 0, m,    n );
 
-        // Find tau and u such that
-        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \                | u^T |              /
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        const F tau = RightHyperbolicReflector( lambda11, v1 );
+        L11_STAR_STAR = L11;
+        V1_STAR_STAR = V1;
+        Q_STAR_STAR.Resize( nb+n, nb+n );
+        LModPanel
+        ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(), 
+          Q_STAR_STAR.Matrix(), downdate );
+        L11 = L11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+
+        // | L21 V2 | := | L21 V2 | | QTL QTV |
+        //                          | QVL QVV |
+        auto QTL = LockedViewRange( Q_STAR_STAR, 0,  0,  nb,   nb   );
+        auto QTV = LockedViewRange( Q_STAR_STAR, 0,  nb, nb,   nb+n );
+        auto QVL = LockedViewRange( Q_STAR_STAR, nb, 0,  nb+n, nb   );
+        auto QVV = LockedViewRange( Q_STAR_STAR, nb, nb, nb+n, nb+n );
+        L21_MC_STAR.AlignWith( V2 );
+        V2_MC_STAR.AlignWith( V2 );
+        L21_MC_STAR = L21;
+        V2_MC_STAR = V2;
+        QTV_STAR_MR.AlignWith( V2 );
+        QVV_STAR_MR.AlignWith( V2 );
+        QTV_STAR_MR = QTV;
+        QVV_STAR_MR = QVV;
+        LocalGemm( NORMAL, NORMAL, F(1), L21_MC_STAR, QTV_STAR_MR, F(0), V2 );
+        LocalGemm( NORMAL, NORMAL, F(1), V2_MC_STAR,  QVV_STAR_MR, F(1), V2 );
 
-        // Apply the negative of the hyperbolic Householder reflector from the 
-        // right:
-        // |l21 V2| := -|l21 V2| + 1/tau |l21 V2| Sigma |1  | |1 conj(u)|
-        //                                              |u^T|
-        //           = -|l21 V2| + 1/tau |l21 -V2| |1  | |1 conj(u)|
-        //                                         |u^T|
-        //           = -|l21 V2| + 1/tau |l21 - V2 u^T| |1 conj(u)|
-        lambda11 = -lambda11;
-        z21 = l21;
-        Gemv( NORMAL, F(-1), V2, v1, F(1), z21 );
-        Scale( F(-1), l21 );
-        Scale( F(-1), V2  );
-        Axpy( F(1)/tau, z21, l21 );
-        Ger( F(1)/tau, z21, v1, V2 );
+        // L21 may be aligned differently than V2
+        QTL_STAR_MR.AlignWith( L21 );
+        QVL_STAR_MR.AlignWith( L21 );
+        QTL_STAR_MR = QTL;
+        QVL_STAR_MR = QVL;
+        L21New.Align( V2.ColAlign(), L21.RowAlign() );
+        L21New.Resize( m-(k+nb), nb );
+        LocalGemm
+        ( NORMAL, NORMAL, F(1), L21_MC_STAR, QTL_STAR_MR, F(0), L21New );
+        LocalGemm
+        ( NORMAL, NORMAL, F(1), V2_MC_STAR,  QVL_STAR_MR, F(1), L21New );
+        L21 = L21New;
     }
 }
 
 template<typename F>
 inline void
-LDowndate( DistMatrix<F>& L, DistMatrix<F>& V )
+LUpdate( Matrix<F>& L, Matrix<F>& V )
 {
-    DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::LDowndate");
-        if( L.Height() != L.Width() )
-            LogicError("Cholesky factors must be square");
-        if( V.Height() != L.Height() )
-            LogicError("V is the wrong height");
-        if( L.Grid() != V.Grid() )
-            LogicError("L and V must have the same grid");
-    )
-    const Int m = V.Height();
-    const Int n = V.Width();
-
-    const Grid& g = L.Grid();
-    DistMatrix<F,MC,STAR> z21_MC_STAR(g), b21_MC_STAR(g);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(g);
-    for( Int k=0; k<m; ++k )
-    {
-        F lambda11 = L.Get( k, k );
-        auto l21 = ViewRange( L, k+1, k, m, k+1 );
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::LUpdate"))
+    LMod( L, V, false );
+}
 
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
+template<typename F>
+inline void
+LUpdate( DistMatrix<F>& L, DistMatrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::LUpdate"))
+    LMod( L, V, false );
+}
 
-        // Find tau and u such that
-        //  | lambda11 u | /I - 1/tau Sigma | 1   | | 1 conj(u) |\ = | -beta 0 |
-        //                 \                | u^T |              /
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        const F tau = RightHyperbolicReflector( lambda11, v1 );
+template<typename F>
+inline void
+LDowndate( Matrix<F>& L, Matrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::LDowndate"))
+    LMod( L, V, true );
+}
 
-        // Apply the negative of the hyperbolic Householder reflector from the 
-        // right:
-        // |l21 V2| := -|l21 V2| + 1/tau |l21 V2| Sigma |1  | |1 conj(u)|
-        //                                              |u^T|
-        //           = -|l21 V2| + 1/tau |l21 -V2| |1  | |1 conj(u)|
-        //                                         |u^T|
-        //           = -|l21 V2| + 1/tau |l21 - V2 u^T| |1 conj(u)|
-        L.Set( k, k, -lambda11 );
-        z21_MC_STAR.AlignWith( V2 );
-        b21_MC_STAR.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        z21_MC_STAR = l21;
-        v1_STAR_MR = v1;
-        Zeros( b21_MC_STAR, V2.Height(), 1 );
-        LocalGemv( NORMAL, F(-1), V2, v1_STAR_MR, F(0), b21_MC_STAR );
-        b21_MC_STAR.SumOver( V2.RowComm() );
-        Axpy( F(1), b21_MC_STAR, z21_MC_STAR );
-        Scale( F(-1), l21 );
-        Scale( F(-1), V2  );
-        Axpy( F(1)/tau, z21_MC_STAR, l21 );
-        LocalGer( F(1)/tau, z21_MC_STAR, v1_STAR_MR, V2 );
-    }
+template<typename F>
+inline void
+LDowndate( DistMatrix<F>& L, DistMatrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::LDowndate"))
+    LMod( L, V, true );
 }
 
 } // namespace mod
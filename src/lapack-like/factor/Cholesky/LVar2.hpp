@@ -27,7 +27,7 @@ LVar2( Matrix<F>& A )
             LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -52,6 +52,7 @@ LVar2( DistMatrix<F>& A )
         if( A.Height() != A.Width() )
             LogicError("Can only compute Cholesky factor of square matrices");
     )
+    ProfileRegion region("cholesky::LVar2");
     const Grid& g = A.Grid();
     DistMatrix<F,MR,  STAR> A10Adj_MR_STAR(g);
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
@@ -60,7 +61,7 @@ LVar2( DistMatrix<F>& A )
     DistMatrix<F,MC,  STAR> X21_MC_STAR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -30,7 +30,7 @@ LVar3Unb( Matrix<F>& A )
     {
         Real alpha = RealPart(ABuffer[j+j*lda]);
         if( alpha <= Real(0) )
-            LogicError("A was not numerically HPD");
+            throw NonHPDMatrixException();
         alpha = Sqrt( alpha );
         ABuffer[j+j*lda] = alpha;
 
@@ -60,7 +60,7 @@ ReverseLVar3Unb( Matrix<F>& A )
     {
         Real alpha = RealPart(ABuffer[j+j*lda]);
         if( alpha <= Real(0) )
-            LogicError("A was not numerically HPD");
+            throw NonHPDMatrixException();
         alpha = Sqrt( alpha );
         ABuffer[j+j*lda] = alpha;
 
@@ -83,7 +83,7 @@ LVar3( Matrix<F>& A )
             LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -107,7 +107,7 @@ ReverseLVar3( Matrix<F>& A )
             LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky");
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -131,6 +131,7 @@ LVar3( DistMatrix<F>& A )
         if( A.Height() != A.Width() )
             LogicError("Can only compute Cholesky factor of square matrices");
     )
+    ProfileRegion region("cholesky::LVar3");
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
     DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
@@ -139,7 +140,7 @@ LVar3( DistMatrix<F>& A )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -182,6 +183,7 @@ ReverseLVar3( DistMatrix<F>& A )
         if( A.Height() != A.Width() )
             LogicError("Can only compute Cholesky factor of square matrices");
     )
+    ProfileRegion region("cholesky::ReverseLVar3");
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
     DistMatrix<F,STAR,VR  > A10_STAR_VR(g);
@@ -189,7 +191,7 @@ ReverseLVar3( DistMatrix<F>& A )
     DistMatrix<F,STAR,MR  > A10_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",g);
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -26,6 +26,7 @@ LVar3Square( DistMatrix<F>& A )
         if( A.Grid().Height() != A.Grid().Width() )
             LogicError("CholeskyLVar3Square requires a square process grid");
     )
+    ProfileRegion region("cholesky::LVar3Square");
     // Find the process holding our transposed data
     const Grid& g = A.Grid();
     const Int transposeRank = 
@@ -38,7 +39,7 @@ LVar3Square( DistMatrix<F>& A )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
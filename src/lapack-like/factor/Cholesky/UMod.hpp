@@ -10,19 +10,23 @@
 #ifndef EL_CHOLESKY_UMOD_HPP
 #define EL_CHOLESKY_UMOD_HPP
 
-// TODO: Blocked algorithms
-
 namespace El {
 namespace cholesky {
 
 namespace mod {
 
+// Since U^H U = L L^H for L = U^H, each diagonal block is processed as in the
+// lower-triangular case (see LMod.hpp), and the remaining columns of U and
+// rows of V are then updated with level 3 operations via
+//   | U12^H V2 | := | U12^H V2 | | QTL QTV |,
+//                               | QVL QVV |
+// that is, U12 := QTL^H U12 + QVL^H V2^H and V2 := U12^H QTV + V2 QVV
 template<typename F>
 inline void
-UUpdate( Matrix<F>& U, Matrix<F>& V )
+UMod( Matrix<F>& U, Matrix<F>& V, bool downdate )
 {
     DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::UUpdate");
+        CallStackEntry cse("cholesky::mod::UMod");
         if( U.Height() != U.Width() )
             LogicError("Cholesky factors must be square");
         if( V.Height() != U.Height() )
@@ -30,54 +34,41 @@ UUpdate( Matrix<F>& U, Matrix<F>& V )
     )
     const Int m = V.Height();
     const Int n = V.Width();
+    const Int bsize = ModBlocksize( Blocksize<F>("CholeskyMod"), n );
 
-    Matrix<F> z12;
-
-    F* UBuf = U.Buffer();
-    const Int ldu = U.LDim();
-    for( Int k=0; k<m; ++k )
+    Matrix<F> L11, Q, U12Copy, V2Copy;
+    for( Int k=0; k<m; k+=bsize )
     {
-        F& upsilon11 = UBuf[k+k*ldu];
-        auto u12 = ViewRange( U, k, k+1, k+1, m );
-
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
-
-        // Find tau and w such that
-        //  /I - tau | 1 | | 1 w^H | \ | upsilon11 | = | -beta |
-        //  \        | w |           / | v1^H      |   | 0     |
-        // where beta >= 0
-        Conjugate( v1 );
-        const F tau = LeftReflector( upsilon11, v1 );
-
-        // Apply the negative of the Householder reflector from the left:
-        // | u12  | := -| u12  | + tau | 1 | | 1 w^H | | u12  |
-        // | V2^H |     | V2^H |       | w |           | V2^H |
-        //
-        //           = -| u12  | + tau | 1 | (u12 + w^H V2^H)
-        //              | V2^H |       | w |
-        // Thus,
-        //    u12 := -u12 + tau (u12 + w^H V2^H), and
-        //    V2^H := -V2^H + tau w (u12 + w^H V2^H),
-        //    V2   := -V2 + conj(tau) (u12^H + V2 w) w^H
-        //               
-        upsilon11 = -upsilon11;
-        Conjugate( u12, z12 );
-        Gemv( NORMAL, F(1), V2, v1, F(1), z12 );
-        Scale( F(-1), V2 );
-        Ger( Conj(tau), z12, v1, V2 );
-        Conjugate( z12 );
-        Scale( F(-1), u12 );
-        Axpy( tau, z12, u12 );
+        const Int nb = Min(bsize,m-k);
+        auto U11 = ViewRange( U, k, k,    k+nb, k+nb );
+        auto U12 = ViewRange( U, k, k+nb, k+nb, m    );
+
+        auto V1 = ViewRange( V, k,    0, k+nb, n );
+        auto V2 = ViewRange( V, k+nb, 0, m,    n );
+
+        Adjoint( U11, L11 );
+        LModPanel( L11, V1, Q, downdate );
+        Adjoint( L11, U11 );
+
+        auto QTL = LockedViewRange( Q, 0,  0,  nb,   nb   );
+        auto QTV = LockedViewRange( Q, 0,  nb, nb,   nb+n );
+        auto QVL = LockedViewRange( Q, nb, 0,  nb+n, nb   );
+        auto QVV = LockedViewRange( Q, nb, nb, nb+n, nb+n );
+        U12Copy = U12;
+        V2Copy = V2;
+        Gemm( ADJOINT, NORMAL,  F(1), QTL,     U12Copy, F(0), U12 );
+        Gemm( ADJOINT, ADJOINT, F(1), QVL,     V2Copy,  F(1), U12 );
+        Gemm( ADJOINT, NORMAL,  F(1), U12Copy, QTV,     F(0), V2  );
+        Gemm( NORMAL,  NORMAL,  F(1), V2Copy,  QVV,     F(1), V2  );
     }
 }
 
 template<typename F>
 inline void
-UUpdate( DistMatrix<F>& U, DistMatrix<F>& V )
+UMod( DistMatrix<F>& U, DistMatrix<F>& V, bool downdate )
 {
     DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::UUpdate");
+        CallStackEntry cse("cholesky::mod::UMod");
         if( U.Height() != U.Width() )
             LogicError("Cholesky factors must be square");
         if( V.Height() != U.Height() )
@@ -87,176 +78,95 @@ UUpdate( DistMatrix<F>& U, DistMatrix<F>& V )
     )
     const Int m = V.Height();
     const Int n = V.Width();
-
     const Grid& g = U.Grid();
-    DistMatrix<F,STAR,MC> z12_STAR_MC(g), b12_STAR_MC(g);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(g);
-    for( Int k=0; k<m; ++k )
+    const Int bsize = ModBlocksize( Blocksize<F>("CholeskyMod",g), n );
+
+    Matrix<F> L11;
+    DistMatrix<F,MC,  STAR> U12Adj_MC_STAR(g), V2_MC_STAR(g);
+    DistMatrix<F,STAR,MR  > U12_STAR_MR(g), V2Adj_STAR_MR(g), 
+                            U12New_STAR_MR(g), QTV_STAR_MR(g), QVV_STAR_MR(g);
+    DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), V1_STAR_STAR(g), Q_STAR_STAR(g);
+    for( Int k=0; k<m; k+=bsize )
     {
-        F upsilon11 = U.Get(k,k);
-        auto u12 = ViewRange( U, k, k+1, k+1, m );
-
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
-
-        // Find tau and w such that
-        //  /I - tau | 1 | | 1 w^H | \ | upsilon11 | = | -beta |
-        //  \        | w |           / | v1^H      |   | 0     |
-        // where beta >= 0
-        Conjugate( v1 );
-        // LeftReflector assumes that v1 is a column-vector, so conjugate
-        // the RightReflector result
-        const F tau = RightReflector( upsilon11, v1 );
-        Conjugate( v1 );
-
-        // Apply the negative of the Householder reflector from the left:
-        // | u12  | := -| u12  | + tau | 1 | | 1 w^H | | u12  |
-        // | V2^H |     | V2^H |       | w |           | V2^H |
-        //
-        //           = -| u12  | + tau | 1 | (u12 + w^H V2^H)
-        //              | V2^H |       | w |
-        // Thus,
-        //    u12 := -u12 + tau (u12 + w^H V2^H), and
-        //    V2^H := -V2^H + tau w (u12 + w^H V2^H),
-        //    V2   := -V2 + conj(tau) (u12^H + V2 w) w^H
-        //               
-        U.Set( k, k, -upsilon11 );
-        z12_STAR_MC.AlignWith( V2 );
-        b12_STAR_MC.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        Conjugate( u12, z12_STAR_MC );
-        v1_STAR_MR = v1;
-        Zeros( b12_STAR_MC, 1, V2.Height() );
-        LocalGemv( NORMAL, F(1), V2, v1_STAR_MR, F(0), b12_STAR_MC );
-        b12_STAR_MC.SumOver( V2.RowComm() );
-        Axpy( F(1), b12_STAR_MC, z12_STAR_MC );
-        Scale( F(-1), V2 );
-        LocalGer( Conj(tau), z12_STAR_MC, v1_STAR_MR, V2 );
-        Conjugate( z12_STAR_MC );
-        Scale( F(-1), u12 );
-        Axpy( tau, z12_STAR_MC, u12 );
+        const Int nb = Min(bsize,m-k);
+        auto U11 = ViewRange( U, k, k,    k+nb, k+nb );
+        auto U12 = ViewRange( U, k, k+nb, k+nb, m    );
+
+        auto V1 = ViewRange( V, k,    0, k+nb, n );
+        auto V2 = ViewRange( V, k+nb, 0, m,    n );
+
+        U11_STAR_STAR = U11;
+        V1_STAR_STAR = V1;
+        Q_STAR_STAR.Resize( nb+n, nb+n );
+        Adjoint( U11_STAR_STAR.LockedMatrix(), L11 );
+        LModPanel( L11, V1_STAR_STAR.Matrix(), Q_STAR_STAR.Matrix(), downdate );
+        Adjoint( L11, U11_STAR_STAR.Matrix() );
+        U11 = U11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+
+        // Redistribute the original U12 and V2 before overwriting them
+        U12_STAR_MR.AlignWith( U12 );
+        V2Adj_STAR_MR.AlignWith( U12 );
+        U12Adj_MC_STAR.AlignWith( V2 );
+        V2_MC_STAR.AlignWith( V2 );
+        U12_STAR_MR = U12;
+        Adjoint( V2, V2Adj_STAR_MR );
+        Adjoint( U12, U12Adj_MC_STAR );
+        V2_MC_STAR = V2;
+
+        auto QTL = LockedViewRange( Q_STAR_STAR, 0,  0,  nb,   nb   );
+        auto QTV = LockedViewRange( Q_STAR_STAR, 0,  nb, nb,   nb+n );
+        auto QVL = LockedViewRange( Q_STAR_STAR, nb, 0,  nb+n, nb   );
+        auto QVV = LockedViewRange( Q_STAR_STAR, nb, nb, nb+n, nb+n );
+        U12New_STAR_MR.AlignWith( U12 );
+        U12New_STAR_MR.Resize( nb, m-(k+nb) );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(1), QTL, U12_STAR_MR,   F(0), U12New_STAR_MR );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(1), QVL, V2Adj_STAR_MR, F(1), U12New_STAR_MR );
+        U12 = U12New_STAR_MR;
+
+        QTV_STAR_MR.AlignWith( V2 );
+        QVV_STAR_MR.AlignWith( V2 );
+        QTV_STAR_MR = QTV;
+        QVV_STAR_MR = QVV;
+        LocalGemm
+        ( NORMAL, NORMAL, F(1), U12Adj_MC_STAR, QTV_STAR_MR, F(0), V2 );
+        LocalGemm
+        ( NORMAL, NORMAL, F(1), V2_MC_STAR,     QVV_STAR_MR, F(1), V2 );
     }
 }
 
 template<typename F>
 inline void
-UDowndate( Matrix<F>& U, Matrix<F>& V )
+UUpdate( Matrix<F>& U, Matrix<F>& V )
 {
-    DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::UDowndate");
-        if( U.Height() != U.Width() )
-            LogicError("Cholesky factors must be square");
-        if( V.Height() != U.Height() )
-            LogicError("V is the wrong height");
-    )
-    const Int m = V.Height();
-    const Int n = V.Width();
-
-    Matrix<F> z12;
-
-    F* UBuf = U.Buffer();
-    const Int ldu = U.LDim();
-    for( Int k=0; k<m; ++k )
-    {
-        F& upsilon11 = UBuf[k+k*ldu];
-        auto u12 = ViewRange( U, k, k+1, k+1, m );
-
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::UUpdate"))
+    UMod( U, V, false );
+}
 
-        // Find tau and w such that
-        //  /I - 1/tau | 1 | | 1 w^H | Sigma \ | upsilon11 | = | -beta |
-        //  \          | w |                 / | v1^H      |   | 0     |
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        Conjugate( v1 );
-        const F tau = LeftHyperbolicReflector( upsilon11, v1 );
+template<typename F>
+inline void
+UUpdate( DistMatrix<F>& U, DistMatrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::UUpdate"))
+    UMod( U, V, false );
+}
 
-        // Apply the negative of the Householder reflector from the left:
-        // | u12  | := -| u12  | + 1/tau | 1 | | 1 w^H | Sigma | u12  |
-        // | V2^H |     | V2^H |         | w |                 | V2^H |
-        //
-        //           = -| u12  | + 1/tau | 1 | (u12 - w^H V2^H)
-        //              | V2^H |         | w |
-        // Thus,
-        //    u12 := -u12 + 1/tau (u12 - w^H V2^H), and
-        //    V2^H := -V2^H + 1/tau w (u12 - w^H V2^H),
-        //    V2   := -V2 + 1/tau (u12^H - V2 w) w^H
-        //               
-        upsilon11 = -upsilon11;
-        Conjugate( u12, z12 );
-        Gemv( NORMAL, F(-1), V2, v1, F(1), z12 );
-        Scale( F(-1), u12 );
-        Scale( F(-1), V2 );
-        Ger( F(1)/tau, z12, v1, V2 );
-        Conjugate( z12 );
-        Axpy( F(1)/tau, z12, u12 );
-    }
+template<typename F>
+inline void
+UDowndate( Matrix<F>& U, Matrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::UDowndate"))
+    UMod( U, V, true );
 }
 
 template<typename F>
 inline void
 UDowndate( DistMatrix<F>& U, DistMatrix<F>& V )
 {
-    DEBUG_ONLY(
-        CallStackEntry cse("cholesky::mod::UDowndate");
-        if( U.Height() != U.Width() )
-            LogicError("Cholesky factors must be square");
-        if( V.Height() != U.Height() )
-            LogicError("V is the wrong height");
-        if( U.Grid() != V.Grid() )
-            LogicError("U and V must have the same grid");
-    )
-    const Int m = V.Height();
-    const Int n = V.Width();
-
-    const Grid& g = U.Grid();
-    DistMatrix<F,STAR,MC> z12_STAR_MC(g), b12_STAR_MC(g);
-    DistMatrix<F,STAR,MR> v1_STAR_MR(g);
-    for( Int k=0; k<m; ++k )
-    {
-        F upsilon11 = U.Get(k,k);
-        auto u12 = ViewRange( U, k, k+1, k+1, m );
-
-        auto v1 = ViewRange( V, k,   0, k+1, n );
-        auto V2 = ViewRange( V, k+1, 0, m,   n );
-
-        // Find tau and w such that
-        //  /I - 1/tau | 1 | | 1 w^H | Sigma \ | upsilon11 | = | -beta |
-        //  \          | w |                 / | v1^H      |   | 0     |
-        // where Sigma = diag(+1,-1,...,-1) and beta >= 0
-        // Since LeftHyperbolicReflector expects v1 to be a column vector,
-        // use the Right variant and conjugate the result
-        Conjugate( v1 );
-        const F tau = RightHyperbolicReflector( upsilon11, v1 );
-        Conjugate( v1 );
-
-        // Apply the negative of the Householder reflector from the left:
-        // | u12  | := -| u12  | + 1/tau | 1 | | 1 w^H | Sigma | u12  |
-        // | V2^H |     | V2^H |         | w |                 | V2^H |
-        //
-        //           = -| u12  | + 1/tau | 1 | (u12 - w^H V2^H)
-        //              | V2^H |         | w |
-        // Thus,
-        //    u12 := -u12 + 1/tau (u12 - w^H V2^H), and
-        //    V2^H := -V2^H + 1/tau w (u12 - w^H V2^H),
-        //    V2   := -V2 + 1/tau (u12^H - V2 w) w^H
-        //               
-        U.Set( k, k, -upsilon11 );
-        z12_STAR_MC.AlignWith( V2 ); 
-        b12_STAR_MC.AlignWith( V2 );
-        v1_STAR_MR.AlignWith( V2 );
-        Conjugate( u12, z12_STAR_MC );
-        v1_STAR_MR = v1;
-        Zeros( b12_STAR_MC, 1, V2.Height() );
-        LocalGemv( NORMAL, F(-1), V2, v1_STAR_MR, F(0), b12_STAR_MC );
-        b12_STAR_MC.SumOver( V2.RowComm() );
-        Axpy( F(1), b12_STAR_MC, z12_STAR_MC );
-        Scale( F(-1), u12 );
-        Scale( F(-1), V2 );
-        LocalGer( F(1)/tau, z12_STAR_MC, v1_STAR_MR, V2 );
-        Conjugate( z12_STAR_MC );
-        Axpy( F(1)/tau, z12_STAR_MC, u12 );
-    }
+    DEBUG_ONLY(CallStackEntry cse("cholesky::mod::UDowndate"))
+    UMod( U, V, true );
 }
 
 } // namespace mod
@@ -241,7 +241,7 @@ UVar3( Matrix<F>& A, Matrix<Int>& pPerm )
         pPerm.Set( i, 0, i );
 
     Matrix<F> X, Y;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -273,7 +273,7 @@ UVar3( DistMatrix<F>& A, DistMatrix<Int,UPerm,STAR>& pPerm )
 
     DistMatrix<F,MC,STAR> X( A.Grid() );
     DistMatrix<F,MR,STAR> Y( A.Grid() );
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",A.Grid());
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
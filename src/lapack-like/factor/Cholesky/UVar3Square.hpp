@@ -26,6 +26,7 @@ UVar3Square( DistMatrix<F>& A )
         if( A.Grid().Height() != A.Grid().Width() )
             LogicError("CholeskyUVar3Square assumes a square process grid.");
     )
+    ProfileRegion region("cholesky::UVar3Square");
     // Find the process holding our transposed data
     const Grid& g = A.Grid();
     const Int transposeRank =
@@ -38,7 +39,7 @@ UVar3Square( DistMatrix<F>& A )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("Cholesky",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./LDL/Var3.hpp"
+#include "./LDL/Var3Square.hpp"
 #include "./LDL/Pivoted.hpp"
 
 #include "./LDL/MultiplyAfter.hpp"
@@ -29,7 +30,11 @@ template<typename F>
 void LDL( DistMatrix<F>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("LDL"))
-    ldl::Var3( A, conjugate );
+    const Grid& g = A.Grid();
+    if( g.Height() == g.Width() )
+        ldl::Var3Square( A, conjugate );
+    else
+        ldl::Var3( A, conjugate );
 }
 
 template<typename F>
@@ -982,6 +982,44 @@ PanelPivoted
     }
 }
 
+// On a square process grid, form Y[MR,* ] from X[MC,* ] with a single
+// pairwise exchange with the process owning the transposed data. X and Y are
+// assumed to be the same size and aligned with the column and row
+// distributions of a diagonal subblock of an [MC,MR] matrix.
+template<typename F>
+inline void
+SquareTransposeExchange
+( const DistMatrix<F,MC,STAR>& X, DistMatrix<F,MR,STAR>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ldl::SquareTransposeExchange");
+        if( X.Grid().Height() != X.Grid().Width() )
+            LogicError("Requires a square process grid");
+        if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+            LogicError("X and Y must be the same size");
+    )
+    const Grid& g = X.Grid();
+    const Int r = g.Height();
+    const Int transposeRow = (X.ColAlign()+Y.ColShift()) % r;
+    const Int transposeCol = (Y.ColAlign()+X.ColShift()) % r;
+    const Int transposeRank = transposeRow + r*transposeCol;
+
+    const Int width = X.Width();
+    const Int sendHeight = X.LocalHeight();
+    const Int recvHeight = Y.LocalHeight();
+    std::vector<F> sendBuf(sendHeight*width), recvBuf(recvHeight*width);
+    for( Int j=0; j<width; ++j )
+        MemCopy( &sendBuf[j*sendHeight], X.LockedBuffer(0,j), sendHeight );
+    if( transposeRank == g.VCRank() )
+        recvBuf = sendBuf;
+    else
+        mpi::SendRecv
+        ( sendBuf.data(), sendHeight*width, transposeRank,
+          recvBuf.data(), recvHeight*width, transposeRank, g.VCComm() );
+    for( Int j=0; j<width; ++j )
+        MemCopy( Y.Buffer(0,j), &recvBuf[j*recvHeight], recvHeight );
+}
+
 template<typename F,Dist UPerm>
 inline void
 PanelPivoted
@@ -1012,6 +1050,11 @@ PanelPivoted
 
     DistMatrix<F,STAR,STAR> D11_STAR_STAR( A.Grid() );
 
+    // On square grids, the [MR,* ] copies of the new columns are formed from
+    // their [MC,* ] copies via a pairwise exchange rather than through the
+    // general [MC,MR] -> [MR,* ] redistribution
+    const bool square = ( A.Grid().Height() == A.Grid().Width() );
+
     Int k=0;
     while( k < bsize )
     {
@@ -1064,12 +1107,24 @@ PanelPivoted
             auto a21 = ViewRange( ABR, k+1, k, n-off, k+1 );
             auto x21 = ViewRange( X,   k+1, k, n-off, k+1 );
             auto y21 = ViewRange( Y,   k+1, k, n-off, k+1 );
-            if( conjugate )
-                Conjugate( a21, y21 );
+            if( square )
+            {
+                x21 = a21;
+                SquareTransposeExchange( x21, y21 );
+                if( conjugate )
+                    Conjugate( y21 );
+                Scale( delta11Inv, a21 );
+                Scale( delta11Inv, x21 );
+            }
             else
-                y21 = a21;
-            Scale( delta11Inv, a21 );
-            x21 = a21;
+            {
+                if( conjugate )
+                    Conjugate( a21, y21 );
+                else
+                    y21 = a21;
+                Scale( delta11Inv, a21 );
+                x21 = a21;
+            }
 
             k += 1;
         }
@@ -1095,13 +1150,28 @@ PanelPivoted
             auto A21 = ViewRange( ABR, k+2, k, n-off, k+2 );
             auto X21 = ViewRange( X,   k+2, k, n-off, k+2 );
             auto Y21 = ViewRange( Y,   k+2, k, n-off, k+2 );
-            if( conjugate )
-                Conjugate( A21, Y21 );
-            else
-                Y21 = A21;
             D11_STAR_STAR = D11;
-            Symmetric2x2Solve( RIGHT, LOWER, D11_STAR_STAR, A21, conjugate );
-            X21 = A21;
+            if( square )
+            {
+                X21 = A21;
+                SquareTransposeExchange( X21, Y21 );
+                if( conjugate )
+                    Conjugate( Y21 );
+                Symmetric2x2Solve
+                ( RIGHT, LOWER, D11_STAR_STAR.LockedMatrix(), X21.Matrix(),
+                  conjugate );
+                A21 = X21;
+            }
+            else
+            {
+                if( conjugate )
+                    Conjugate( A21, Y21 );
+                else
+                    Y21 = A21;
+                Symmetric2x2Solve
+                ( RIGHT, LOWER, D11_STAR_STAR, A21, conjugate );
+                X21 = A21;
+            }
 
             // Only leave the main diagonal of D in A, so that routines like
             // Trsm can still be used. Thus, return the subdiagonal.
@@ -1138,7 +1208,7 @@ BlockedPivoted
         pPerm.Set( i, 0, i );
 
     Matrix<F> X, Y;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LDL");
     Int k=0;
     while( k < n )
     {
@@ -1190,7 +1260,7 @@ BlockedPivoted
 
     DistMatrix<F,MC,STAR> X(g);
     DistMatrix<F,MR,STAR> Y(g);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LDL",g);
     Int k=0;
     while( k < n )
     {
@@ -79,7 +79,7 @@ Var3( Matrix<F>& A, bool conjugate=false )
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     Matrix<F> d1, S21;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LDL");
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -115,7 +115,7 @@ Var3( DistMatrix<F>& A, bool conjugate=false )
     DistMatrix<F,STAR,MC  > S21Trans_STAR_MC(g);
     DistMatrix<F,STAR,MR  > A21Trans_STAR_MR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LDL",g);
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
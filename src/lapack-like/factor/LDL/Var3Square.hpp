@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LDL_VAR3SQUARE_HPP
+#define EL_LDL_VAR3SQUARE_HPP
+
+namespace El {
+namespace ldl {
+
+template<typename F>
+inline void
+Var3Square( DistMatrix<F>& A, bool conjugate=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ldl::Var3Square");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Grid().Height() != A.Grid().Width() )
+            LogicError("ldl::Var3Square requires a square process grid");
+    )
+    ProfileRegion region("ldl::Var3Square");
+    // Find the process holding our transposed data
+    const Grid& g = A.Grid();
+    const Int transposeRank = 
+        A.RowOwner(A.RowShift()) + A.ColStride()*A.ColOwner(A.ColShift());
+    const bool onDiagonal = ( transposeRank == g.VCRank() );
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), d1_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,STAR,MC  > S21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A21Trans_STAR_MR(g);
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize<F>("LDL",g);
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto A11 = ViewRange( A, k,    k,    k+nb, k+nb );
+        auto A21 = ViewRange( A, k+nb, k,    n,    k+nb );
+        auto A22 = ViewRange( A, k+nb, k+nb, n,    n    );
+
+        A11_STAR_STAR = A11;
+        LocalLDL( A11_STAR_STAR, conjugate );
+        A11_STAR_STAR.GetDiagonal( d1_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, orientation, UNIT,
+          F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        // S21 = L21 D1 is left in A21[VC,* ]
+        S21Trans_STAR_MC.AlignWith( A22 );
+        A21_VC_STAR.TransposePartialColAllGather( S21Trans_STAR_MC );
+        // SendRecv to form S21^T[* ,MR] from S21^T[* ,MC], then scale by
+        // inv(D1) (and conjugate) to form L21^[T/H][* ,MR]
+        A21Trans_STAR_MR.AlignWith( A22 );
+        A21Trans_STAR_MR.Resize( A21.Width(), A21.Height() );
+        {
+            if( onDiagonal )
+            {
+                const Int size = A11.Height()*A22.LocalWidth();
+                MemCopy
+                ( A21Trans_STAR_MR.Buffer(),
+                  S21Trans_STAR_MC.Buffer(), size );
+            }
+            else
+            {
+                const Int sendSize = A21.LocalHeight()*A21.Width();
+                const Int recvSize = A11.Height()*A22.LocalWidth();
+                // We know that the ldim is the height since we have manually
+                // created both temporary matrices.
+                mpi::SendRecv
+                ( S21Trans_STAR_MC.Buffer(), sendSize, transposeRank,
+                  A21Trans_STAR_MR.Buffer(), recvSize, transposeRank,
+                  g.VCComm() );
+            }
+            DiagonalSolve( LEFT, NORMAL, d1_STAR_STAR, A21Trans_STAR_MR );
+            if( conjugate )
+                Conjugate( A21Trans_STAR_MR );
+        }
+
+        // (S21^T[* ,MC])^T L21^[T/H][* ,MR] = (S21 L21^[T/H])[MC,MR]
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          F(-1), S21Trans_STAR_MC, A21Trans_STAR_MR, F(1), A22 );
+
+        DiagonalSolve( LEFT, NORMAL, d1_STAR_STAR, S21Trans_STAR_MC );
+        A21.TransposeRowFilterFrom( S21Trans_STAR_MC );
+    }
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_VAR3SQUARE_HPP
@@ -0,0 +1,45 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "./LTL/Aasen.hpp"
+#include "./LTL/SolveAfter.hpp"
+
+namespace El {
+
+template<typename F>
+void LTL( Matrix<F>& A, Matrix<Int>& pPerm, bool conjugate )
+{
+    DEBUG_ONLY(CallStackEntry cse("LTL"))
+    ltl::Aasen( A, pPerm, conjugate );
+}
+
+template<typename F,Dist UPerm>
+void LTL( DistMatrix<F>& A, DistMatrix<Int,UPerm,STAR>& pPerm, bool conjugate )
+{
+    DEBUG_ONLY(CallStackEntry cse("LTL"))
+    ProfileRegion region("LTL");
+    ltl::Aasen( A, pPerm, conjugate );
+}
+
+#define PROTO(F) \
+  template void LTL( Matrix<F>& A, Matrix<Int>& pPerm, bool conjugate ); \
+  template void LTL \
+  ( DistMatrix<F>& A, DistMatrix<Int,VC,STAR>& pPerm, bool conjugate ); \
+  template void ltl::SolveAfter \
+  ( const Matrix<F>& A, const Matrix<Int>& pPerm, Matrix<F>& B, \
+    bool conjugated ); \
+  template void ltl::SolveAfter \
+  ( const DistMatrix<F>& A, const DistMatrix<Int,VC,STAR>& pPerm, \
+    DistMatrix<F>& B, bool conjugated );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,324 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LTL_AASEN_HPP
+#define EL_LTL_AASEN_HPP
+
+// Aasen's algorithm computes P A P^T = L T L^[T/H], where L is unit lower
+// triangular with its first column equal to e_0 and T is tridiagonal, using
+// pivot searches which only involve a single (updated) column, as in GEPP.
+// Please see
+//     J.O. Aasen, "On the reduction of a symmetric matrix to tridiagonal
+//     form", BIT, Vol. 11, pp. 233--242, 1971
+// and
+//     M. Rozloznik, G. Shklarski, and S. Toledo, "Partitioned triangular
+//     tridiagonalization", ACM TOMS, Vol. 37, No. 4, 2011.
+//
+// Define S_k := A - L(:,0:k-1) T(0:k-1,0:k-1) L(:,0:k-1)^[T/H], which, unlike
+// the trailing matrix of a right-looking Aasen's algorithm, is Hermitian (or
+// symmetric) and can therefore be stored in, and symmetrically pivoted within,
+// the lower triangle of A. Then T(k,k) is S_k(k,k) minus the contribution of
+// T(k-1,k) and T(k,k-1), and S_{k+1}(k+1:n-1,k) = L(k+1:n-1,k+1) T(k+1,k), so
+// that the pivot for the next column of L is chosen from a single column.
+//
+// The blocked algorithm lazily accumulates S_{k0} - S_{k1} as X Y^T over a
+// panel of columns k0:k1-1, where
+//     X = [L(:,k0-1),...,L(:,k1)]  and
+//     Y(:,s) = conj(L(:,k0-1:k1-1)) M(s,:)^T,
+// with M equal to T(k0-1:k1-1,k0-1:k1-1) with its top-left entry zeroed, so
+// that the trailing update is a single Trrk.
+//
+// On exit, the diagonal and subdiagonal of A contain T, and, since the first
+// column of L is e_0, L(k+2:n-1,k+1) is stored in A(k+2:n-1,k). Thus the
+// strictly lower triangle of A(1:n-1,0:n-2) is the strictly lower triangle of
+// L(1:n-1,1:n-1).
+
+namespace El {
+namespace ltl {
+
+template<typename F>
+inline void
+Panel
+( Matrix<F>& A, Matrix<Int>& pPerm, Matrix<F>& X, Matrix<F>& Y,
+  Int bsize, Int off=0, bool conjugate=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("ltl::Panel"))
+    const Int n = A.Height();
+    const Int nBR = n - off;
+    DEBUG_ONLY(
+        if( A.Width() != n )
+            LogicError("A must be square");
+        if( pPerm.Height() != n || pPerm.Width() != 1 )
+            LogicError("permutation vector is the wrong size");
+        if( bsize > nBR )
+            LogicError("Panel is too wide");
+    )
+    Zeros( X, nBR, bsize+2 );
+    Zeros( Y, nBR, bsize+1 );
+
+    // Initialize X(:,0:1) with L(off:n-1,off-1:off)
+    if( off >= 2 )
+    {
+        auto x0 = ViewRange( X, 0, 0, nBR, 1 );
+        auto lPrev = LockedViewRange( A, off, off-2, n, off-1 );
+        x0 = lPrev;
+    }
+    X.Set( 0, 1, F(1) );
+    if( off >= 1 )
+    {
+        auto x1 = ViewRange( X, 1, 1, nBR, 2 );
+        auto lCurr = LockedViewRange( A, off+1, off-1, n, off );
+        x1 = lCurr;
+    }
+    F tau = ( off >= 1 ? A.Get(off,off-1) : F(0) );
+
+    Matrix<F> Z, dY, M(2,2), m(2,1);
+    for( Int t=0; t<bsize; ++t )
+    {
+        const Int k = off + t;
+        const F tauConj = ( conjugate ? Conj(tau) : tau );
+
+        // A(k:n-1,k) := S_k(k:n-1,k) = A(k:n-1,k) - X(t:end,0:t) Y(t,0:t)^T
+        {
+            auto aB1 = ViewRange( A, k, k, n, k+1 );
+            auto XB0 = LockedViewRange( X, t, 0, nBR, t+1 );
+            auto y10 = LockedViewRange( Y, t, 0, t+1, t+1 );
+            Gemv( NORMAL, F(-1), XB0, y10, F(1), aB1 );
+        }
+
+        // T(k,k) := S_k(k,k) - L(k,k-1) T(k-1,k) - T(k,k-1) conj(L(k,k-1))
+        const F lambda = X.Get(t,t);
+        const F lambdaConj = ( conjugate ? Conj(lambda) : lambda );
+        F delta = A.Get(k,k) - lambda*tauConj - tau*lambdaConj;
+        if( conjugate )
+            delta = RealPart(delta);
+        A.Set( k, k, delta );
+        if( k == n-1 )
+            break;
+
+        // Extend the lazy update to S_{k+1}: since X(t+1:end,t:t+1) holds
+        // L(k+1:n-1,k-1:k), Y(t+1:end,t:t+1) += conj(X(t+1:end,t:t+1)) M,
+        // and A(k+1:n-1,k) -= X(k+1:n-1,t:t+1) (conj(X(t,t:t+1)) M)^T
+        M.Set( 0, 0, F(0) );    M.Set( 0, 1, tau   );
+        M.Set( 1, 0, tauConj ); M.Set( 1, 1, delta );
+        m.Set( 0, 0, tauConj ); m.Set( 1, 0, tau*lambdaConj+delta );
+        auto XB = LockedViewRange( X, t+1, t, nBR, t+2 );
+        auto YB =       ViewRange( Y, t+1, t, nBR, t+2 );
+        auto a21 =      ViewRange( A, k+1, k, n,   k+1 );
+        if( conjugate )
+            Conjugate( XB, Z );
+        else
+            Z = XB;
+        Gemm( NORMAL, NORMAL, F(1), Z, M, dY );
+        Axpy( F(1), dY, YB );
+        Gemv( NORMAL, F(-1), XB, m, F(1), a21 );
+
+        // Pivot the largest entry of S_{k+1}(k+1:n-1,k) into position k+1
+        const auto a21Max = VectorMaxAbs( a21 );
+        const Int to = k+1;
+        const Int from = to + a21Max.index;
+        SymmetricSwap( LOWER, A, to, from, conjugate );
+        RowSwap( pPerm, to, from );
+        RowSwap( X, to-off, from-off );
+        RowSwap( Y, to-off, from-off );
+
+        // Store T(k+1,k) and L(k+2:n-1,k+1), and then copy L(:,k+1) into X
+        tau = A.Get(k+1,k);
+        auto l21 = ViewRange( A, k+2, k, n, k+1 );
+        if( tau != F(0) )
+            Scale( F(1)/tau, l21 );
+        X.Set( t+1, t+2, F(1) );
+        auto x21 = ViewRange( X, t+2, t+2, nBR, t+3 );
+        x21 = l21;
+    }
+}
+
+template<typename F,Dist UPerm>
+inline void
+Panel
+( DistMatrix<F>& A, DistMatrix<Int,UPerm,STAR>& pPerm,
+  DistMatrix<F,MC,STAR>& X, DistMatrix<F,MR,STAR>& Y,
+  Int bsize, Int off=0, bool conjugate=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("ltl::Panel"))
+    const Int n = A.Height();
+    const Int nBR = n - off;
+    DEBUG_ONLY(
+        if( A.Width() != n )
+            LogicError("A must be square");
+        if( pPerm.Height() != n || pPerm.Width() != 1 )
+            LogicError("permutation vector is the wrong size");
+        if( bsize > nBR )
+            LogicError("Panel is too wide");
+    )
+    const Grid& g = A.Grid();
+    auto ABR = ViewRange( A, off, off, n, n );
+    X.AlignWith( ABR );
+    Y.AlignWith( ABR );
+    Zeros( X, nBR, bsize+2 );
+    Zeros( Y, nBR, bsize+1 );
+
+    // Initialize X(:,0:1) with L(off:n-1,off-1:off)
+    if( off >= 2 )
+    {
+        auto x0 = ViewRange( X, 0, 0, nBR, 1 );
+        auto lPrev = LockedViewRange( A, off, off-2, n, off-1 );
+        x0 = lPrev;
+    }
+    X.Set( 0, 1, F(1) );
+    if( off >= 1 )
+    {
+        auto x1 = ViewRange( X, 1, 1, nBR, 2 );
+        auto lCurr = LockedViewRange( A, off+1, off-1, n, off );
+        x1 = lCurr;
+    }
+    F tau = ( off >= 1 ? A.Get(off,off-1) : F(0) );
+
+    DistMatrix<F,MC,STAR> Z(g), dY(g);
+    DistMatrix<F,MR,STAR> dY_MR_STAR(g);
+    Matrix<F> M(2,2), m(2,1);
+    for( Int t=0; t<bsize; ++t )
+    {
+        const Int k = off + t;
+        const F tauConj = ( conjugate ? Conj(tau) : tau );
+
+        // A(k:n-1,k) := S_k(k:n-1,k) = A(k:n-1,k) - X(t:end,0:t) Y(t,0:t)^T
+        {
+            auto aB1 = ViewRange( A, k, k, n, k+1 );
+            if( aB1.RowAlign() == aB1.RowRank() )
+            {
+                auto XB0 = LockedViewRange( X, t, 0, nBR, t+1 );
+                auto y10 = LockedViewRange( Y, t, 0, t+1, t+1 );
+                LocalGemv( NORMAL, F(-1), XB0, y10, F(1), aB1 );
+            }
+        }
+
+        // T(k,k) := S_k(k,k) - L(k,k-1) T(k-1,k) - T(k,k-1) conj(L(k,k-1))
+        const F lambda = X.Get(t,t);
+        const F lambdaConj = ( conjugate ? Conj(lambda) : lambda );
+        F delta = A.Get(k,k) - lambda*tauConj - tau*lambdaConj;
+        if( conjugate )
+            delta = RealPart(delta);
+        A.Set( k, k, delta );
+        if( k == n-1 )
+            break;
+
+        // Extend the lazy update to S_{k+1}: since X(t+1:end,t:t+1) holds
+        // L(k+1:n-1,k-1:k), Y(t+1:end,t:t+1) += conj(X(t+1:end,t:t+1)) M,
+        // and A(k+1:n-1,k) -= X(k+1:n-1,t:t+1) (conj(X(t,t:t+1)) M)^T
+        M.Set( 0, 0, F(0) );    M.Set( 0, 1, tau   );
+        M.Set( 1, 0, tauConj ); M.Set( 1, 1, delta );
+        m.Set( 0, 0, tauConj ); m.Set( 1, 0, tau*lambdaConj+delta );
+        auto XB = LockedViewRange( X, t+1, t, nBR, t+2 );
+        auto YB =       ViewRange( Y, t+1, t, nBR, t+2 );
+        auto a21 =      ViewRange( A, k+1, k, n,   k+1 );
+        Z.AlignWith( XB );
+        Z = XB;
+        if( conjugate )
+            Conjugate( Z );
+        dY.AlignWith( Z );
+        Zeros( dY, Z.Height(), 2 );
+        Gemm( NORMAL, NORMAL, F(1), Z.LockedMatrix(), M, F(0), dY.Matrix() );
+        dY_MR_STAR.AlignWith( YB );
+        dY_MR_STAR = dY;
+        Axpy( F(1), dY_MR_STAR.LockedMatrix(), YB.Matrix() );
+        if( a21.RowAlign() == a21.RowRank() )
+            Gemv( NORMAL, F(-1), XB.LockedMatrix(), m, F(1), a21.Matrix() );
+
+        // Pivot the largest entry of S_{k+1}(k+1:n-1,k) into position k+1
+        const auto a21Max = VectorMaxAbs( a21 );
+        const Int to = k+1;
+        const Int from = to + a21Max.index;
+        SymmetricSwap( LOWER, A, to, from, conjugate );
+        RowSwap( pPerm, to, from );
+        RowSwap( X, to-off, from-off );
+        RowSwap( Y, to-off, from-off );
+
+        // Store T(k+1,k) and L(k+2:n-1,k+1), and then copy L(:,k+1) into X
+        tau = A.Get(k+1,k);
+        auto l21 = ViewRange( A, k+2, k, n, k+1 );
+        if( tau != F(0) )
+            Scale( F(1)/tau, l21 );
+        X.Set( t+1, t+2, F(1) );
+        auto x21 = ViewRange( X, t+2, t+2, nBR, t+3 );
+        x21 = l21;
+    }
+}
+
+template<typename F>
+inline void
+Aasen( Matrix<F>& A, Matrix<Int>& pPerm, bool conjugate=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ltl::Aasen");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    const Int n = A.Height();
+
+    // Initialize the permutation to the identity
+    pPerm.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        pPerm.Set( i, 0, i );
+
+    Matrix<F> X, Y;
+    const Int bsize = Blocksize<F>("LTL");
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        Panel( A, pPerm, X, Y, nb, k, conjugate );
+
+        // A22 := A22 - X21 Y21^T, where only the lower triangle is updated
+        auto X21 = LockedViewRange( X, nb,   0,    n-k, nb+1 );
+        auto Y21 = LockedViewRange( Y, nb,   0,    n-k, nb+1 );
+        auto A22 =       ViewRange( A, k+nb, k+nb, n,   n    );
+        Trrk( LOWER, NORMAL, TRANSPOSE, F(-1), X21, Y21, F(1), A22 );
+    }
+}
+
+template<typename F,Dist UPerm>
+inline void
+Aasen
+( DistMatrix<F>& A, DistMatrix<Int,UPerm,STAR>& pPerm, bool conjugate=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ltl::Aasen");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Grid() != pPerm.Grid() )
+            LogicError("A and pPerm must share the same grid");
+    )
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    // Initialize the permutation to the identity
+    pPerm.Resize( n, 1 );
+    for( Int iLoc=0; iLoc<pPerm.LocalHeight(); ++iLoc )
+        pPerm.SetLocal( iLoc, 0, pPerm.GlobalRow(iLoc) );
+
+    DistMatrix<F,MC,STAR> X(g);
+    DistMatrix<F,MR,STAR> Y(g);
+    const Int bsize = Blocksize<F>("LTL",g);
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        Panel( A, pPerm, X, Y, nb, k, conjugate );
+
+        // A22 := A22 - X21 Y21^T, where only the lower triangle is updated
+        auto X21 = LockedViewRange( X, nb,   0,    n-k, nb+1 );
+        auto Y21 = LockedViewRange( Y, nb,   0,    n-k, nb+1 );
+        auto A22 =       ViewRange( A, k+nb, k+nb, n,   n    );
+        LocalTrrk( LOWER, TRANSPOSE, F(-1), X21, Y21, F(1), A22 );
+    }
+}
+
+} // namespace ltl
+} // namespace El
+
+#endif // ifndef EL_LTL_AASEN_HPP
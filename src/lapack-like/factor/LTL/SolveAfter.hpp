@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LTL_SOLVEAFTER_HPP
+#define EL_LTL_SOLVEAFTER_HPP
+
+namespace El {
+namespace ltl {
+
+// Overwrite B with inv(T) B, where T is the tridiagonal matrix with main
+// diagonal d, subdiagonal e, and superdiagonal conj(e) (or e), using Gaussian
+// elimination with partial pivoting (as in LAPACK's {s,d,c,z}gtsv)
+template<typename F>
+inline void
+TridiagonalSolve
+( const Matrix<F>& d, const Matrix<F>& e, Matrix<F>& B, bool conjugated )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ltl::TridiagonalSolve");
+        if( d.Height() != B.Height() )
+            LogicError("d and B must be the same height");
+        if( B.Height() > 0 && e.Height() != B.Height()-1 )
+            LogicError("e is the wrong size");
+    )
+    const Int n = B.Height();
+    const Int numRhs = B.Width();
+    if( n == 0 )
+        return;
+
+    // Form the diagonal, the first two superdiagonals, and the multipliers
+    std::vector<F> diag(n), sub(n), super(n), super2(n,F(0));
+    for( Int i=0; i<n; ++i )
+        diag[i] = d.Get(i,0);
+    for( Int i=0; i<n-1; ++i )
+    {
+        sub[i] = e.Get(i,0);
+        super[i] = ( conjugated ? Conj(sub[i]) : sub[i] );
+    }
+
+    for( Int i=0; i<n-1; ++i )
+    {
+        if( Abs(diag[i]) >= Abs(sub[i]) )
+        {
+            // No row interchange
+            if( diag[i] == F(0) )
+                throw SingularMatrixException();
+            const F fact = sub[i]/diag[i];
+            diag[i+1] -= fact*super[i];
+            for( Int j=0; j<numRhs; ++j )
+                B.Update( i+1, j, -fact*B.Get(i,j) );
+        }
+        else
+        {
+            // Interchange rows i and i+1
+            const F fact = diag[i]/sub[i];
+            diag[i] = sub[i];
+            const F temp = diag[i+1];
+            diag[i+1] = super[i] - fact*temp;
+            if( i < n-2 )
+            {
+                super2[i] = super[i+1];
+                super[i+1] = -fact*super2[i];
+            }
+            super[i] = temp;
+            for( Int j=0; j<numRhs; ++j )
+            {
+                const F beta = B.Get(i,j);
+                B.Set( i, j, B.Get(i+1,j) );
+                B.Set( i+1, j, beta-fact*B.Get(i+1,j) );
+            }
+        }
+    }
+    if( diag[n-1] == F(0) )
+        throw SingularMatrixException();
+
+    // Back substitution with the upper triangular factor
+    for( Int j=0; j<numRhs; ++j )
+    {
+        B.Set( n-1, j, B.Get(n-1,j)/diag[n-1] );
+        if( n > 1 )
+            B.Set
+            ( n-2, j, (B.Get(n-2,j)-super[n-2]*B.Get(n-1,j))/diag[n-2] );
+        for( Int i=n-3; i>=0; --i )
+            B.Set
+            ( i, j,
+              (B.Get(i,j)-super[i]*B.Get(i+1,j)-super2[i]*B.Get(i+2,j))/
+              diag[i] );
+    }
+}
+
+template<typename F>
+void SolveAfter
+( const Matrix<F>& A, const Matrix<Int>& pPerm, Matrix<F>& B,
+  bool conjugated )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ltl::SolveAfter");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Height() != B.Height() )
+            LogicError("A and B must be the same height");
+        if( pPerm.Height() != A.Height() )
+            LogicError("A and pPerm must be the same height");
+    )
+    const Int n = A.Height();
+    if( n == 0 )
+        return;
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+    const auto d = A.GetDiagonal();
+    const auto e = A.GetDiagonal(-1);
+
+    Matrix<Int> pInvPerm;
+    InvertPermutation( pPerm, pInvPerm );
+
+    // Since L = diag(1,L1), where the strictly lower triangle of L1 is stored
+    // in the strictly lower triangle of A(1:n-1,0:n-2), only the bottom n-1
+    // rows of B are modified by the triangular solves
+    auto L1 = LockedViewRange( A, 1, 0, n, n-1 );
+    auto B1 = ViewRange( B, 1, 0, n, B.Width() );
+    PermuteRows( B, pPerm, pInvPerm );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L1, B1 );
+    TridiagonalSolve( d, e, B, conjugated );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), L1, B1 );
+    PermuteRows( B, pInvPerm, pPerm );
+}
+
+template<typename F,Dist UPerm>
+void SolveAfter
+( const DistMatrix<F>& A, const DistMatrix<Int,UPerm,STAR>& pPerm,
+  DistMatrix<F>& B, bool conjugated )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ltl::SolveAfter");
+        if( A.Grid() != B.Grid() || A.Grid() != pPerm.Grid() )
+            LogicError("{A,B,pPerm} must be distributed over the same grid");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Height() != B.Height() )
+            LogicError("A and B must be the same height");
+        if( A.Height() != pPerm.Height() )
+            LogicError("A and pPerm must be the same height");
+    )
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( n == 0 )
+        return;
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+    DistMatrix<F,STAR,STAR> d( A.GetDiagonal() ), e( A.GetDiagonal(-1) );
+
+    DistMatrix<Int,UPerm,STAR> pInvPerm(g);
+    InvertPermutation( pPerm, pInvPerm );
+
+    // Since L = diag(1,L1), where the strictly lower triangle of L1 is stored
+    // in the strictly lower triangle of A(1:n-1,0:n-2), only the bottom n-1
+    // rows of B are modified by the triangular solves
+    auto L1 = LockedViewRange( A, 1, 0, n, n-1 );
+    auto B1 = ViewRange( B, 1, 0, n, B.Width() );
+    PermuteRows( B, pPerm, pInvPerm );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), L1, B1 );
+    {
+        // Each process redundantly solves against whole columns of B
+        DistMatrix<F,STAR,VR> B_STAR_VR( B );
+        TridiagonalSolve
+        ( d.LockedMatrix(), e.LockedMatrix(), B_STAR_VR.Matrix(), conjugated );
+        B = B_STAR_VR;
+    }
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), L1, B1 );
+    PermuteRows( B, pInvPerm, pPerm );
+}
+
+} // namespace ltl
+} // namespace El
+
+#endif // ifndef EL_LTL_SOLVEAFTER_HPP
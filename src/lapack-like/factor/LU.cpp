@@ -25,7 +25,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU");
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -45,6 +45,7 @@ template<typename F>
 void LU( DistMatrix<F>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("LU"))
+    ProfileRegion region("LU");
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> A21_MC_STAR(g);
@@ -54,7 +55,7 @@ void LU( DistMatrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU",g);
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -97,7 +98,7 @@ void LU( Matrix<F>& A, Matrix<Int>& pPerm )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU");
 
     // Initialize P to the identity matrix
     pPerm.Resize( m, 1 );
@@ -148,10 +149,11 @@ void LU( DistMatrix<F>& A, DistMatrix<Int,UPerm,STAR>& pPerm )
         if( A.Grid() != pPerm.Grid() )
             LogicError("{A,pPerm} must be distributed over the same grid");
     )
+    ProfileRegion region("LU");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("LU",A.Grid());
     const Grid& g = A.Grid();
 
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
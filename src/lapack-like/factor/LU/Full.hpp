@@ -69,6 +69,7 @@ Full
         if( A.Grid() != pPerm.Grid() || pPerm.Grid() != qPerm.Grid() )
             LogicError("Matrices must be distributed over the same grid");
     )
+    ProfileRegion region("lu::Full");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
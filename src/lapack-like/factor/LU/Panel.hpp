@@ -68,6 +68,7 @@ void Panel
         if( A.Width() != B.Width() )
             LogicError("A and B must be the same width");
     )
+    ProfileRegion region("lu::Panel",true);
     typedef Base<F> Real;
 
     // For packing rows of data for pivoting
@@ -14,6 +14,7 @@
 #include "./QR/Householder.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
+#include "./QR/Mod.hpp"
 #include "./QR/TS.hpp"
 
 namespace El {
@@ -129,6 +130,37 @@ Int QR
   ( LeftOrRight side, Orientation orientation, \
     const DistMatrix<F>& A, const DistMatrix<F,MD,STAR>& t, \
     const DistMatrix<Base<F>,MD,STAR>& d, DistMatrix<F>& B ); \
+  template void QRMod \
+  ( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& U, const Matrix<F>& V ); \
+  template void QRMod \
+  ( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, \
+    const DistMatrix<F,VC,STAR>& U, const DistMatrix<F,STAR,STAR>& V ); \
+  template void qr::AppendRows( Matrix<F>& R, const Matrix<F>& W ); \
+  template void qr::AppendRows \
+  ( DistMatrix<F,STAR,STAR>& R, const DistMatrix<F,STAR,STAR>& W ); \
+  template void qr::AppendRows \
+  ( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& W ); \
+  template void qr::AppendRows \
+  ( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, \
+    const DistMatrix<F,STAR,STAR>& W ); \
+  template void qr::DeleteRows( Matrix<F>& R, const Matrix<F>& W ); \
+  template void qr::DeleteRows \
+  ( DistMatrix<F,STAR,STAR>& R, const DistMatrix<F,STAR,STAR>& W ); \
+  template void qr::DeleteRows( Matrix<F>& Q, Matrix<F>& R, Int i, Int k ); \
+  template void qr::DeleteRows \
+  ( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, Int i, Int k ); \
+  template void qr::AppendColumns \
+  ( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& U ); \
+  template void qr::AppendColumns \
+  ( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, \
+    const DistMatrix<F,VC,STAR>& U ); \
+  template void qr::DeleteColumns( Matrix<F>& R, Int j, Int k ); \
+  template void qr::DeleteColumns \
+  ( DistMatrix<F,STAR,STAR>& R, Int j, Int k ); \
+  template void qr::DeleteColumns \
+  ( Matrix<F>& Q, Matrix<F>& R, Int j, Int k ); \
+  template void qr::DeleteColumns \
+  ( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, Int j, Int k ); \
   template void qr::Cholesky \
   ( Matrix<F>& A, Matrix<F>& R ); \
   template void qr::Cholesky \
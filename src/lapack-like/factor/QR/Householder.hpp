@@ -27,7 +27,7 @@ Householder( Matrix<F>& A, Matrix<F>& t, Matrix<Base<F>>& d )
     t.Resize( minDim, 1 );
     d.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("QR");
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -62,6 +62,7 @@ Householder
         if( A.Grid() != t.Grid() || t.Grid() != d.Grid() )
             LogicError("{A,t,d} must be distributed over the same grid");
     )
+    ProfileRegion region("qr::Householder");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
@@ -73,7 +74,7 @@ Householder
     t.Resize( minDim, 1 );
     d.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>("QR",A.Grid());
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -0,0 +1,752 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_QR_MOD_HPP
+#define EL_QR_MOD_HPP
+
+// Each of the following routines begins with a thin QR factorization
+//     A = Q R,
+// where Q is m x n with orthonormal columns and R is n x n and upper
+// triangular, and overwrites Q and R with a thin QR factorization of a
+// modification of A. Please see Section 12.5 of Golub and Van Loan's
+// "Matrix Computations" and
+//     J.W. Daniel, W.B. Gragg, L. Kaufman, and G.W. Stewart,
+//     "Reorthogonalization and stable algorithms for updating the Gram-Schmidt
+//      QR factorization"
+// for the underlying techniques. The distributed variants store Q as a
+// [VC,* ] matrix, so that rotating its columns is purely local, and R as a
+// redundant [* ,* ] matrix, as in qr::Cholesky.
+
+namespace El {
+namespace qr {
+
+namespace mod {
+
+// Apply the Givens rotation
+//     |       c   s |
+//     | -conj(s)  c |
+// to rows i and k of A, beginning with column jBeg
+template<typename F>
+inline void
+RotateRows( Matrix<F>& A, Int i, Int k, Int jBeg, Base<F> c, F s )
+{
+    const Int n = A.Width();
+    const Int ldim = A.LDim();
+    if( jBeg < n )
+        blas::Rot
+        ( n-jBeg, A.Buffer(i,jBeg), ldim, A.Buffer(k,jBeg), ldim, c, s );
+}
+
+// Apply the adjoint of the same rotation to columns i and k of Q from the
+// right so that the product of Q and R is unchanged
+template<typename F>
+inline void
+RotateColumns( Matrix<F>& Q, Int i, Int k, Base<F> c, F s )
+{
+    const Int m = Q.Height();
+    if( m > 0 )
+        blas::Rot( m, Q.Buffer(0,i), 1, Q.Buffer(0,k), 1, c, Conj(s) );
+}
+
+// Orthogonalize u against the columns of Q (with one step of
+// reorthogonalization), accumulate the coefficients into w, and return the
+// two-norm of the result
+template<typename F>
+inline Base<F>
+ProjectOut( const Matrix<F>& Q, Matrix<F>& u, Matrix<F>& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::mod::ProjectOut"))
+    Matrix<F> dw;
+    Zero( w );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( dw, Q.Width(), 1 );
+        Gemv( ADJOINT, F(1), Q, u, F(0), dw );
+        Gemv( NORMAL, F(-1), Q, dw, F(1), u );
+        Axpy( F(1), dw, w );
+    }
+    return FrobeniusNorm( u );
+}
+
+template<typename F>
+inline Base<F>
+ProjectOut
+( const DistMatrix<F,VC,STAR>& Q, DistMatrix<F,VC,STAR>& u,
+  DistMatrix<F,STAR,STAR>& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::mod::ProjectOut"))
+    DistMatrix<F,STAR,STAR> dw( Q.Grid() );
+    Zero( w );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( dw, Q.Width(), 1 );
+        Gemv
+        ( ADJOINT, F(1), Q.LockedMatrix(), u.LockedMatrix(),
+          F(0), dw.Matrix() );
+        dw.SumOver( Q.ColComm() );
+        Gemv
+        ( NORMAL, F(-1), Q.LockedMatrix(), dw.LockedMatrix(),
+          F(1), u.Matrix() );
+        Axpy( F(1), dw, w );
+    }
+    return FrobeniusNorm( u );
+}
+
+// Annihilate the last k rows of the (n+k) x n matrix RExt = [R; W] against
+// the upper-triangular matrix R, accumulating the rotations into the columns
+// of QExt
+template<typename F>
+inline void
+AppendRowsSweep( Matrix<F>& RExt, Matrix<F>& QExt )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::mod::AppendRowsSweep"))
+    const Int n = RExt.Width();
+    const Int k = RExt.Height() - n;
+    for( Int i=n; i<n+k; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            Base<F> c; F s;
+            lapack::Givens( RExt.Get(j,j), RExt.Get(i,j), &c, &s );
+            RotateRows( RExt, j, i, j, c, s );
+            RotateColumns( QExt, j, i, c, s );
+            RExt.Set( i, j, 0 );
+        }
+    }
+}
+
+// Given a row qRow of QExt = [Q u] which has unit norm, rotate it into its
+// last entry, updating the (n+1) x n matrix RExt = [R; 0] so that its first
+// n rows remain upper triangular
+template<typename F>
+inline void
+DeleteRowSweep( Matrix<F>& RExt, Matrix<F>& QExt, Matrix<F>& qRow )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::mod::DeleteRowSweep"))
+    const Int n = RExt.Width();
+    for( Int j=n-1; j>=0; --j )
+    {
+        Base<F> c; F s;
+        lapack::Givens( Conj(qRow.Get(0,n)), Conj(qRow.Get(0,j)), &c, &s );
+        RotateRows( RExt, n, j, j, c, s );
+        RotateColumns( QExt, n, j, c, s );
+        RotateColumns( qRow, n, j, c, s );
+    }
+}
+
+// Overwrite the (n+1) x n matrix RExt = [R; 0] and the (n+1)-vector w with
+// an upper-triangular factor of RExt + w v^H, accumulating the rotations into
+// the columns of QExt
+template<typename F>
+inline void
+RankOneSweep
+( Matrix<F>& RExt, Matrix<F>& QExt, Matrix<F>& w, const Matrix<F>& v )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::mod::RankOneSweep"))
+    const Int n = RExt.Width();
+
+    // Reduce w to a multiple of e0, which leaves RExt upper Hessenberg
+    for( Int i=n-1; i>=0; --i )
+    {
+        Base<F> c; F s;
+        const F rho = lapack::Givens( w.Get(i,0), w.Get(i+1,0), &c, &s );
+        w.Set( i,   0, rho );
+        w.Set( i+1, 0, 0   );
+        RotateRows( RExt, i, i+1, i, c, s );
+        RotateColumns( QExt, i, i+1, c, s );
+    }
+
+    // RExt(0,:) += w(0) v^H
+    const F omega = w.Get(0,0);
+    for( Int j=0; j<n; ++j )
+        RExt.Update( 0, j, omega*Conj(v.Get(j,0)) );
+
+    // Return RExt to upper-triangular form
+    for( Int i=0; i<n; ++i )
+    {
+        Base<F> c; F s;
+        lapack::Givens( RExt.Get(i,i), RExt.Get(i+1,i), &c, &s );
+        RotateRows( RExt, i, i+1, i, c, s );
+        RotateColumns( QExt, i, i+1, c, s );
+        RExt.Set( i+1, i, 0 );
+    }
+}
+
+// Restore the upper-triangularity of the n x (n-k) matrix RExt, whose
+// columns [j,n-k) each have k subdiagonal entries after deleting columns
+// [j,j+k) of R, accumulating the rotations into the columns of QExt
+template<typename F>
+inline void
+DeleteColumnsSweep( Matrix<F>& RExt, Matrix<F>& QExt, Int j )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::mod::DeleteColumnsSweep"))
+    const Int n = RExt.Height();
+    const Int k = n - RExt.Width();
+    for( Int jj=j; jj<n-k; ++jj )
+    {
+        for( Int i=jj+1; i<=jj+k; ++i )
+        {
+            Base<F> c; F s;
+            lapack::Givens( RExt.Get(jj,jj), RExt.Get(i,jj), &c, &s );
+            RotateRows( RExt, jj, i, jj, c, s );
+            RotateColumns( QExt, jj, i, c, s );
+            RExt.Set( i, jj, 0 );
+        }
+    }
+}
+
+} // namespace mod
+
+// A := [A; W]
+// ===========
+
+template<typename F>
+void AppendRows( Matrix<F>& R, const Matrix<F>& W )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::AppendRows");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( W.Width() != R.Width() )
+            LogicError("W must have the same width as R");
+    )
+    const Int n = R.Height();
+    const Int k = W.Height();
+    Matrix<F> RExt, QExt;
+    Zeros( RExt, n+k, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto RExtB = ViewRange( RExt, n, 0, n+k, n );
+    RExtT = R;
+    RExtB = W;
+    mod::AppendRowsSweep( RExt, QExt );
+    R = RExtT;
+}
+
+template<typename F>
+void AppendRows( DistMatrix<F,STAR,STAR>& R, const DistMatrix<F,STAR,STAR>& W )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::AppendRows"))
+    AppendRows( R.Matrix(), W.LockedMatrix() );
+}
+
+template<typename F>
+void AppendRows( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& W )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::AppendRows");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() || W.Width() != R.Width() )
+            LogicError("Q, R, and W must conform");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    const Int k = W.Height();
+    Matrix<F> RExt, QExt;
+    Zeros( RExt, n+k, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto RExtB = ViewRange( RExt, n, 0, n+k, n );
+    RExtT = R;
+    RExtB = W;
+    Zeros( QExt, m+k, n+k );
+    auto QExtTL = ViewRange( QExt, 0, 0, m,   n   );
+    auto QExtBR = ViewRange( QExt, m, n, m+k, n+k );
+    QExtTL = Q;
+    MakeIdentity( QExtBR );
+
+    mod::AppendRowsSweep( RExt, QExt );
+
+    auto QExtL = LockedViewRange( QExt, 0, 0, m+k, n );
+    R = RExtT;
+    Q = QExtL;
+}
+
+template<typename F>
+void AppendRows
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,STAR,STAR>& W )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::AppendRows");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() || W.Width() != R.Width() )
+            LogicError("Q, R, and W must conform");
+        if( Q.Grid() != R.Grid() || R.Grid() != W.Grid() )
+            LogicError("Q, R, and W must have the same grid");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    const Int k = W.Height();
+    Matrix<F> RExt;
+    Zeros( RExt, n+k, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto RExtB = ViewRange( RExt, n, 0, n+k, n );
+    RExtT = R.LockedMatrix();
+    RExtB = W.LockedMatrix();
+    DistMatrix<F,VC,STAR> QExt( Q.Grid() );
+    QExt.AlignWith( Q );
+    Zeros( QExt, m+k, n+k );
+    auto QExtTL = ViewRange( QExt, 0, 0, m,   n   );
+    auto QExtBR = ViewRange( QExt, m, n, m+k, n+k );
+    QExtTL = Q;
+    MakeIdentity( QExtBR );
+
+    mod::AppendRowsSweep( RExt, QExt.Matrix() );
+
+    auto QExtL = LockedViewRange( QExt, 0, 0, m+k, n );
+    R.Matrix() = RExtT;
+    Q = QExtL;
+}
+
+// A := A with the rows W removed
+// ==============================
+
+template<typename F>
+void DeleteRows( Matrix<F>& R, const Matrix<F>& W )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::DeleteRows");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( W.Width() != R.Width() )
+            LogicError("W must have the same width as R");
+    )
+    // R'^H R' = R^H R - W^H W
+    Matrix<F> V;
+    Adjoint( W, V );
+    CholeskyMod( UPPER, R, Base<F>(-1), V );
+}
+
+template<typename F>
+void DeleteRows( DistMatrix<F,STAR,STAR>& R, const DistMatrix<F,STAR,STAR>& W )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::DeleteRows"))
+    DeleteRows( R.Matrix(), W.LockedMatrix() );
+}
+
+// A := A with rows [i,i+k) removed
+// ================================
+
+template<typename F>
+void DeleteRows( Matrix<F>& Q, Matrix<F>& R, Int i, Int k )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::DeleteRows");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() )
+            LogicError("Q and R must conform");
+        if( i < 0 || k < 0 || i+k > Q.Height() )
+            LogicError("Invalid row range");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    if( m-k < n )
+        LogicError("Cannot delete so many rows from a thin QR factorization");
+    Matrix<F> RExt, QExt, qRow, w;
+    Zeros( RExt, n+1, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto rExt  = ViewRange( RExt, n, 0, n+1, n );
+    RExtT = R;
+    Zeros( QExt, m, n+1 );
+    auto QExtL = ViewRange( QExt, 0, 0, m, n   );
+    auto u     = ViewRange( QExt, 0, n, m, n+1 );
+    QExtL = Q;
+    Zeros( w, n, 1 );
+
+    for( Int r=i; r<i+k; ++r )
+    {
+        // u := (I - Q Q^H) e_r / || (I - Q Q^H) e_r ||_2, so that row r of
+        // [Q u] has unit norm
+        Zero( u );
+        u.Set( r, 0, F(1) );
+        const Base<F> alpha = mod::ProjectOut( QExtL, u, w );
+        if( alpha != Base<F>(0) )
+            Scale( F(1)/alpha, u );
+
+        Zero( rExt );
+        auto qRowView = LockedViewRange( QExt, r, 0, r+1, n+1 );
+        qRow = qRowView;
+        mod::DeleteRowSweep( RExt, QExt, qRow );
+    }
+
+    auto QExtT = LockedViewRange( QExt, 0,   0, i, n );
+    auto QExtB = LockedViewRange( QExt, i+k, 0, m, n );
+    Q.Resize( m-k, n );
+    auto QT = ViewRange( Q, 0, 0, i,   n );
+    auto QB = ViewRange( Q, i, 0, m-k, n );
+    QT = QExtT;
+    QB = QExtB;
+    R = RExtT;
+}
+
+template<typename F>
+void DeleteRows
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, Int i, Int k )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::DeleteRows");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() )
+            LogicError("Q and R must conform");
+        if( Q.Grid() != R.Grid() )
+            LogicError("Q and R must have the same grid");
+        if( i < 0 || k < 0 || i+k > Q.Height() )
+            LogicError("Invalid row range");
+    )
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    if( m-k < n )
+        LogicError("Cannot delete so many rows from a thin QR factorization");
+    Matrix<F> RExt, qRow;
+    Zeros( RExt, n+1, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto rExt  = ViewRange( RExt, n, 0, n+1, n );
+    RExtT = R.LockedMatrix();
+    DistMatrix<F,VC,STAR> QExt(g);
+    QExt.AlignWith( Q );
+    Zeros( QExt, m, n+1 );
+    auto QExtL = ViewRange( QExt, 0, 0, m, n   );
+    auto u     = ViewRange( QExt, 0, n, m, n+1 );
+    QExtL = Q;
+    DistMatrix<F,STAR,STAR> w( n, 1, g );
+
+    for( Int r=i; r<i+k; ++r )
+    {
+        Zero( u );
+        u.Set( r, 0, F(1) );
+        const Base<F> alpha = mod::ProjectOut( QExtL, u, w );
+        if( alpha != Base<F>(0) )
+            Scale( F(1)/alpha, u );
+
+        // Every process needs row r of [Q u] in order to form the rotations
+        Zero( rExt );
+        Zeros( qRow, 1, n+1 );
+        if( QExt.IsLocalRow(r) )
+        {
+            const Int rLoc = QExt.LocalRow(r);
+            auto qRowLoc =
+                LockedViewRange( QExt.LockedMatrix(), rLoc, 0, rLoc+1, n+1 );
+            qRow = qRowLoc;
+        }
+        mpi::Broadcast( qRow.Buffer(), n+1, QExt.RowOwner(r), QExt.ColComm() );
+        mod::DeleteRowSweep( RExt, QExt.Matrix(), qRow );
+    }
+
+    auto QExtT = LockedViewRange( QExt, 0,   0, i, n );
+    auto QExtB = LockedViewRange( QExt, i+k, 0, m, n );
+    Q.Resize( m-k, n );
+    auto QT = ViewRange( Q, 0, 0, i,   n );
+    auto QB = ViewRange( Q, i, 0, m-k, n );
+    QT = QExtT;
+    QB = QExtB;
+    R.Matrix() = RExtT;
+}
+
+// A := [A, U]
+// ===========
+
+template<typename F>
+void AppendColumns( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& U )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::AppendColumns");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() || U.Height() != Q.Height() )
+            LogicError("Q, R, and U must conform");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    const Int k = U.Width();
+    if( n+k > m )
+        LogicError("A thin QR factorization requires height >= width");
+    Matrix<F> RNew, QNew;
+    Zeros( RNew, n+k, n+k );
+    auto RNewTL = ViewRange( RNew, 0, 0, n, n );
+    RNewTL = R;
+    Zeros( QNew, m, n+k );
+    auto QNewL = ViewRange( QNew, 0, 0, m, n   );
+    auto QNewR = ViewRange( QNew, 0, n, m, n+k );
+    QNewL = Q;
+    QNewR = U;
+
+    // Classical Gram-Schmidt with reorthogonalization
+    for( Int j=n; j<n+k; ++j )
+    {
+        auto Q0  = LockedViewRange( QNew, 0, 0, m, j   );
+        auto q1  =       ViewRange( QNew, 0, j, m, j+1 );
+        auto r01 =       ViewRange( RNew, 0, j, j, j+1 );
+        const Base<F> rho = mod::ProjectOut( Q0, q1, r01 );
+        RNew.Set( j, j, rho );
+        if( rho != Base<F>(0) )
+            Scale( F(1)/rho, q1 );
+    }
+    R = RNew;
+    Q = QNew;
+}
+
+template<typename F>
+void AppendColumns
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,VC,STAR>& U )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::AppendColumns");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() || U.Height() != Q.Height() )
+            LogicError("Q, R, and U must conform");
+        if( Q.Grid() != R.Grid() || Q.Grid() != U.Grid() )
+            LogicError("Q, R, and U must have the same grid");
+    )
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    const Int k = U.Width();
+    if( n+k > m )
+        LogicError("A thin QR factorization requires height >= width");
+    DistMatrix<F,STAR,STAR> RNew(g);
+    Zeros( RNew, n+k, n+k );
+    auto RNewTL = ViewRange( RNew, 0, 0, n, n );
+    RNewTL = R;
+    DistMatrix<F,VC,STAR> QNew(g);
+    QNew.AlignWith( Q );
+    Zeros( QNew, m, n+k );
+    auto QNewL = ViewRange( QNew, 0, 0, m, n   );
+    auto QNewR = ViewRange( QNew, 0, n, m, n+k );
+    QNewL = Q;
+    QNewR = U;
+
+    for( Int j=n; j<n+k; ++j )
+    {
+        auto Q0  = LockedViewRange( QNew, 0, 0, m, j   );
+        auto q1  =       ViewRange( QNew, 0, j, m, j+1 );
+        auto r01 =       ViewRange( RNew, 0, j, j, j+1 );
+        const Base<F> rho = mod::ProjectOut( Q0, q1, r01 );
+        RNew.Set( j, j, rho );
+        if( rho != Base<F>(0) )
+            Scale( F(1)/rho, q1 );
+    }
+    R = RNew;
+    Q = QNew;
+}
+
+// A := A with columns [j,j+k) removed
+// ===================================
+
+template<typename F>
+void DeleteColumns( Matrix<F>& R, Int j, Int k )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::DeleteColumns");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( j < 0 || k < 0 || j+k > R.Width() )
+            LogicError("Invalid column range");
+    )
+    const Int n = R.Height();
+    Matrix<F> RExt, QExt;
+    Zeros( RExt, n, n-k );
+    auto RExtL = ViewRange( RExt, 0, 0, n, j   );
+    auto RExtR = ViewRange( RExt, 0, j, n, n-k );
+    auto RL = LockedViewRange( R, 0, 0,   n, j );
+    auto RR = LockedViewRange( R, 0, j+k, n, n );
+    RExtL = RL;
+    RExtR = RR;
+    mod::DeleteColumnsSweep( RExt, QExt, j );
+    auto RExtT = LockedViewRange( RExt, 0, 0, n-k, n-k );
+    R = RExtT;
+}
+
+template<typename F>
+void DeleteColumns( DistMatrix<F,STAR,STAR>& R, Int j, Int k )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::DeleteColumns"))
+    Matrix<F> RLoc( R.LockedMatrix() );
+    DeleteColumns( RLoc, j, k );
+    R.Resize( RLoc.Height(), RLoc.Width() );
+    R.Matrix() = RLoc;
+}
+
+template<typename F>
+void DeleteColumns( Matrix<F>& Q, Matrix<F>& R, Int j, Int k )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::DeleteColumns");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() )
+            LogicError("Q and R must conform");
+        if( j < 0 || k < 0 || j+k > R.Width() )
+            LogicError("Invalid column range");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    Matrix<F> RExt;
+    Zeros( RExt, n, n-k );
+    auto RExtL = ViewRange( RExt, 0, 0, n, j   );
+    auto RExtR = ViewRange( RExt, 0, j, n, n-k );
+    auto RL = LockedViewRange( R, 0, 0,   n, j );
+    auto RR = LockedViewRange( R, 0, j+k, n, n );
+    RExtL = RL;
+    RExtR = RR;
+    Matrix<F> QExt( Q );
+    mod::DeleteColumnsSweep( RExt, QExt, j );
+    auto RExtT = LockedViewRange( RExt, 0, 0, n-k, n-k );
+    auto QExtL = LockedViewRange( QExt, 0, 0, m,   n-k );
+    R = RExtT;
+    Q = QExtL;
+}
+
+template<typename F>
+void DeleteColumns
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R, Int j, Int k )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::DeleteColumns");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() )
+            LogicError("Q and R must conform");
+        if( Q.Grid() != R.Grid() )
+            LogicError("Q and R must have the same grid");
+        if( j < 0 || k < 0 || j+k > R.Width() )
+            LogicError("Invalid column range");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    Matrix<F> RExt;
+    Zeros( RExt, n, n-k );
+    auto RExtL = ViewRange( RExt, 0, 0, n, j   );
+    auto RExtR = ViewRange( RExt, 0, j, n, n-k );
+    auto RL = LockedViewRange( R.LockedMatrix(), 0, 0,   n, j );
+    auto RR = LockedViewRange( R.LockedMatrix(), 0, j+k, n, n );
+    RExtL = RL;
+    RExtR = RR;
+    DistMatrix<F,VC,STAR> QExt( Q );
+    mod::DeleteColumnsSweep( RExt, QExt.Matrix(), j );
+    auto RExtT = LockedViewRange( RExt, 0, 0, n-k, n-k );
+    auto QExtL = LockedViewRange( QExt, 0, 0, m,   n-k );
+    R.Resize( n-k, n-k );
+    R.Matrix() = RExtT;
+    Q = QExtL;
+}
+
+} // namespace qr
+
+// A := A + U V^H
+// ==============
+// Each of the k rank-one updates costs O(mn) work: u is orthogonalized
+// against Q, the resulting (n+1)-vector is rotated into a multiple of e0, and
+// the upper-Hessenberg [R; 0] + (w(0) e0) v^H is returned to triangular form
+
+template<typename F>
+void QRMod
+( Matrix<F>& Q, Matrix<F>& R, const Matrix<F>& U, const Matrix<F>& V )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("QRMod");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() )
+            LogicError("Q and R must conform");
+        if( U.Height() != Q.Height() || V.Height() != R.Width() ||
+            U.Width() != V.Width() )
+            LogicError("U and V must conform with Q and R");
+    )
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    const Int k = U.Width();
+    Matrix<F> RExt, QExt, w;
+    Zeros( RExt, n+1, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto rExt  = ViewRange( RExt, n, 0, n+1, n );
+    RExtT = R;
+    Zeros( QExt, m, n+1 );
+    auto QExtL = ViewRange( QExt, 0, 0, m, n   );
+    auto u     = ViewRange( QExt, 0, n, m, n+1 );
+    QExtL = Q;
+    Zeros( w, n+1, 1 );
+    auto wT = ViewRange( w, 0, 0, n, 1 );
+
+    for( Int t=0; t<k; ++t )
+    {
+        auto uCol = LockedViewRange( U, 0, t, m, t+1 );
+        auto v    = LockedViewRange( V, 0, t, n, t+1 );
+        u = uCol;
+        const Base<F> rho = qr::mod::ProjectOut( QExtL, u, wT );
+        if( rho != Base<F>(0) )
+            Scale( F(1)/rho, u );
+        w.Set( n, 0, rho );
+        Zero( rExt );
+        qr::mod::RankOneSweep( RExt, QExt, w, v );
+    }
+    R = RExtT;
+    Q = QExtL;
+}
+
+template<typename F>
+void QRMod
+( DistMatrix<F,VC,STAR>& Q, DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,VC,STAR>& U, const DistMatrix<F,STAR,STAR>& V )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("QRMod");
+        if( R.Height() != R.Width() )
+            LogicError("R must be square");
+        if( Q.Width() != R.Height() )
+            LogicError("Q and R must conform");
+        if( U.Height() != Q.Height() || V.Height() != R.Width() ||
+            U.Width() != V.Width() )
+            LogicError("U and V must conform with Q and R");
+        if( Q.Grid() != R.Grid() || Q.Grid() != U.Grid() ||
+            Q.Grid() != V.Grid() )
+            LogicError("Q, R, U, and V must have the same grid");
+    )
+    const Grid& g = Q.Grid();
+    const Int m = Q.Height();
+    const Int n = R.Height();
+    const Int k = U.Width();
+    Matrix<F> RExt;
+    Zeros( RExt, n+1, n );
+    auto RExtT = ViewRange( RExt, 0, 0, n,   n );
+    auto rExt  = ViewRange( RExt, n, 0, n+1, n );
+    RExtT = R.LockedMatrix();
+    DistMatrix<F,VC,STAR> QExt(g);
+    QExt.AlignWith( Q );
+    Zeros( QExt, m, n+1 );
+    auto QExtL = ViewRange( QExt, 0, 0, m, n   );
+    auto u     = ViewRange( QExt, 0, n, m, n+1 );
+    QExtL = Q;
+    DistMatrix<F,STAR,STAR> w( n+1, 1, g );
+    auto wT = ViewRange( w, 0, 0, n, 1 );
+
+    for( Int t=0; t<k; ++t )
+    {
+        auto uCol = LockedViewRange( U, 0, t, m, t+1 );
+        auto v    = LockedViewRange( V.LockedMatrix(), 0, t, n, t+1 );
+        u = uCol;
+        const Base<F> rho = qr::mod::ProjectOut( QExtL, u, wT );
+        if( rho != Base<F>(0) )
+            Scale( F(1)/rho, u );
+        w.Set( n, 0, rho );
+        Zero( rExt );
+        qr::mod::RankOneSweep( RExt, QExt.Matrix(), w.Matrix(), v );
+    }
+    R.Matrix() = RExtT;
+    Q = QExtL;
+}
+
+} // namespace El
+
+#endif // ifndef EL_QR_MOD_HPP
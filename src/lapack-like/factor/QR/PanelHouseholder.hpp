@@ -91,6 +91,7 @@ PanelHouseholder
         if( A.Grid() != t.Grid() || t.Grid() != d.Grid() )
             LogicError("{A,t,d} must be distributed over the same grid");
     )
+    ProfileRegion region("qr::PanelHouseholder");
     t.SetRoot( A.DiagonalRoot() );
     d.SetRoot( A.DiagonalRoot() );
     t.AlignCols( A.DiagonalAlign() );
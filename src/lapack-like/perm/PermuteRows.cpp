@@ -88,6 +88,7 @@ void PermuteRows( DistMatrix<T,U,V>& A, const PermutationMeta& oldMeta )
         if( A.ColAlign() != oldMeta.align )
             LogicError("Invalid alignment in metadata");
     )
+    ProfileRegion region("PermuteRows");
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
 
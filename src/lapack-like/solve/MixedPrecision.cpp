@@ -0,0 +1,506 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace mixed {
+
+// The precision used for the factorization
+template<typename F> struct LowerHelper { typedef F type; };
+template<> struct LowerHelper<double> { typedef float type; };
+template<> struct LowerHelper<Complex<double>> { typedef Complex<float> type; };
+template<typename F> using Lower = typename LowerHelper<F>::type;
+
+// B := A, where B has a different precision than A
+template<typename S,typename T>
+inline void
+Convert( const Matrix<S>& A, Matrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("mixed::Convert"))
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+    for( Int j=0; j<width; ++j )
+    {
+        const S* ACol = A.LockedBuffer(0,j);
+        T* BCol = B.Buffer(0,j);
+        for( Int i=0; i<height; ++i )
+            BCol[i] = T(ACol[i]);
+    }
+}
+
+template<typename S,typename T>
+inline void
+Convert( const DistMatrix<S>& A, DistMatrix<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("mixed::Convert");
+        if( A.Grid() != B.Grid() )
+            LogicError("A and B must use the same grid");
+    )
+    B.AlignWith( A.DistData() );
+    B.Resize( A.Height(), A.Width() );
+    Convert( A.LockedMatrix(), B.Matrix() );
+}
+
+template<typename F>
+inline Base<F>
+BackwardError
+( Base<F> frobA, const Matrix<F>& B, const Matrix<F>& X, const Matrix<F>& R )
+{
+    return FrobeniusNorm(R) / (frobA*FrobeniusNorm(X)+FrobeniusNorm(B));
+}
+
+template<typename F>
+inline Base<F>
+BackwardError
+( Base<F> frobA, const DistMatrix<F>& B, const DistMatrix<F>& X,
+  const DistMatrix<F>& R )
+{
+    return FrobeniusNorm(R) / (frobA*FrobeniusNorm(X)+FrobeniusNorm(B));
+}
+
+// Solve A d = r using GMRES(restart), left-preconditioned with the
+// lower-precision factorization, starting from d = 0. The number of
+// iterations is returned.
+template<typename F,class MatType>
+inline Int
+GMRES
+( std::function<void(F,const MatType&,F,MatType&)> applyA,
+  std::function<void(MatType&)> precondition,
+  const MatType& r, MatType& d, Int restart, Base<F> relTol )
+{
+    DEBUG_ONLY(CallStackEntry cse("mixed::GMRES"))
+    typedef Base<F> Real;
+    const Int n = r.Height();
+    Zeros( d, n, 1 );
+
+    // Every Krylov vector is a copy of r so that they are all aligned
+    std::vector<MatType> V;
+    V.reserve( restart+1 );
+    V.push_back( r );
+    precondition( V[0] );
+    const Real beta = FrobeniusNorm( V[0] );
+    if( beta == Real(0) )
+        return 0;
+    Scale( F(1)/beta, V[0] );
+
+    // Build the Arnoldi decomposition while maintaining the QR factorization
+    // of the upper Hessenberg matrix with Givens rotations
+    Matrix<F> H, s;
+    Zeros( H, restart+1, restart );
+    Zeros( s, restart+1, 1 );
+    s.Set( 0, 0, beta );
+    std::vector<Real> cs( restart );
+    std::vector<F> sn( restart );
+    Int numIts = 0;
+    MatType w( r );
+    for( Int j=0; j<restart; ++j )
+    {
+        applyA( F(1), V[j], F(0), w );
+        precondition( w );
+
+        // Modified Gram-Schmidt
+        for( Int i=0; i<=j; ++i )
+        {
+            const F eta = Dot( V[i], w );
+            H.Set( i, j, eta );
+            Axpy( -eta, V[i], w );
+        }
+        const Real wNorm = FrobeniusNorm( w );
+        H.Set( j+1, j, wNorm );
+
+        for( Int i=0; i<j; ++i )
+        {
+            const F eta0 = H.Get(i,j);
+            const F eta1 = H.Get(i+1,j);
+            H.Set( i,   j,  cs[i]*eta0 + sn[i]*eta1 );
+            H.Set( i+1, j, -Conj(sn[i])*eta0 + cs[i]*eta1 );
+        }
+        const F rho =
+            lapack::Givens( H.Get(j,j), H.Get(j+1,j), &cs[j], &sn[j] );
+        H.Set( j,   j, rho );
+        H.Set( j+1, j, 0 );
+        const F s0 = s.Get(j,0);
+        s.Set( j,   0, cs[j]*s0 );
+        s.Set( j+1, 0, -Conj(sn[j])*s0 );
+        numIts = j+1;
+
+        if( Abs(s.Get(j+1,0)) <= relTol*beta || wNorm == Real(0) )
+            break;
+        V.push_back( w );
+        Scale( F(1)/wNorm, V[j+1] );
+    }
+
+    // d := V y, where y solves the (now triangular) least squares problem
+    auto HTop = View( H, 0, 0, numIts, numIts );
+    auto y = View( s, 0, 0, numIts, 1 );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), HTop, y );
+    for( Int j=0; j<numIts; ++j )
+        Axpy( y.Get(j,0), V[j], d );
+    return numIts;
+}
+
+// Refine the lower-precision solution X of A X = B
+template<typename F,class MatType>
+inline MixedPrecisionInfo<Base<F>>
+Refine
+( std::function<void(F,const MatType&,F,MatType&)> applyA,
+  std::function<void(MatType&)> precondition,
+  Base<F> frobA, const MatType& B, MatType& X,
+  const MixedPrecisionCtrl<Base<F>>& ctrl, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("mixed::Refine"))
+    typedef Base<F> Real;
+    const Int n = B.Height();
+    const Int numRhs = B.Width();
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = ( ctrl.tol > Real(0) ? ctrl.tol : Sqrt(Real(n))*eps );
+    MixedPrecisionInfo<Real> info;
+
+    X = B;
+    precondition( X );
+    MatType R( B ), D( B );
+    applyA( F(-1), X, F(1), R );
+    Real omega = BackwardError( frobA, B, X, R );
+    if( print )
+        std::cout << "Initial backward error: " << omega << std::endl;
+
+    // Classical iterative refinement
+    while( omega > tol && info.numRefineIts < ctrl.maxRefineIts )
+    {
+        D = R;
+        precondition( D );
+        Axpy( F(1), D, X );
+        ++info.numRefineIts;
+
+        R = B;
+        applyA( F(-1), X, F(1), R );
+        const Real newOmega = BackwardError( frobA, B, X, R );
+        if( print )
+            std::cout << "Refinement step " << info.numRefineIts
+                      << ": backward error " << newOmega << std::endl;
+        const bool stalled = !(newOmega <= ctrl.minReduction*omega);
+        omega = newOmega;
+        if( stalled )
+            break;
+    }
+
+    // GMRES-IR
+    if( ctrl.gmres && omega > tol )
+    {
+        info.usedGMRES = true;
+        for( Int it=0; it<ctrl.maxGMRESIts; ++it )
+        {
+            for( Int j=0; j<numRhs; ++j )
+            {
+                auto r = LockedView( R, 0, j, n, 1 );
+                auto d = View( D, 0, j, n, 1 );
+                info.numGMRESIts +=
+                  GMRES
+                  ( applyA, precondition, r, d, ctrl.restart, ctrl.gmresTol );
+            }
+            Axpy( F(1), D, X );
+
+            R = B;
+            applyA( F(-1), X, F(1), R );
+            const Real newOmega = BackwardError( frobA, B, X, R );
+            if( print )
+                std::cout << "GMRES-IR step " << it+1 << ": backward error "
+                          << newOmega << std::endl;
+            const bool stalled = !(newOmega <= ctrl.minReduction*omega);
+            omega = newOmega;
+            if( omega <= tol || stalled )
+                break;
+        }
+    }
+
+    info.converged = ( omega <= tol );
+    info.backwardError = omega;
+    return info;
+}
+
+// Describe the solution X computed by a working-precision factorization after
+// refinement failed (or the lower-precision factorization broke down), so that
+// nothing is reported from the abandoned refinement
+template<typename F,class MatType>
+inline MixedPrecisionInfo<Base<F>>
+FallbackInfo
+( std::function<void(F,const MatType&,F,MatType&)> applyA,
+  Base<F> frobA, const MatType& B, const MatType& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("mixed::FallbackInfo"))
+    MixedPrecisionInfo<Base<F>> info;
+    info.fellBack = true;
+    MatType R( B );
+    applyA( F(-1), X, F(1), R );
+    info.backwardError = BackwardError( frobA, B, X, R );
+    return info;
+}
+
+} // namespace mixed
+
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionGaussianElimination
+( const Matrix<F>& A, Matrix<F>& B, const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("MixedPrecisionGaussianElimination");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Height() != B.Height() )
+            LogicError("A and B must be the same height");
+    )
+    typedef mixed::Lower<F> FLow;
+    MixedPrecisionInfo<Base<F>> info;
+
+    std::function<void(F,const Matrix<F>&,F,Matrix<F>&)> applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    const Base<F> frobA = FrobeniusNorm( A );
+
+    Matrix<FLow> ALow;
+    Matrix<Int> p;
+    mixed::Convert( A, ALow );
+    bool factored = true;
+    try { LU( ALow, p ); }
+    catch( SingularMatrixException& ) { factored = false; }
+
+    if( factored )
+    {
+        auto precondition = [&]( Matrix<F>& X )
+        {
+            Matrix<FLow> XLow;
+            mixed::Convert( X, XLow );
+            lu::SolveAfter( NORMAL, ALow, p, XLow );
+            mixed::Convert( XLow, X );
+        };
+        Matrix<F> X;
+        info = mixed::Refine<F,Matrix<F>>
+        ( applyA, precondition, frobA, B, X, ctrl, ctrl.progress );
+        if( info.converged || !ctrl.fallback )
+        {
+            B = X;
+            return info;
+        }
+    }
+    else if( !ctrl.fallback )
+        RuntimeError("Lower-precision LU factorization failed");
+
+    if( ctrl.progress )
+        std::cout << "Falling back to a full-precision factorization"
+                  << std::endl;
+    Matrix<F> ACopy( A ), X( B );
+    GaussianElimination( ACopy, X );
+    info = mixed::FallbackInfo<F,Matrix<F>>( applyA, frobA, B, X );
+    B = X;
+    return info;
+}
+
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionGaussianElimination
+( const DistMatrix<F>& A, DistMatrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("MixedPrecisionGaussianElimination");
+        if( A.Grid() != B.Grid() )
+            LogicError("{A,B} must be distributed over the same grid");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Height() != B.Height() )
+            LogicError("A and B must be the same height");
+    )
+    typedef mixed::Lower<F> FLow;
+    const Grid& g = A.Grid();
+    const bool print = ctrl.progress && g.Rank() == 0;
+    MixedPrecisionInfo<Base<F>> info;
+
+    std::function<void(F,const DistMatrix<F>&,F,DistMatrix<F>&)> applyA =
+      [&]( F alpha, const DistMatrix<F>& X, F beta, DistMatrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    const Base<F> frobA = FrobeniusNorm( A );
+
+    DistMatrix<FLow> ALow(g);
+    DistMatrix<Int,VC,STAR> p(g);
+    mixed::Convert( A, ALow );
+    bool factored = true;
+    try { LU( ALow, p ); }
+    catch( SingularMatrixException& ) { factored = false; }
+
+    if( factored )
+    {
+        auto precondition = [&]( DistMatrix<F>& X )
+        {
+            DistMatrix<FLow> XLow(g);
+            mixed::Convert( X, XLow );
+            lu::SolveAfter( NORMAL, ALow, p, XLow );
+            mixed::Convert( XLow, X );
+        };
+        DistMatrix<F> X(g);
+        X.AlignWith( B );
+        info = mixed::Refine<F,DistMatrix<F>>
+        ( applyA, precondition, frobA, B, X, ctrl, print );
+        if( info.converged || !ctrl.fallback )
+        {
+            B = X;
+            return info;
+        }
+    }
+    else if( !ctrl.fallback )
+        RuntimeError("Lower-precision LU factorization failed");
+
+    if( print )
+        std::cout << "Falling back to a full-precision factorization"
+                  << std::endl;
+    DistMatrix<F> ACopy( A ), X( B );
+    GaussianElimination( ACopy, X );
+    info = mixed::FallbackInfo<F,DistMatrix<F>>( applyA, frobA, B, X );
+    B = X;
+    return info;
+}
+
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionHPDSolve
+( UpperOrLower uplo, const Matrix<F>& A, Matrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("MixedPrecisionHPDSolve");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Height() != B.Height() )
+            LogicError("A and B must be the same height");
+    )
+    typedef mixed::Lower<F> FLow;
+    MixedPrecisionInfo<Base<F>> info;
+
+    std::function<void(F,const Matrix<F>&,F,Matrix<F>&)> applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+    const Base<F> frobA = HermitianFrobeniusNorm( uplo, A );
+
+    Matrix<FLow> ALow;
+    mixed::Convert( A, ALow );
+    bool factored = true;
+    try { Cholesky( uplo, ALow ); }
+    catch( NonHPDMatrixException& ) { factored = false; }
+
+    if( factored )
+    {
+        auto precondition = [&]( Matrix<F>& X )
+        {
+            Matrix<FLow> XLow;
+            mixed::Convert( X, XLow );
+            cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+            mixed::Convert( XLow, X );
+        };
+        Matrix<F> X;
+        info = mixed::Refine<F,Matrix<F>>
+        ( applyA, precondition, frobA, B, X, ctrl, ctrl.progress );
+        if( info.converged || !ctrl.fallback )
+        {
+            B = X;
+            return info;
+        }
+    }
+    else if( !ctrl.fallback )
+        RuntimeError("Lower-precision Cholesky factorization failed");
+
+    if( ctrl.progress )
+        std::cout << "Falling back to a full-precision factorization"
+                  << std::endl;
+    Matrix<F> ACopy( A ), X( B );
+    HPDSolve( uplo, NORMAL, ACopy, X );
+    info = mixed::FallbackInfo<F,Matrix<F>>( applyA, frobA, B, X );
+    B = X;
+    return info;
+}
+
+template<typename F>
+MixedPrecisionInfo<Base<F>> MixedPrecisionHPDSolve
+( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<F>& B,
+  const MixedPrecisionCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("MixedPrecisionHPDSolve");
+        if( A.Grid() != B.Grid() )
+            LogicError("{A,B} must be distributed over the same grid");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( A.Height() != B.Height() )
+            LogicError("A and B must be the same height");
+    )
+    typedef mixed::Lower<F> FLow;
+    const Grid& g = A.Grid();
+    const bool print = ctrl.progress && g.Rank() == 0;
+    MixedPrecisionInfo<Base<F>> info;
+
+    std::function<void(F,const DistMatrix<F>&,F,DistMatrix<F>&)> applyA =
+      [&]( F alpha, const DistMatrix<F>& X, F beta, DistMatrix<F>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+    const Base<F> frobA = HermitianFrobeniusNorm( uplo, A );
+
+    DistMatrix<FLow> ALow(g);
+    mixed::Convert( A, ALow );
+    bool factored = true;
+    try { Cholesky( uplo, ALow ); }
+    catch( NonHPDMatrixException& ) { factored = false; }
+
+    if( factored )
+    {
+        auto precondition = [&]( DistMatrix<F>& X )
+        {
+            DistMatrix<FLow> XLow(g);
+            mixed::Convert( X, XLow );
+            cholesky::SolveAfter( uplo, NORMAL, ALow, XLow );
+            mixed::Convert( XLow, X );
+        };
+        DistMatrix<F> X(g);
+        X.AlignWith( B );
+        info = mixed::Refine<F,DistMatrix<F>>
+        ( applyA, precondition, frobA, B, X, ctrl, print );
+        if( info.converged || !ctrl.fallback )
+        {
+            B = X;
+            return info;
+        }
+    }
+    else if( !ctrl.fallback )
+        RuntimeError("Lower-precision Cholesky factorization failed");
+
+    if( print )
+        std::cout << "Falling back to a full-precision factorization"
+                  << std::endl;
+    DistMatrix<F> ACopy( A ), X( B );
+    HPDSolve( uplo, NORMAL, ACopy, X );
+    info = mixed::FallbackInfo<F,DistMatrix<F>>( applyA, frobA, B, X );
+    B = X;
+    return info;
+}
+
+#define PROTO(F) \
+  template MixedPrecisionInfo<Base<F>> MixedPrecisionGaussianElimination \
+  ( const Matrix<F>& A, Matrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
+  template MixedPrecisionInfo<Base<F>> MixedPrecisionGaussianElimination \
+  ( const DistMatrix<F>& A, DistMatrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
+  template MixedPrecisionInfo<Base<F>> MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, const Matrix<F>& A, Matrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl ); \
+  template MixedPrecisionInfo<Base<F>> MixedPrecisionHPDSolve \
+  ( UpperOrLower uplo, const DistMatrix<F>& A, DistMatrix<F>& B, \
+    const MixedPrecisionCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
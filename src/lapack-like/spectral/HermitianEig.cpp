@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./HermitianEig/SDC.hpp"
+#include "./HermitianEig/Lanczos.hpp"
 
 // The targeted number of pieces to break the eigenvectors into during the
 // redistribution from the [* ,VR] distribution after PMRRR to the [MC,MR]
@@ -258,7 +259,14 @@ void HermitianEig
         ScaleTrapezoid( F(scale), uplo, A );
 
     // Tridiagonalize A
-    HermitianTridiag( uplo, A, ctrl.tridiagCtrl );
+    if( ctrl.useTwoStage )
+    {
+        DistMatrix<F,STAR,STAR> t(A.Grid());
+        BulgeReflectors<F> bulge;
+        herm_tridiag::TwoStage( uplo, A, t, bulge );
+    }
+    else
+        HermitianTridiag( uplo, A, ctrl.tridiagCtrl );
 
     // Solve the symmetric tridiagonal EVP
     const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
@@ -447,7 +455,11 @@ void HermitianEig
     // Tridiagonalize A
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> t(g);
-    HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
+    BulgeReflectors<F> bulge;
+    if( ctrl.useTwoStage )
+        herm_tridiag::TwoStage( uplo, A, t, bulge );
+    else
+        HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
 
     Int kEst;
     const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
@@ -526,7 +538,10 @@ void HermitianEig
     paddedZ.Resize( n, k ); // We can simply shrink matrices
 
     // Backtransform the tridiagonal eigenvectors, Z
-    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, paddedZ );
+    if( ctrl.useTwoStage )
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, bulge, paddedZ );
+    else
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, paddedZ );
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -595,10 +610,22 @@ void HermitianEig<Complex<float>>
   ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& w, \
     DistMatrix<F>& Q, const HermitianSdcCtrl<Base<F>> ctrl );
 
+// Thick-restart Lanczos
+#define LANCZOS_PROTO(F) \
+  template void herm_eig::Lanczos \
+  ( UpperOrLower uplo, const Matrix<F>& A, Int numEigs, \
+    Matrix<Base<F>>& w, Matrix<F>& Z, \
+    const HermitianLanczosCtrl<Base<F>>& ctrl ); \
+  template void herm_eig::Lanczos \
+  ( UpperOrLower uplo, const DistMatrix<F>& A, Int numEigs, \
+    DistMatrix<Base<F>,VR,STAR>& w, DistMatrix<F>& Z, \
+    const HermitianLanczosCtrl<Base<F>>& ctrl );
+
 #define PROTO(F) \
   EIGVAL_PROTO(F) \
   EIGPAIR_PROTO(F) \
-  SDC_PROTO(F)
+  SDC_PROTO(F) \
+  LANCZOS_PROTO(F)
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
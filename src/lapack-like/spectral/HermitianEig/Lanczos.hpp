@@ -0,0 +1,520 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANEIG_LANCZOS_HPP
+#define EL_HERMITIANEIG_LANCZOS_HPP
+
+namespace El {
+namespace herm_eig {
+
+// The Lanczos basis is stored as the local rows of a matrix whose rows are
+// distributed over 'comm' (i.e., the local data of a [VC,* ] matrix), so that
+// inner products only require a local product followed by a summation.
+
+template<typename F>
+inline Base<F>
+LanczosNorm( const Matrix<F>& xLoc, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::LanczosNorm"))
+    typedef Base<F> Real;
+    const Real localNorm = Nrm2( xLoc );
+    return Sqrt( mpi::AllReduce( localNorm*localNorm, comm ) );
+}
+
+// Two passes of classical Gram-Schmidt against the columns of V
+template<typename F>
+inline void
+LanczosOrthogonalize( const Matrix<F>& VLoc, Matrix<F>& wLoc, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::LanczosOrthogonalize"))
+    const Int k = VLoc.Width();
+    if( k == 0 )
+        return;
+    Matrix<F> h;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Zeros( h, k, 1 );
+        Gemv( ADJOINT, F(1), VLoc, wLoc, F(0), h );
+        mpi::AllReduce( h.Buffer(), k, comm );
+        Gemv( NORMAL, F(-1), VLoc, h, F(1), wLoc );
+    }
+}
+
+// Orthonormalize the columns of X, in order, with two passes of classical
+// Gram-Schmidt per column
+template<typename F>
+inline void
+LanczosOrthonormalize( Matrix<F>& XLoc, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::LanczosOrthonormalize"))
+    const Int localHeight = XLoc.Height();
+    for( Int j=0; j<XLoc.Width(); ++j )
+    {
+        auto XPrev = LockedView( XLoc, 0, 0, localHeight, j );
+        auto xj = View( XLoc, 0, j, localHeight, 1 );
+        LanczosOrthogonalize( XPrev, xj, comm );
+        Scale( F(1)/LanczosNorm(xj,comm), xj );
+    }
+}
+
+// Orthonormalize the converged Ritz vectors X, perform a Rayleigh-Ritz
+// projection onto their span, and check the true residuals || A x - theta x ||
+// rather than the Krylov estimates, which are unreliable once orthogonality
+// has been (partially) lost. On success, X and theta are overwritten with the
+// refined pairs.
+template<typename F>
+inline bool
+LanczosVerify
+( std::function<void(const Matrix<F>&,Matrix<F>&)> applyOp,
+  mpi::Comm comm, Base<F> tol, Matrix<Base<F>>& theta, Matrix<F>& XLoc )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::LanczosVerify"))
+    typedef Base<F> Real;
+    const Int localHeight = XLoc.Height();
+    const Int k = XLoc.Width();
+    LanczosOrthonormalize( XLoc, comm );
+
+    Matrix<F> AXLoc, H, Q, XNew, AXNew;
+    Zeros( AXLoc, localHeight, k );
+    for( Int j=0; j<k; ++j )
+    {
+        auto xj = LockedView( XLoc, 0, j, localHeight, 1 );
+        auto yj = View( AXLoc, 0, j, localHeight, 1 );
+        applyOp( xj, yj );
+    }
+    Zeros( H, k, k );
+    Gemm( ADJOINT, NORMAL, F(1), XLoc, AXLoc, F(0), H );
+    mpi::AllReduce( H.Buffer(), k*k, comm );
+    Matrix<Real> thetaNew;
+    HermitianEig( LOWER, H, thetaNew, Q, ASCENDING );
+    Zeros( XNew, localHeight, k );
+    Zeros( AXNew, localHeight, k );
+    Gemm( NORMAL, NORMAL, F(1), XLoc, Q, F(0), XNew );
+    Gemm( NORMAL, NORMAL, F(1), AXLoc, Q, F(0), AXNew );
+
+    // R := A X - X diag(theta)
+    Matrix<Real> residNorms;
+    Zeros( residNorms, k, 1 );
+    for( Int j=0; j<k; ++j )
+    {
+        auto xj = LockedView( XNew, 0, j, localHeight, 1 );
+        auto rj = View( AXNew, 0, j, localHeight, 1 );
+        Axpy( F(-thetaNew.Get(j,0)), xj, rj );
+        const Real localNorm = Nrm2( rj );
+        residNorms.Set( j, 0, localNorm*localNorm );
+    }
+    mpi::AllReduce( residNorms.Buffer(), k, comm );
+    for( Int j=0; j<k; ++j )
+        if( Sqrt(residNorms.Get(j,0)) > tol )
+            return false;
+    theta = thetaNew;
+    XLoc = XNew;
+    return true;
+}
+
+// Thick-restart Lanczos, following Wu and Simon, "Thick-restart Lanczos
+// method for large symmetric eigenvalue problems", SIAM J. Matrix Anal. Appl.,
+// Vol. 22, No. 2, 2000.
+//
+// After each restart, the basis begins with the 'p' kept Ritz vectors, which
+// are coupled to the next basis vector (the old residual direction) through
+// an arrow in the otherwise tridiagonal projection T. Rather than
+// reorthogonalizing every new basis vector against the entire basis, the
+// loss of orthogonality is estimated with the recurrence of Simon,
+// "The Lanczos algorithm with partial reorthogonalization", Math. Comp.,
+// Vol. 42, No. 165, 1984, generalized to the arrowhead structure, and a
+// new vector (and its successor) is only reorthogonalized once an estimate
+// exceeds sqrt(eps). Each restart requires O(n m p) work for a basis of size
+// m, and each expansion step requires a single application of the operator
+// and O(n) work, except for the occasional O(n m) reorthogonalization.
+//
+// The kept Ritz vectors are explicitly re-orthonormalized at each restart,
+// and, once the Krylov estimates indicate convergence, the wanted Ritz pairs
+// are only accepted if their true residuals also satisfy the tolerance;
+// otherwise the iteration is explicitly restarted with full
+// reorthogonalization.
+//
+// On exit, 'theta' holds the 'numEigs' wanted Ritz values of the operator
+// and 'XLoc' holds the local rows of the corresponding orthonormal Ritz
+// vectors.
+
+template<typename F>
+inline void
+ThickRestartLanczos
+( std::function<void(const Matrix<F>&,Matrix<F>&)> applyOp,
+  Int n, Int localHeight, mpi::Comm comm, Int numEigs,
+  Matrix<Base<F>>& theta, Matrix<F>& XLoc,
+  const HermitianLanczosCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::ThickRestartLanczos"))
+    typedef Base<F> Real;
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real orthogTol = Sqrt(eps);
+    const Real tol = ( ctrl.tol == Real(0) ? Pow(eps,Real(0.75)) : ctrl.tol );
+    const bool progress = ( ctrl.progress && mpi::Rank(comm) == 0 );
+    const Int k = numEigs;
+    Int m = ( ctrl.basisSize > 0 ? ctrl.basisSize : Max(2*k,k+20) );
+    m = Min( Max(m,k+1), n );
+
+    Matrix<F> VLoc, c, VNew, ZSel;
+    Matrix<Real> T, TCopy, Omega, ritzVals, Z;
+    Zeros( VLoc, localHeight, m+1 );
+    Zeros( T, m, m );
+    Identity( Omega, m+1, m+1 );
+
+    // Start from a random unit vector
+    auto v0 = View( VLoc, 0, 0, localHeight, 1 );
+    MakeGaussian( v0 );
+    Scale( F(1)/LanczosNorm(v0,comm), v0 );
+
+    std::vector<Int> order(m);
+    bool fullReorthog = ctrl.fullReorthog;
+    Real normEst = 0, beta = 0;
+    Int j0 = 0;
+    for( Int restart=0; restart<ctrl.maxRestarts; ++restart )
+    {
+        bool reorthogNext = false;
+        for( Int j=j0; j<m; ++j )
+        {
+            auto vj = LockedView( VLoc, 0, j, localHeight, 1 );
+            auto w = View( VLoc, 0, j+1, localHeight, 1 );
+            applyOp( vj, w );
+
+            // Remove the components recorded in column j of T: the arrow
+            // coupling to the kept Ritz vectors directly after a restart, and
+            // the previous basis vector otherwise
+            const Int jPrev = ( j == j0 ? 0 : j-1 );
+            if( j > jPrev )
+            {
+                Zeros( c, j-jPrev, 1 );
+                for( Int i=jPrev; i<j; ++i )
+                    c.Set( i-jPrev, 0, T.Get(i,j) );
+                auto VPrev = LockedView( VLoc, 0, jPrev, localHeight, j-jPrev );
+                Gemv( NORMAL, F(-1), VPrev, c, F(1), w );
+            }
+            const Real alpha =
+                RealPart(mpi::AllReduce(Dot(vj,w),comm));
+            Axpy( F(-alpha), vj, w );
+            T.Set( j, j, alpha );
+            if( j+1 == n )
+            {
+                // The basis spans the entire space
+                beta = 0;
+                break;
+            }
+            beta = LanczosNorm( w, comm );
+            Real colNorm = beta;
+            for( Int i=0; i<m; ++i )
+                colNorm += Abs(T.Get(i,j));
+            normEst = Max( normEst, colNorm );
+
+            // Estimate the inner products of the new vector with the basis
+            Real maxOmega = 0;
+            if( !fullReorthog && beta > eps*normEst )
+            {
+                for( Int i=0; i<j; ++i )
+                {
+                    Real omega = 0;
+                    for( Int l=0; l<=j; ++l )
+                        omega += T.Get(l,i)*Omega.Get(l,j) -
+                                 T.Get(l,j)*Omega.Get(l,i);
+                    omega += ( omega >= 0 ? 2 : -2 )*eps*normEst;
+                    omega /= beta;
+                    Omega.Set( j+1, i, omega );
+                    Omega.Set( i, j+1, omega );
+                    maxOmega = Max( maxOmega, Abs(omega) );
+                }
+            }
+            Omega.Set( j+1, j, eps );
+            Omega.Set( j, j+1, eps );
+
+            auto V = LockedView( VLoc, 0, 0, localHeight, j+1 );
+            const bool triggered = ( maxOmega > orthogTol );
+            if( fullReorthog || reorthogNext || triggered ||
+                beta <= eps*normEst )
+            {
+                LanczosOrthogonalize( V, w, comm );
+                beta = LanczosNorm( w, comm );
+                for( Int i=0; i<j; ++i )
+                {
+                    Omega.Set( j+1, i, eps );
+                    Omega.Set( i, j+1, eps );
+                }
+                reorthogNext = ( triggered && !reorthogNext );
+            }
+            else
+                reorthogNext = false;
+
+            if( beta <= eps*normEst )
+            {
+                // An invariant subspace was found, so continue with a random
+                // direction orthogonal to the current basis
+                MakeGaussian( w );
+                LanczosOrthogonalize( V, w, comm );
+                Scale( F(1)/LanczosNorm(w,comm), w );
+                beta = 0;
+            }
+            else
+                Scale( F(1)/beta, w );
+            if( j+1 < m )
+            {
+                T.Set( j+1, j, beta );
+                T.Set( j, j+1, beta );
+            }
+        }
+
+        // Compute the Ritz pairs and order them from most to least wanted
+        TCopy = T;
+        HermitianEig( LOWER, TCopy, ritzVals, Z, ASCENDING );
+        for( Int i=0; i<m; ++i )
+            order[i] = ( ctrl.target==LANCZOS_LARGEST ? m-1-i : i );
+        if( ctrl.target == LANCZOS_NEAREST )
+            std::stable_sort
+            ( order.begin(), order.end(),
+              [&]( Int a, Int b )
+              { return Abs(ritzVals.Get(a,0)) > Abs(ritzVals.Get(b,0)); } );
+
+        // The residual norm of the Ritz pair (theta_i,V z_i) is
+        // |beta e_{m-1}^T z_i|
+        const Real ritzNorm =
+            Max( Abs(ritzVals.Get(0,0)), Abs(ritzVals.Get(m-1,0)) );
+        Int numConverged = 0;
+        for( ; numConverged<k; ++numConverged )
+            if( Abs(beta*Z.Get(m-1,order[numConverged])) > tol*ritzNorm )
+                break;
+        if( progress )
+            std::cout << "Lanczos restart " << restart << ": "
+                      << numConverged << " of " << k
+                      << " Ritz pairs converged" << std::endl;
+
+        if( numConverged == k )
+        {
+            theta.Resize( k, 1 );
+            Zeros( ZSel, m, k );
+            for( Int jSel=0; jSel<k; ++jSel )
+            {
+                theta.Set( jSel, 0, ritzVals.Get(order[jSel],0) );
+                for( Int i=0; i<m; ++i )
+                    ZSel.Set( i, jSel, Z.Get(i,order[jSel]) );
+            }
+            auto V = LockedView( VLoc, 0, 0, localHeight, m );
+            Zeros( XLoc, localHeight, k );
+            Gemm( NORMAL, NORMAL, F(1), V, ZSel, F(0), XLoc );
+            if( LanczosVerify( applyOp, comm, tol*ritzNorm, theta, XLoc ) )
+                return;
+            if( progress )
+                std::cout << "Lanczos restart " << restart << ": true "
+                          << "residuals exceed the tolerance" << std::endl;
+
+            // The corrections made by partial reorthogonalization are not
+            // recorded in T, and the converged kept Ritz vectors are never
+            // updated by later expansions, so their errors cannot be removed
+            // by thick restarts. Instead, explicitly restart from the sum of
+            // the wanted Ritz vectors with full reorthogonalization.
+            fullReorthog = true;
+            Zeros( VLoc, localHeight, m+1 );
+            auto vStart = View( VLoc, 0, 0, localHeight, 1 );
+            for( Int jSel=0; jSel<k; ++jSel )
+                Axpy
+                ( F(1), LockedView(XLoc,0,jSel,localHeight,1), vStart );
+            Scale( F(1)/LanczosNorm(vStart,comm), vStart );
+            Zeros( T, m, m );
+            Identity( Omega, m+1, m+1 );
+            j0 = 0;
+            continue;
+        }
+
+        // Keep the p most wanted Ritz vectors, followed by the residual
+        const Int p = Min( m-1, k+(m-k)/2 );
+        Zeros( ZSel, m, p );
+        for( Int jSel=0; jSel<p; ++jSel )
+            for( Int i=0; i<m; ++i )
+                ZSel.Set( i, jSel, Z.Get(i,order[jSel]) );
+        auto V = LockedView( VLoc, 0, 0, localHeight, m );
+        Zeros( VNew, localHeight, p );
+        Gemm( NORMAL, NORMAL, F(1), V, ZSel, F(0), VNew );
+        auto VKeep = View( VLoc, 0, 0, localHeight, p );
+        VKeep = VNew;
+        auto vOld = LockedView( VLoc, 0, m, localHeight, 1 );
+        auto vResid = View( VLoc, 0, p, localHeight, 1 );
+        vResid = vOld;
+
+        // The kept Ritz vectors inherit any loss of orthogonality in the
+        // basis, so re-orthonormalize them (followed by the residual
+        // direction) rather than letting the error accumulate over restarts
+        auto VAct = View( VLoc, 0, 0, localHeight, p+1 );
+        LanczosOrthonormalize( VAct, comm );
+
+        Zeros( T, m, m );
+        for( Int jSel=0; jSel<p; ++jSel )
+        {
+            const Real s = beta*Z.Get(m-1,order[jSel]);
+            T.Set( jSel, jSel, ritzVals.Get(order[jSel],0) );
+            T.Set( p, jSel, s );
+            T.Set( jSel, p, s );
+        }
+
+        // The restarted basis is orthonormal to working precision
+        Identity( Omega, m+1, m+1 );
+        for( Int l=0; l<=p; ++l )
+            for( Int i=0; i<=p; ++i )
+                if( i != l )
+                    Omega.Set( i, l, eps );
+        j0 = p;
+    }
+    RuntimeError
+    ("Lanczos did not converge within ",ctrl.maxRestarts," restarts");
+}
+
+template<typename F>
+inline void
+Lanczos
+( UpperOrLower uplo, const Matrix<F>& A, Int numEigs,
+  Matrix<Base<F>>& w, Matrix<F>& Z,
+  const HermitianLanczosCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_eig::Lanczos");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( numEigs < 0 || numEigs > A.Height() )
+            LogicError("Invalid number of eigenpairs requested");
+    )
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( numEigs == 0 )
+    {
+        w.Resize( 0, 1 );
+        Z.Resize( n, 0 );
+        return;
+    }
+
+    // In shift-invert mode, the eigenvalues of A nearest the shift are found
+    // as the largest (in magnitude) eigenvalues of inv(A - shift I)
+    const bool shiftInvert = ( ctrl.target == LANCZOS_NEAREST );
+    Matrix<F> B, dSub;
+    Matrix<Int> p;
+    if( shiftInvert )
+    {
+        B = A;
+        MakeHermitian( uplo, B );
+        UpdateDiagonal( B, F(-ctrl.shift) );
+        if( ctrl.definiteShift )
+            Cholesky( LOWER, B );
+        else
+            LDL( B, dSub, p, true );
+    }
+
+    auto applyOp = [&]( const Matrix<F>& xLoc, Matrix<F>& yLoc )
+    {
+        if( shiftInvert )
+        {
+            yLoc = xLoc;
+            if( ctrl.definiteShift )
+                cholesky::SolveAfter( LOWER, NORMAL, B, yLoc );
+            else
+                ldl::SolveAfter( B, dSub, p, yLoc, true );
+        }
+        else
+            Hemv( uplo, F(1), A, xLoc, F(0), yLoc );
+    };
+
+    ThickRestartLanczos<F>
+    ( applyOp, n, n, mpi::COMM_SELF, numEigs, w, Z, ctrl );
+    if( shiftInvert )
+        for( Int j=0; j<numEigs; ++j )
+            w.Set( j, 0, ctrl.shift+Real(1)/w.Get(j,0) );
+    herm_eig::Sort( w, Z, ASCENDING );
+}
+
+template<typename F>
+inline void
+Lanczos
+( UpperOrLower uplo, const DistMatrix<F>& A, Int numEigs,
+  DistMatrix<Base<F>,VR,STAR>& w, DistMatrix<F>& Z,
+  const HermitianLanczosCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_eig::Lanczos");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( numEigs < 0 || numEigs > A.Height() )
+            LogicError("Invalid number of eigenpairs requested");
+    )
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    const bool shiftInvert = ( ctrl.target == LANCZOS_NEAREST );
+    DistMatrix<F> B(g), x(g), y(g);
+    DistMatrix<F,MD,STAR> dSub(g);
+    DistMatrix<Int,VC,STAR> p(g);
+    if( shiftInvert )
+    {
+        B = A;
+        MakeHermitian( uplo, B );
+        UpdateDiagonal( B, F(-ctrl.shift) );
+        if( ctrl.definiteShift )
+            Cholesky( LOWER, B );
+        else
+            LDL( B, dSub, p, true );
+    }
+
+    // The Lanczos vectors are stored in a [VC,* ] distribution
+    DistMatrix<F,VC,STAR> x_VC_STAR(g);
+    x_VC_STAR.Resize( n, 1 );
+    auto applyOp = [&]( const Matrix<F>& xLoc, Matrix<F>& yLoc )
+    {
+        x_VC_STAR.Matrix() = xLoc;
+        x = x_VC_STAR;
+        if( shiftInvert )
+        {
+            if( ctrl.definiteShift )
+                cholesky::SolveAfter( LOWER, NORMAL, B, x );
+            else
+                ldl::SolveAfter( B, dSub, p, x, true );
+            x_VC_STAR = x;
+        }
+        else
+        {
+            Zeros( y, n, 1 );
+            Hemv( uplo, F(1), A, x, F(0), y );
+            x_VC_STAR = y;
+        }
+        yLoc = x_VC_STAR.LockedMatrix();
+    };
+
+    // Every process redundantly holds the Ritz values
+    Matrix<Real> theta;
+    DistMatrix<F,VC,STAR> Z_VC_STAR(g);
+    Z_VC_STAR.Resize( n, numEigs );
+    if( numEigs > 0 )
+    {
+        ThickRestartLanczos<F>
+        ( applyOp, n, x_VC_STAR.LocalHeight(), x_VC_STAR.ColComm(), numEigs,
+          theta, Z_VC_STAR.Matrix(), ctrl );
+        if( shiftInvert )
+            for( Int j=0; j<numEigs; ++j )
+                theta.Set( j, 0, ctrl.shift+Real(1)/theta.Get(j,0) );
+        herm_eig::Sort( theta, Z_VC_STAR.Matrix(), ASCENDING );
+    }
+    else
+        theta.Resize( 0, 1 );
+    Z = Z_VC_STAR;
+
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR(g);
+    w_STAR_STAR.Resize( numEigs, 1 );
+    w_STAR_STAR.Matrix() = theta;
+    w = w_STAR_STAR;
+}
+
+} // namespace herm_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANEIG_LANCZOS_HPP
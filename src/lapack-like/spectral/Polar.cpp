@@ -33,7 +33,7 @@ void Polar( DistMatrix<F>& A, const PolarCtrl& ctrl )
     if( ctrl.qdwh )
         ctrl.numIts = polar::QDWH( A, ctrl );
     else
-        polar::SVD( A );
+        polar::SVD( A, ctrl.svdCtrl );
 }
 
 template<typename F>
@@ -53,7 +53,7 @@ void Polar( DistMatrix<F>& A, DistMatrix<F>& P, const PolarCtrl& ctrl )
     if( ctrl.qdwh )
         ctrl.numIts = polar::QDWH( A, P, ctrl );
     else
-        polar::SVD( A, P );
+        polar::SVD( A, P, ctrl.svdCtrl );
 }
 
 template<typename F>
@@ -53,7 +53,7 @@ SVD( Matrix<F>& A, Matrix<F>& P )
 
 template<typename F>
 inline void
-SVD( DistMatrix<F>& A )
+SVD( DistMatrix<F>& A, const SVDCtrl& ctrl=SVDCtrl() )
 {
     DEBUG_ONLY(CallStackEntry cse("polar::SVD"))
     // Get the SVD of A
@@ -62,7 +62,7 @@ SVD( DistMatrix<F>& A )
     DistMatrix<Real,VR,STAR> s(g);
     DistMatrix<F> U(g), V(g);
     U = A;
-    El::SVD( U, s, V );
+    El::SVD( U, s, V, ctrl );
 
     // Form Q := U V^H in A
     Gemm( NORMAL, ADJOINT, F(1), U, V, A );
@@ -70,7 +70,8 @@ SVD( DistMatrix<F>& A )
 
 template<typename F>
 inline void
-SVD( DistMatrix<F>& A, DistMatrix<F>& P )
+SVD
+( DistMatrix<F>& A, DistMatrix<F>& P, const SVDCtrl& ctrl=SVDCtrl() )
 {
     DEBUG_ONLY(CallStackEntry cse("polar::SVD"))
     // Get the SVD of A
@@ -79,7 +80,7 @@ SVD( DistMatrix<F>& A, DistMatrix<F>& P )
     DistMatrix<Real,VR,STAR> s(g);
     DistMatrix<F> U(g), V(g);
     U = A;
-    El::SVD( U, s, V );
+    El::SVD( U, s, V, ctrl );
 
     // Form Q := U V^H in A
     Gemm( NORMAL, ADJOINT, F(1), U, V, A );
@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./SVD/Chan.hpp"
+#include "./SVD/Randomized.hpp"
 #include "./SVD/Thresholded.hpp"
 
 namespace El {
@@ -72,8 +73,18 @@ void SVD
   double heightRatio )
 {
     DEBUG_ONLY(CallStackEntry cse("SVD"))
-    // TODO: Add more options
-    svd::Chan( A, s, V, heightRatio );
+    SVDCtrl ctrl;
+    ctrl.fullChanRatio = heightRatio;
+    SVD( A, s, V, ctrl );
+}
+
+template<typename F>
+void SVD
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
+  const SVDCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("SVD"))
+    svd::Chan( A, s, V, ctrl.fullChanRatio, ctrl.useTwoStage );
 }
 
 template<typename F>
@@ -157,8 +168,17 @@ template<typename F>
 void SVD( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio )
 {
     DEBUG_ONLY(CallStackEntry cse("SVD"))
-    // TODO: Add more options
-    svd::Chan( A, s, heightRatio );
+    SVDCtrl ctrl;
+    ctrl.valChanRatio = heightRatio;
+    SVD( A, s, ctrl );
+}
+
+template<typename F>
+void SVD
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, const SVDCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("SVD"))
+    svd::Chan( A, s, ctrl.valChanRatio, ctrl.useTwoStage );
 }
 
 template<typename F>
@@ -186,10 +206,15 @@ void HermitianSVD
   template void SVD \
   ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio ); \
   template void SVD \
+  ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, const SVDCtrl& ctrl ); \
+  template void SVD \
   ( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V, bool useQR ); \
   template void SVD \
   ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V, \
     double heightRatio ); \
+  template void SVD \
+  ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V, \
+    const SVDCtrl& ctrl ); \
   template void HermitianSVD \
   ( UpperOrLower uplo, Matrix<F>& A, Matrix<Base<F>>& s ); \
   template void HermitianSVD \
@@ -209,7 +234,21 @@ void HermitianSVD
   template void svd::TallThresholded \
   ( DistMatrix<F,VC,STAR>& A, \
     DistMatrix<Base<F>,STAR,STAR>& s, \
-    DistMatrix<F,STAR,STAR>& V, Base<F> tol, bool relative );
+    DistMatrix<F,STAR,STAR>& V, Base<F> tol, bool relative ); \
+  template void svd::RangeFinder \
+  ( const Matrix<F>& A, Int rank, Matrix<F>& Q, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void svd::RangeFinder \
+  ( const DistMatrix<F>& A, Int rank, DistMatrix<F>& Q, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void svd::Randomized \
+  ( const Matrix<F>& A, Int rank, \
+    Matrix<F>& U, Matrix<Base<F>>& s, Matrix<F>& V, \
+    const RandomizedSVDCtrl& ctrl ); \
+  template void svd::Randomized \
+  ( const DistMatrix<F>& A, Int rank, \
+    DistMatrix<F>& U, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V, \
+    const RandomizedSVDCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #include "El/macros/Instantiate.h"
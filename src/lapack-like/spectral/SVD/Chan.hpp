@@ -19,7 +19,7 @@ template<typename F>
 inline void
 ChanUpper
 ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
-  double heightRatio=1.5 )
+  double heightRatio=1.5, bool useTwoStage=false )
 {
     DEBUG_ONLY(
         CallStackEntry cse("svd::ChanUpper");
@@ -35,7 +35,7 @@ ChanUpper
     {
         DistMatrix<F> R(g);
         qr::Explicit( A, R );
-        svd::GolubReinsch( R, s, V );
+        svd::GolubReinsch( R, s, V, useTwoStage );
         // Unfortunately, extra memory is used in forming A := A R,
         // where A has been overwritten with the Q from the QR factorization
         // of the original state of A, and R has been overwritten with the U 
@@ -47,14 +47,15 @@ ChanUpper
     }
     else
     {
-        svd::GolubReinsch( A, s, V );
+        svd::GolubReinsch( A, s, V, useTwoStage );
     }
 }
 
 template<typename F>
 inline void
 ChanUpper
-( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2 )
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2,
+  bool useTwoStage=false )
 {
     DEBUG_ONLY(
         CallStackEntry cse("svd::ChanUpper");    
@@ -70,11 +71,11 @@ ChanUpper
         DistMatrix<F> AT(g), AB(g);
         PartitionDown( A, AT, AB, n );
         MakeTriangular( UPPER, AT );
-        GolubReinsch( AT, s );
+        GolubReinsch( AT, s, useTwoStage );
     }
     else
     {
-        GolubReinsch( A, s );
+        GolubReinsch( A, s, useTwoStage );
     }
 }
 
@@ -87,7 +88,7 @@ template<typename F>
 inline void
 Chan
 ( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
-  double heightRatio=1.5 )
+  double heightRatio=1.5, bool useTwoStage=false )
 {
     DEBUG_ONLY(
         CallStackEntry cse("svd::Chan");
@@ -104,14 +105,14 @@ Chan
     //       with a QR decomposition of tall-skinny matrices.
     if( A.Height() >= A.Width() )
     {
-        svd::ChanUpper( A, s, V, heightRatio );
+        svd::ChanUpper( A, s, V, heightRatio, useTwoStage );
     }
     else
     {
         // Explicit formation of the Q from an LQ factorization is not yet
         // optimized
         Adjoint( A, V );
-        svd::ChanUpper( V, s, A, heightRatio );
+        svd::ChanUpper( V, s, A, heightRatio, useTwoStage );
     }
 
     // Rescale the singular values if necessary
@@ -125,7 +126,9 @@ Chan
 
 template<typename F>
 inline void
-Chan( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2 )
+Chan
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2,
+  bool useTwoStage=false )
 {
     DEBUG_ONLY(CallStackEntry cse("svd::Chan"))
     // Check if we need to rescale the matrix, and do so if necessary
@@ -138,7 +141,7 @@ Chan( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2 )
     //       with a QR decomposition of tall-skinny matrices.
     if( A.Height() >= A.Width() )
     {
-        svd::ChanUpper( A, s, heightRatio );
+        svd::ChanUpper( A, s, heightRatio, useTwoStage );
     }
     else
     {
@@ -146,7 +149,7 @@ Chan( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, double heightRatio=1.2 )
         // optimized
         DistMatrix<F> AAdj( A.Grid() );
         Adjoint( A, AAdj );
-        svd::ChanUpper( AAdj, s, heightRatio );
+        svd::ChanUpper( AAdj, s, heightRatio, useTwoStage );
     }
 
     // Rescale the singular values if necessary
@@ -11,6 +11,7 @@
 #define EL_SVD_GOLUBREINSCH_HPP
 
 #include "./Util.hpp"
+#include "./TGK.hpp"
 
 namespace El {
 namespace svd {
@@ -18,7 +19,8 @@ namespace svd {
 template<typename F>
 inline void
 GolubReinsch
-( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V )
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
+  bool useTwoStage=false )
 {
     DEBUG_ONLY(CallStackEntry cse("svd::GolubReinsch"))
     typedef Base<F> Real;
@@ -26,69 +28,63 @@ GolubReinsch
     const Int n = A.Width();
     const Int k = Min( m, n );
     const Int offdiagonal = ( m>=n ? 1 : -1 );
-    const char uplo = ( m>=n ? 'U' : 'L' );
+    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
     const Grid& g = A.Grid();
 
     // Bidiagonalize A
     DistMatrix<F,STAR,STAR> tP( g ), tQ( g );
-    Bidiag( A, tP, tQ );
+    BulgeReflectors<F> bulgeP, bulgeQ;
+    if( useTwoStage )
+        bidiag::TwoStage( A, tP, tQ, bulgeP, bulgeQ );
+    else
+        Bidiag( A, tP, tQ );
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     auto d_MD_STAR = A.GetRealPartOfDiagonal();
     auto e_MD_STAR = A.GetRealPartOfDiagonal( offdiagonal );
-
-    // NOTE: lapack::BidiagQRAlg expects e to be of length k
     DistMatrix<Real,STAR,STAR> d_STAR_STAR( d_MD_STAR ),
-                               eHat_STAR_STAR( k, 1, g );
-    auto e_STAR_STAR = View( eHat_STAR_STAR, 0, 0, k-1, 1 );
-    e_STAR_STAR = e_MD_STAR;
+                               e_STAR_STAR( e_MD_STAR );
 
-    // Initialize U and VAdj to the appropriate identity matrices
-    DistMatrix<F,VC,STAR> U_VC_STAR( g );
-    U_VC_STAR.AlignWith( A );
-    Identity( U_VC_STAR, m, k );
-    DistMatrix<F,STAR,VC> VAdj_STAR_VC( g );
-    VAdj_STAR_VC.AlignWith( V );
-    Identity( VAdj_STAR_VC, k, n );
-
-    // Compute the SVD of the bidiagonal matrix and accumulate the Givens
-    // rotations into our local portion of U and VAdj
-    Matrix<F>& ULoc = U_VC_STAR.Matrix();
-    Matrix<F>& VAdjLoc = VAdj_STAR_VC.Matrix();
-    lapack::BidiagQRAlg
-    ( uplo, k, VAdjLoc.Width(), ULoc.Height(),
-      d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
-      VAdjLoc.Buffer(), VAdjLoc.LDim(), 
-      ULoc.Buffer(), ULoc.LDim() );
+    // Compute the SVD of the bidiagonal matrix through the distributed 
+    // MRRR solver applied to its Golub-Kahan form, so that each process only
+    // computes the singular vectors it owns
+    DistMatrix<F,STAR,VR> UHat_STAR_VR( g ), VHat_STAR_VR( g );
+    svd::TGK( uplo, d_STAR_STAR, e_STAR_STAR, s, UHat_STAR_VR, VHat_STAR_VR );
 
     // Make a copy of A (for the Householder vectors) and pull the necessary 
-    // portions of U and VAdj into a standard matrix dist.
+    // portions of U and V into a standard matrix dist.
     auto B( A );
     if( m >= n )
     {
         DistMatrix<F> AT(g), AB(g);
-        DistMatrix<F,VC,STAR> UT_VC_STAR(g), UB_VC_STAR(g);
         PartitionDown( A, AT, AB, n );
-        PartitionDown( U_VC_STAR, UT_VC_STAR, UB_VC_STAR, n );
-        AT = UT_VC_STAR;
+        AT = UHat_STAR_VR;
         Zero( AB );
-        Adjoint( VAdj_STAR_VC, V );
+        V = VHat_STAR_VR;
     }
     else
     {
-        auto VAdjL_STAR_VC = LockedView( VAdj_STAR_VC, 0, 0, k, m );
+        DistMatrix<F> AL(g), AR(g);
+        PartitionRight( A, AL, AR, m );
+        AL = UHat_STAR_VR;
+        Zero( AR );
+        Zeros( V, n, k );
         DistMatrix<F> VT(g), VB(g);
         PartitionDown( V, VT, VB, m );
-        Adjoint( VAdjL_STAR_VC, VT );
-        Zero( VB );
+        VT = VHat_STAR_VR;
     }
 
     // Backtransform U and V
-    bidiag::ApplyQ( LEFT, NORMAL, B, tQ, A );
-    bidiag::ApplyP( LEFT, NORMAL, B, tP, V );
-
-    // Copy out the appropriate subset of the singular values
-    s = d_STAR_STAR;
+    if( useTwoStage )
+    {
+        bidiag::ApplyQ( LEFT, NORMAL, B, tQ, bulgeQ, A );
+        bidiag::ApplyP( LEFT, NORMAL, B, tP, bulgeP, V );
+    }
+    else
+    {
+        bidiag::ApplyQ( LEFT, NORMAL, B, tQ, A );
+        bidiag::ApplyP( LEFT, NORMAL, B, tP, V );
+    }
 }
 
 #ifdef EL_HAVE_FLA_BSVD
@@ -174,29 +170,12 @@ GolubReinschFlame
     s = d_STAR_STAR;
 }
 
-template<>
-inline void
-GolubReinsch
-( DistMatrix<double>& A, DistMatrix<double,VR,STAR>& s, DistMatrix<double>& V )
-{
-    DEBUG_ONLY(CallStackEntry cse("svd::GolubReinsch"))
-    GolubReinschFlame( A, s, V );
-}
-
-template<>
-inline void
-GolubReinsch
-( DistMatrix<Complex<double>>& A, 
-  DistMatrix<double,VR,STAR>& s, DistMatrix<Complex<double>>& V )
-{
-    DEBUG_ONLY(CallStackEntry cse("svd::GolubReinsch"))
-    GolubReinschFlame( A, s, V );
-}
 #endif // HAVE_FLA_BSVD
 
 template<typename F>
 inline void
-GolubReinsch( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s )
+GolubReinsch
+( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s, bool useTwoStage=false )
 {
     DEBUG_ONLY(CallStackEntry cse("svd::GolubReinsch"))
     typedef Base<F> Real;
@@ -206,9 +185,15 @@ GolubReinsch( DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& s )
     const Int offdiagonal = ( m>=n ? 1 : -1 );
     const Grid& g = A.Grid();
 
-    // Bidiagonalize A
+    // Bidiagonalize A (the reflectors are not needed for the values alone)
     DistMatrix<F,STAR,STAR> tP(g), tQ(g);
-    Bidiag( A, tP, tQ );
+    if( useTwoStage )
+    {
+        BulgeReflectors<F> bulgeP, bulgeQ;
+        bidiag::TwoStage( A, tP, tQ, bulgeP, bulgeQ );
+    }
+    else
+        Bidiag( A, tP, tQ );
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     auto d_MD_STAR = A.GetRealPartOfDiagonal();
@@ -0,0 +1,191 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVD_RANDOMIZED_HPP
+#define EL_SVD_RANDOMIZED_HPP
+
+namespace El {
+namespace svd {
+
+// Overwrite the tall-skinny matrix Y with an orthonormal basis for its column
+// space, Y = Q R. TSQR is used when its requirements are met, and otherwise
+// we fall back to a Householder QR factorization.
+
+template<typename F>
+inline void
+Orthonormalize( Matrix<F>& Y, Matrix<F>& R )
+{
+    DEBUG_ONLY(CallStackEntry cse("svd::Orthonormalize"))
+    qr::Explicit( Y, R );
+}
+
+template<typename F>
+inline void
+Orthonormalize( DistMatrix<F,VC,STAR>& Y, DistMatrix<F,STAR,STAR>& R )
+{
+    DEBUG_ONLY(CallStackEntry cse("svd::Orthonormalize"))
+    const Grid& g = Y.Grid();
+    const Int p = g.Size();
+    if( PowerOfTwo(p) && Y.Height() >= p*Y.Width() )
+    {
+        qr::ExplicitTS( Y, R );
+    }
+    else
+    {
+        DistMatrix<F> YMat( Y ), RMat(g);
+        qr::Explicit( YMat, RMat );
+        Y = YMat;
+        R = RMat;
+    }
+}
+
+// Form an orthonormal basis Q for an approximation of the range of A from
+// A Omega, where Omega is a Gaussian matrix with rank+ctrl.oversample columns.
+// Each power iteration replaces Q with an orthonormal basis for A A^H Q,
+// which sharpens the approximation when the singular values decay slowly;
+// re-orthonormalizing in between avoids losing the smaller directions to
+// roundoff. The cost is O(m n l) for l = rank+ctrl.oversample.
+
+template<typename F>
+void RangeFinder
+( const Matrix<F>& A, Int rank, Matrix<F>& Q, const RandomizedSVDCtrl& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("svd::RangeFinder");
+        if( rank < 0 || ctrl.oversample < 0 )
+            LogicError("Rank and oversampling must be non-negative");
+    )
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int l = Min(rank+ctrl.oversample,Min(m,n));
+
+    Matrix<F> Omega, Z, R;
+    Gaussian( Omega, n, l );
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+    Orthonormalize( Q, R );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+        Orthonormalize( Z, R );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+        Orthonormalize( Q, R );
+    }
+}
+
+template<typename F>
+void RangeFinder
+( const DistMatrix<F>& A, Int rank, DistMatrix<F>& Q,
+  const RandomizedSVDCtrl& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("svd::RangeFinder");
+        if( rank < 0 || ctrl.oversample < 0 )
+            LogicError("Rank and oversampling must be non-negative");
+    )
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int l = Min(rank+ctrl.oversample,Min(m,n));
+
+    DistMatrix<F> Omega(g), Z(g);
+    DistMatrix<F,VC,STAR> Q_VC_STAR(g), Z_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    Gaussian( Omega, n, l );
+    Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+    Q_VC_STAR = Q;
+    Orthonormalize( Q_VC_STAR, R );
+    Q = Q_VC_STAR;
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+        Z_VC_STAR = Z;
+        Orthonormalize( Z_VC_STAR, R );
+        Z = Z_VC_STAR;
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+        Q_VC_STAR = Q;
+        Orthonormalize( Q_VC_STAR, R );
+        Q = Q_VC_STAR;
+    }
+}
+
+// Approximate the leading 'rank' singular triplets of A, A ~= U diag(s) V^H.
+// Given an orthonormal basis Q for the approximate range of A, we have
+// A ~= Q (Q^H A), and (Q^H A)^H = A^H Q = W R, where the small l x l matrix
+// R = U_R diag(s) V_R^H, so that A ~= (Q V_R) diag(s) (W U_R)^H.
+
+template<typename F>
+void Randomized
+( const Matrix<F>& A, Int rank,
+  Matrix<F>& U, Matrix<Base<F>>& s, Matrix<F>& V,
+  const RandomizedSVDCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("svd::Randomized"))
+    Matrix<F> Q;
+    RangeFinder( A, rank, Q, ctrl );
+    const Int l = Q.Width();
+    const Int k = Min(rank,l);
+
+    Matrix<F> W, R, VR;
+    Matrix<Base<F>> sR;
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, W );
+    Orthonormalize( W, R );
+    SVD( R, sR, VR );
+
+    auto URL = LockedView( R,  0, 0, l, k );
+    auto VRL = LockedView( VR, 0, 0, l, k );
+    Gemm( NORMAL, NORMAL, F(1), Q, VRL, U );
+    Gemm( NORMAL, NORMAL, F(1), W, URL, V );
+    Copy( LockedView( sR, 0, 0, k, 1 ), s );
+}
+
+template<typename F>
+void Randomized
+( const DistMatrix<F>& A, Int rank,
+  DistMatrix<F>& U, DistMatrix<Base<F>,VR,STAR>& s, DistMatrix<F>& V,
+  const RandomizedSVDCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("svd::Randomized"))
+    const Grid& g = A.Grid();
+    DistMatrix<F> Q(g);
+    RangeFinder( A, rank, Q, ctrl );
+    const Int l = Q.Width();
+    const Int k = Min(rank,l);
+
+    DistMatrix<F> W(g);
+    DistMatrix<F,VC,STAR> W_VC_STAR(g);
+    DistMatrix<F,STAR,STAR> R(g), VR(g);
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, W );
+    W_VC_STAR = W;
+    Orthonormalize( W_VC_STAR, R );
+
+    // Every process redundantly computes the SVD of the small matrix R
+    Matrix<Base<F>> sR;
+    VR.Resize( l, l );
+    SVD( R.Matrix(), sR, VR.Matrix() );
+
+    auto URL = LockedView( R,  0, 0, l, k );
+    auto VRL = LockedView( VR, 0, 0, l, k );
+    DistMatrix<F,VC,STAR> Q_VC_STAR( Q ), U_VC_STAR(g), V_VC_STAR(g);
+    U_VC_STAR.AlignWith( Q_VC_STAR );
+    LocalGemm( NORMAL, NORMAL, F(1), Q_VC_STAR, VRL, U_VC_STAR );
+    U = U_VC_STAR;
+    V_VC_STAR.AlignWith( W_VC_STAR );
+    LocalGemm( NORMAL, NORMAL, F(1), W_VC_STAR, URL, V_VC_STAR );
+    V = V_VC_STAR;
+
+    s.Resize( k, 1 );
+    const Int localHeight = s.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        s.SetLocal( iLoc, 0, sR.Get(s.GlobalRow(iLoc),0) );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_RANDOMIZED_HPP
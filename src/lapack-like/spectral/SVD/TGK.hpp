@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVD_TGK_HPP
+#define EL_SVD_TGK_HPP
+
+namespace El {
+namespace svd {
+
+// Compute the SVD of the real k x k bidiagonal matrix B = U diag(s) V^T,
+// with diagonal d and off-diagonal e, from the eigenpairs of the
+// Golub-Kahan (TGK) matrix, which is the 2k x 2k symmetric tridiagonal matrix
+// with zero diagonal and off-diagonal (d_0,e_0,d_1,e_1,...,d_{k-1}).
+//
+// When B is upper bidiagonal, each eigenpair (-sigma,[v_0;-u_0;v_1;-u_1;...])
+// of the TGK matrix, up to a scaling of 1/sqrt(2), yields a singular triplet
+// (sigma,u,v) of B. Since the k smallest eigenvalues of the TGK matrix are
+// the negated singular values in descending order, they are computed with
+// the distributed MRRR solver so that each process only forms the singular
+// vectors that it owns in the [* ,VR] distributions of U and V.
+// A lower bidiagonal B is handled through B^T, which swaps u and v.
+//
+// NOTE: The d and e vectors should be of length k and k-1, respectively.
+
+// Since the distributed MRRR solver only computes the TGK eigenvectors to
+// absolute accuracy, the u and v halves of the eigenvector of a small singular
+// value sigma_i are contaminated, on the order of eps ||B|| / sigma_i, by the
+// eigenvectors of the (uncomputed) nearby eigenvalues of opposite sign. And an
+// exactly zero singular value splits the TGK matrix, so that its eigenvector
+// lies entirely within one of the halves. A Householder QR factorization of
+// the singular vectors, with the columns ordered by descending singular value,
+// restores orthonormality while only perturbing U diag(s) V^H on the order of
+// eps ||B||, and it completes the bases for the zero singular values.
+
+template<typename F>
+inline void
+TGKOrthonormalize( DistMatrix<F,STAR,VR>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("svd::TGKOrthonormalize"))
+    typedef Base<F> Real;
+    DistMatrix<F> XMat( X ), R( X.Grid() );
+    qr::Explicit( XMat, R );
+
+    // Undo the phases introduced by the QR factorization
+    auto phase = R.GetDiagonal();
+    const Int localHeight = phase.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const F rho = phase.GetLocal(iLoc,0);
+        const Real rhoAbs = Abs(rho);
+        phase.SetLocal( iLoc, 0, ( rhoAbs == Real(0) ? F(1) : rho/rhoAbs ) );
+    }
+    DiagonalScale( RIGHT, NORMAL, phase, XMat );
+    X = XMat;
+}
+
+template<typename F>
+inline void
+TGK
+( UpperOrLower uplo,
+  const DistMatrix<Base<F>,STAR,STAR>& d,
+  const DistMatrix<Base<F>,STAR,STAR>& e,
+  DistMatrix<Base<F>,VR,STAR>& s,
+  DistMatrix<F,STAR,VR>& U, DistMatrix<F,STAR,VR>& V )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("svd::TGK");
+        if( d.Width() != 1 || e.Width() != 1 )
+            LogicError("d and e must be column vectors");
+        if( d.Height() > 0 && e.Height() != d.Height()-1 )
+            LogicError("e must be one entry shorter than d");
+    )
+    typedef Base<F> Real;
+    const Grid& g = d.Grid();
+    const Int k = d.Height();
+    if( k == 0 )
+    {
+        s.Resize( 0, 1 );
+        U.Resize( 0, 0 );
+        V.Resize( 0, 0 );
+        return;
+    }
+
+    // Form the off-diagonal of the TGK matrix (its diagonal is zero). Since
+    // the distributed MRRR solver only supports double-precision, the TGK
+    // eigenproblem is always solved in double-precision.
+    DistMatrix<double,STAR,STAR> tgkDiag(g), tgkSubdiag(g);
+    Zeros( tgkDiag, 2*k, 1 );
+    tgkSubdiag.Resize( 2*k-1, 1 );
+    for( Int j=0; j<k; ++j )
+    {
+        tgkSubdiag.SetLocal( 2*j, 0, d.GetLocal(j,0) );
+        if( j < k-1 )
+            tgkSubdiag.SetLocal( 2*j+1, 0, e.GetLocal(j,0) );
+    }
+
+    // Compute the k smallest eigenpairs, i.e., (-sigma_j,z_j) in descending
+    // order of sigma_j
+    DistMatrix<double,VR,STAR> w(g);
+    DistMatrix<double,STAR,VR> Z(g);
+    HermitianEigSubset<double> subset;
+    subset.indexSubset = true;
+    subset.lowerIndex = 0;
+    subset.upperIndex = k-1;
+    HermitianTridiagEig( tgkDiag, tgkSubdiag, w, Z, ASCENDING, subset );
+
+    // Negate the eigenvalues to recover the singular values
+    DistMatrix<Real,VR,STAR> sHat(g);
+    sHat.AlignWith( w );
+    sHat.Resize( k, 1 );
+    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        sHat.SetLocal( iLoc, 0, Real(-w.GetLocal(iLoc,0)) );
+    s = sHat;
+
+    // Unpack our local singular vectors, normalizing each half separately
+    // to avoid inheriting the loss of accuracy of the 1/sqrt(2) scaling
+    DistMatrix<F,STAR,VR>& X = ( uplo==UPPER ? V : U );
+    DistMatrix<F,STAR,VR>& Y = ( uplo==UPPER ? U : V );
+    X.AlignWith( Z );
+    Y.AlignWith( Z );
+    X.Resize( k, k );
+    Y.Resize( k, k );
+    const Int localWidth = Z.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const double* zCol = Z.LockedBuffer(0,jLoc);
+        F* xCol = X.Buffer(0,jLoc);
+        F* yCol = Y.Buffer(0,jLoc);
+        for( Int i=0; i<k; ++i )
+        {
+            xCol[i] =  Real(zCol[2*i]);
+            yCol[i] = -Real(zCol[2*i+1]);
+        }
+        const Real xNorm = blas::Nrm2( k, xCol, 1 );
+        const Real yNorm = blas::Nrm2( k, yCol, 1 );
+        if( xNorm != Real(0) )
+            blas::Scal( k, F(1/xNorm), xCol, 1 );
+        if( yNorm != Real(0) )
+            blas::Scal( k, F(1/yNorm), yCol, 1 );
+    }
+    TGKOrthonormalize( U );
+    TGKOrthonormalize( V );
+}
+
+} // namespace svd
+} // namespace El
+
+#endif // ifndef EL_SVD_TGK_HPP
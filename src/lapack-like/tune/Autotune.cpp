@@ -0,0 +1,223 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace tune {
+
+// Return the candidate with the smallest maximum runtime over the
+// communicator (so that every process agrees on the result)
+inline Int
+Fastest
+( std::string routine, const std::vector<Int>& candidates,
+  std::function<void(Int)> setCandidate,
+  std::function<void()> setup, std::function<void()> run,
+  Int numReps, mpi::Comm comm, bool progress )
+{
+    DEBUG_ONLY(CallStackEntry cse("tune::Fastest"))
+    if( candidates.size() == 0 )
+        LogicError("Need at least one candidate blocksize");
+    const Int commRank = mpi::Rank( comm );
+
+    Int bestCandidate = candidates[0];
+    double bestTime = std::numeric_limits<double>::max();
+    for( Int candidate : candidates )
+    {
+        setCandidate( candidate );
+        double time = 0;
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            setup();
+            mpi::Barrier( comm );
+            const double startTime = mpi::Time();
+            run();
+            time += mpi::Time() - startTime;
+        }
+        time = mpi::AllReduce( time, mpi::MAX, comm );
+        if( progress && commRank == 0 )
+            std::cout << "  " << routine << " with blocksize " << candidate
+                      << ": " << time/numReps << " seconds" << std::endl;
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestCandidate = candidate;
+        }
+    }
+    if( progress && commRank == 0 )
+        std::cout << "  " << routine << ": chose blocksize " << bestCandidate
+                  << std::endl;
+    return bestCandidate;
+}
+
+} // namespace tune
+
+template<typename F>
+void Autotune( const Grid& g, const AutotuneCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("Autotune"))
+    typedef Base<F> Real;
+    const Int n = ctrl.size;
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const std::string typeName = TypeName<F>();
+    mpi::Comm comm = g.Comm();
+
+    // Tuning requires the ability to override the tuned blocksizes with
+    // candidates, which is accomplished by pushing onto the blocksize stack
+    auto pushCandidate = []( Int nb )
+    {
+        PopBlocksizeStack();
+        PushBlocksizeStack( nb );
+    };
+    PushBlocksizeStack( Blocksize() );
+
+    DistMatrix<F> A(g), AOrig(g);
+    auto restore = [&]() { A = AOrig; };
+    Int nb;
+
+    // LU with partial pivoting
+    // ------------------------
+    DistMatrix<Int,VC,STAR> p(g);
+    Uniform( AOrig, n, n );
+    nb = tune::Fastest
+    ( "LU", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { LU( A, p ); }, ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "LU", typeName, r, c, nb );
+
+    // Householder QR
+    // --------------
+    nb = tune::Fastest
+    ( "QR", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { QR( A ); }, ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "QR", typeName, r, c, nb );
+
+    // Hessenberg reduction
+    // --------------------
+    nb = tune::Fastest
+    ( "Hessenberg", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { Hessenberg( LOWER, A ); }, ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "Hessenberg", typeName, r, c, nb );
+
+    // Bidiagonalization
+    // -----------------
+    nb = tune::Fastest
+    ( "Bidiag", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { Bidiag( A ); }, ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "Bidiag", typeName, r, c, nb );
+
+    // Cholesky
+    // --------
+    HermitianUniformSpectrum( AOrig, n, Real(1), Real(10) );
+    nb = tune::Fastest
+    ( "Cholesky", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { Cholesky( LOWER, A ); }, ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "Cholesky", typeName, r, c, nb );
+
+    // LDL^H
+    // -----
+    nb = tune::Fastest
+    ( "LDL", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { LDL( A, true ); }, ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "LDL", typeName, r, c, nb );
+
+    // Hermitian tridiagonalization
+    // ----------------------------
+    // A nonsquare grid either runs the pipelined algorithm on the full grid
+    // or drops down to a square subgrid, so each is tuned on the grid which
+    // it actually runs on
+    HermitianTridiagCtrl tridiagCtrl;
+    if( r != c )
+        tridiagCtrl.approach = HERMITIAN_TRIDIAG_NORMAL;
+    nb = tune::Fastest
+    ( "HermitianTridiag", ctrl.blocksizes, pushCandidate, restore,
+      [&]() { HermitianTridiag( LOWER, A, tridiagCtrl ); },
+      ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "HermitianTridiag", typeName, r, c, nb );
+    if( r != c )
+    {
+        const Int pSqrt = Int(sqrt(double(g.Size())));
+        tridiagCtrl.approach = HERMITIAN_TRIDIAG_SQUARE;
+        nb = tune::Fastest
+        ( "HermitianTridiag (square subgrid)", ctrl.blocksizes,
+          pushCandidate, restore,
+          [&]() { HermitianTridiag( LOWER, A, tridiagCtrl ); },
+          ctrl.numReps, comm, ctrl.progress );
+        SetTunedBlocksize( "HermitianTridiag", typeName, pSqrt, pSqrt, nb );
+    }
+
+    // The local kernels
+    // -----------------
+    // NOTE: These blocksizes are independent of the grid and are therefore
+    //       registered with the sequential (0 x 0) grid dimensions
+    DistMatrix<F> x(g), y(g);
+    Uniform( x, n, 1 );
+    Zeros( y, n, 1 );
+    nb = tune::Fastest
+    ( "LocalSymv", ctrl.localBlocksizes,
+      []( Int nb ) { SetLocalSymvBlocksize<F>( nb ); }, []() { },
+      [&]() { Hemv( LOWER, F(1), AOrig, x, F(0), y ); },
+      ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "LocalSymv", typeName, 0, 0, nb );
+
+    const Int k = Max( n/8, Int(1) );
+    DistMatrix<F> B(g), C(g);
+    Uniform( B, n, k );
+    Uniform( C, n, k );
+    nb = tune::Fastest
+    ( "LocalTrrk", ctrl.localBlocksizes,
+      []( Int nb ) { SetLocalTrrkBlocksize<F>( nb ); }, restore,
+      [&]() { Herk( LOWER, NORMAL, F(-1), B, F(1), A ); },
+      ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "LocalTrrk", typeName, 0, 0, nb );
+
+    nb = tune::Fastest
+    ( "LocalTrr2k", ctrl.localBlocksizes,
+      []( Int nb ) { SetLocalTrr2kBlocksize<F>( nb ); }, restore,
+      [&]() { Her2k( LOWER, NORMAL, F(-1), B, C, F(1), A ); },
+      ctrl.numReps, comm, ctrl.progress );
+    SetTunedBlocksize( "LocalTrr2k", typeName, 0, 0, nb );
+
+    // The sequential routines
+    // -----------------------
+    if( ctrl.sequential )
+    {
+        Matrix<F> ALoc, ALocOrig;
+        Matrix<Int> pLoc;
+        auto restoreLoc = [&]() { ALoc = ALocOrig; };
+
+        Uniform( ALocOrig, n, n );
+        nb = tune::Fastest
+        ( "LU", ctrl.blocksizes, pushCandidate, restoreLoc,
+          [&]() { LU( ALoc, pLoc ); }, ctrl.numReps, comm, ctrl.progress );
+        SetTunedBlocksize( "LU", typeName, 0, 0, nb );
+
+        nb = tune::Fastest
+        ( "QR", ctrl.blocksizes, pushCandidate, restoreLoc,
+          [&]() { QR( ALoc ); }, ctrl.numReps, comm, ctrl.progress );
+        SetTunedBlocksize( "QR", typeName, 0, 0, nb );
+
+        HermitianUniformSpectrum( ALocOrig, n, Real(1), Real(10) );
+        nb = tune::Fastest
+        ( "Cholesky", ctrl.blocksizes, pushCandidate, restoreLoc,
+          [&]() { Cholesky( LOWER, ALoc ); },
+          ctrl.numReps, comm, ctrl.progress );
+        SetTunedBlocksize( "Cholesky", typeName, 0, 0, nb );
+    }
+
+    PopBlocksizeStack();
+}
+
+#define PROTO(F) \
+  template void Autotune<F>( const Grid& g, const AutotuneCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -11,6 +11,7 @@
 #include "./SVT/Normal.hpp"
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
+#include "./SVT/Randomized.hpp"
 #include "./SVT/TSQR.hpp"
 
 namespace El {
@@ -75,6 +76,10 @@ Int SVT( DistMatrix<F,U,STAR>& A, Base<F> tau, bool relative )
   ( Matrix<F>& A, Base<F> tau, Int numSteps, bool relative ); \
   template Int svt::PivotedQR \
   ( DistMatrix<F>& A, Base<F> tau, Int numSteps, bool relative ); \
+  template Int svt::Randomized \
+  ( Matrix<F>& A, Base<F> tau, Int rank, bool relative ); \
+  template Int svt::Randomized \
+  ( DistMatrix<F>& A, Base<F> tau, Int rank, bool relative ); \
   PROTO_DIST(F,MC  ) \
   PROTO_DIST(F,MD  ) \
   PROTO_DIST(F,MR  ) \
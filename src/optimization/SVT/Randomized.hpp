@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+
+namespace svt {
+
+// Soft-threshold an approximation of the leading 'rank' singular triplets of
+// A computed with a randomized range finder. This is only accurate when the
+// number of singular values above the threshold is at most 'rank'.
+
+template<typename F>
+Int Randomized
+( Matrix<F>& A, Base<F> tau, Int rank, bool relative )
+{
+    DEBUG_ONLY(CallStackEntry cse("svt::Randomized"))
+    typedef Base<F> Real;
+    Matrix<F> U, V;
+    Matrix<Real> s;
+
+    svd::Randomized( A, rank, U, s, V );
+    SoftThreshold( s, tau, relative );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(0), A );
+
+    return ZeroNorm( s );
+}
+
+template<typename F>
+Int Randomized
+( DistMatrix<F>& A, Base<F> tau, Int rank, bool relative )
+{
+    DEBUG_ONLY(CallStackEntry cse("svt::Randomized"))
+    typedef Base<F> Real;
+    DistMatrix<F> U( A.Grid() ), V( A.Grid() );
+    DistMatrix<Real,VR,STAR> s( A.Grid() );
+
+    svd::Randomized( A, rank, U, s, V );
+    SoftThreshold( s, tau, relative );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, F(0), A );
+
+    return ZeroNorm( s );
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
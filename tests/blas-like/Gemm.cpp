@@ -178,6 +178,134 @@ void TestGemm
             Print( C, msg.str() );
         }
     }
+
+    // Test Cannon's algorithm against the default algorithm
+    if( g.Rank() == 0 )
+        cout << endl << "Cannon's Algorithm:" << endl;
+    MakeUniform( A );
+    MakeUniform( B );
+    MakeUniform( C );
+    DistMatrix<T> CCannon( C );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Gemm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, CCannon, GEMM_CANNON );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    {
+        const Base<T> frobRef = FrobeniusNorm( C );
+        Axpy( T(-1), CCannon, C );
+        const Base<T> frobDiff = FrobeniusNorm( C );
+        if( g.Rank() == 0 )
+        {
+            cout << "DONE. " << endl
+                 << "  Time = " << runTime << " seconds. GFlops = " 
+                 << gFlops << endl
+                 << "  || C_Cannon - C ||_F / || C ||_F = " 
+                 << frobDiff/frobRef << endl;
+        }
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        Print( CCannon, msg.str() );
+    }
+
+    // Test the 3D variant of Gemm against the default algorithm
+    const Int depth = 
+        ( Gemm3DDepth() > 0 ? Gemm3DDepth() : Grid3D::FindDepth(g.Size()) );
+    if( g.Rank() == 0 )
+        cout << endl << "3D Algorithm (depth=" << depth << "):" << endl;
+    MakeUniform( A );
+    MakeUniform( B );
+    MakeUniform( C );
+    DistMatrix<T> CRef( C );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Gemm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_3D );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+    Gemm( orientA, orientB, alpha, A, B, beta, CRef );
+    const Base<T> frobRef = FrobeniusNorm( CRef );
+    Axpy( T(-1), C, CRef );
+    const Base<T> frobDiff = FrobeniusNorm( CRef );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = " 
+             << gFlops << endl
+             << "  || C_3D - C ||_F / || C ||_F = " << frobDiff/frobRef 
+             << endl;
+    }
+    if( print )
+    {
+        ostringstream msg;
+        msg << "C := " << alpha << " A B + " << beta << " C";
+        Print( C, msg.str() );
+    }
+
+    // Test the sequential Strassen-Winograd and 3M algorithms against BLAS
+    const Int cutoff = StrassenCutoff();
+    const bool use3M = IsComplex<T>::val && Gemm3M();
+    if( cutoff > 0 || use3M )
+    {
+        if( g.Rank() == 0 )
+            cout << endl << "Sequential fast Gemm (Strassen cutoff=" << cutoff
+                 << ", 3M=" << use3M << "):" << endl;
+        Matrix<T> ALoc, BLoc, CLoc;
+        if( orientA == NORMAL )
+            Uniform( ALoc, m, k );
+        else
+            Uniform( ALoc, k, m );
+        if( orientB == NORMAL )
+            Uniform( BLoc, k, n );
+        else
+            Uniform( BLoc, n, k );
+        Uniform( CLoc, m, n );
+        Matrix<T> CLocRef( CLoc );
+        if( g.Rank() == 0 )
+        {
+            cout << "  Starting Gemm...";
+            cout.flush();
+        }
+        startTime = mpi::Time();
+        Gemm( orientA, orientB, alpha, ALoc, BLoc, beta, CLoc );
+        runTime = mpi::Time() - startTime;
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::val ? 4*realGFlops : realGFlops );
+        const bool saved3M = Gemm3M();
+        SetStrassenCutoff( 0 );
+        SetGemm3M( false );
+        Gemm( orientA, orientB, alpha, ALoc, BLoc, beta, CLocRef );
+        SetStrassenCutoff( cutoff );
+        SetGemm3M( saved3M );
+        const Base<T> frobLocRef = FrobeniusNorm( CLocRef );
+        Axpy( T(-1), CLoc, CLocRef );
+        const Base<T> frobLocDiff = FrobeniusNorm( CLocRef );
+        if( g.Rank() == 0 )
+        {
+            cout << "DONE. " << endl
+                 << "  Time = " << runTime << " seconds. GFlops = " 
+                 << gFlops << endl
+                 << "  || C_fast - C ||_F / || C ||_F = " 
+                 << frobLocDiff/frobLocRef << endl;
+        }
+    }
 }
 
 int 
@@ -198,6 +326,10 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int depth = Input("--depth","depth of 3D Gemm (0 for auto)",0);
+        const Int cutoff = 
+            Input("--cutoff","Strassen-Winograd cutoff (0 disables)",0);
+        const bool use3M = Input("--use3M","use 3M for complex Gemm?",false);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -209,6 +341,9 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemm3DDepth( depth );
+        SetStrassenCutoff( cutoff );
+        SetGemm3M( use3M );
 
         ComplainIfDebug();
         if( commRank == 0 )
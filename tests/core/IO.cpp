@@ -0,0 +1,218 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Write A in one distribution, read it back in another (both in parallel and
+// sequentially), and compare against the original
+template<typename T,Dist U,Dist V,Dist W,Dist Z>
+void
+Check
+( Int m, Int n, const Grid& g, FileFormat format, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Check"))
+    const Int commRank = g.Rank();
+    if( commRank == 0 )
+    {
+        std::cout << "Testing " << FileExtension(format) << " ["
+                  << DistToString(U) << "," << DistToString(V) << "] -> ["
+                  << DistToString(W) << "," << DistToString(Z) << "]...";
+        std::cout.flush();
+    }
+
+    DistMatrix<T,U,V> A(g);
+    Int colAlign = SampleUniform<Int>(0,A.ColStride());
+    Int rowAlign = SampleUniform<Int>(0,A.RowStride());
+    mpi::Broadcast( colAlign, 0, mpi::COMM_WORLD );
+    mpi::Broadcast( rowAlign, 0, mpi::COMM_WORLD );
+    A.Align( colAlign, rowAlign );
+    Uniform( A, m, n );
+    Write( A, basename, format );
+
+    const std::string filename = basename + "." + FileExtension(format);
+    DistMatrix<T,W,Z> B(g), BSeq(g);
+    if( format == BINARY_FLAT )
+    {
+        // Flat files do not record their dimensions
+        B.Resize( m, n );
+        BSeq.Resize( m, n );
+    }
+    Read( B, filename, format );
+    Read( BSeq, filename, format, true );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            BSeq_STAR_STAR( BSeq );
+    Int myErrorFlag = 0;
+    if( B.Height() != m || B.Width() != n ||
+        BSeq.Height() != m || BSeq.Width() != n )
+        myErrorFlag = 1;
+    for( Int j=0; j<n && myErrorFlag==0; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) ||
+                A_STAR_STAR.GetLocal(i,j) != BSeq_STAR_STAR.GetLocal(i,j) )
+            {
+                myErrorFlag = 1;
+                break;
+            }
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( commRank == 0 )
+        std::cout << ( summedErrorFlag == 0 ? "PASSED" : "FAILED" )
+                  << std::endl;
+}
+
+// Write a sharded checkpoint of A from grid gA and restart it in another
+// distribution on grid gB, which may have a different shape or size
+template<typename T,Dist U,Dist V,Dist W,Dist Z>
+void
+CheckSharded
+( Int m, Int n, const Grid& gA, const Grid& gB, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckSharded"))
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+    if( commRank == 0 )
+    {
+        std::cout << "Testing shard [" 
+                  << DistToString(U) << "," << DistToString(V) << "] ("
+                  << gA.Height() << " x " << gA.Width() << ") -> ["
+                  << DistToString(W) << "," << DistToString(Z) << "] ("
+                  << gB.Height() << " x " << gB.Width() << ")...";
+        std::cout.flush();
+    }
+
+    // Use entries which identify their position
+    DistMatrix<T,U,V> A(gA);
+    A.Resize( m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, T(A.GlobalRow(iLoc)+A.GlobalCol(jLoc)*m) );
+    Write( A, basename, BINARY_SHARDED );
+
+    DistMatrix<T,W,Z> B(gB);
+    Read( B, basename+"."+FileExtension(BINARY_SHARDED) );
+    Int myErrorFlag = ( B.Height() != m || B.Width() != n );
+    for( Int jLoc=0; jLoc<B.LocalWidth() && myErrorFlag==0; ++jLoc )
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            if( B.GetLocal(iLoc,jLoc) != 
+                T(B.GlobalRow(iLoc)+B.GlobalCol(jLoc)*m) )
+            {
+                myErrorFlag = 1;
+                break;
+            }
+    const Int summedErrorFlag = 
+        mpi::AllReduce( myErrorFlag, mpi::COMM_WORLD );
+    if( commRank == 0 )
+        std::cout << ( summedErrorFlag == 0 ? "PASSED" : "FAILED" )
+                  << std::endl;
+}
+
+// Write a local matrix and map it back into memory
+template<typename T>
+void
+CheckMapped( Int m, Int n, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckMapped"))
+    std::cout << "Testing mapped " << FileExtension(BINARY) << "...";
+    std::cout.flush();
+    Matrix<T> A;
+    Uniform( A, m, n );
+    Write( A, basename, BINARY );
+    MappedMatrix<T> AMapped( basename+"."+FileExtension(BINARY) );
+    const Matrix<T>& B = AMapped.LockedMatrix();
+    bool passed = ( B.Height() == m && B.Width() == n );
+    for( Int j=0; j<n && passed; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+            {
+                passed = false;
+                break;
+            }
+    std::cout << ( passed ? "PASSED" : "FAILED" ) 
+              << ( AMapped.Mapped() ? "" : " (read without mmap)" ) 
+              << std::endl;
+}
+
+template<typename T>
+void
+IOTest( Int m, Int n, const Grid& g, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("IOTest"))
+    if( g.Rank() == 0 )
+        CheckMapped<T>( m, n, basename+"-local" );
+
+    for( FileFormat format :
+         {BINARY,BINARY_FLAT,ASCII,ASCII_MATLAB,MATRIX_MARKET} )
+    {
+        Check<T,MC,  MR,  MC,  MR  >( m, n, g, format, basename );
+        Check<T,MC,  MR,  VR,  STAR>( m, n, g, format, basename );
+        Check<T,MC,  STAR,STAR,VC  >( m, n, g, format, basename );
+        Check<T,MD,  STAR,MR,  MC  >( m, n, g, format, basename );
+        Check<T,STAR,MR,  MC,  STAR>( m, n, g, format, basename );
+        Check<T,STAR,VR,  STAR,STAR>( m, n, g, format, basename );
+        Check<T,VC,  STAR,CIRC,CIRC>( m, n, g, format, basename );
+        Check<T,STAR,STAR,MC,  MR  >( m, n, g, format, basename );
+    }
+
+    // Restart on a grid of the transposed shape and on a subset of the 
+    // processes
+    mpi::Comm comm = g.Comm();
+    const Int commSize = mpi::Size( comm );
+    const Grid gTrans( comm, commSize/g.Height() );
+    const Int subsetSize = Max( commSize/2, 1 );
+    std::vector<int> subsetRanks(subsetSize);
+    for( Int q=0; q<subsetSize; ++q )
+        subsetRanks[q] = q;
+    mpi::Group group, subsetGroup;
+    mpi::CommGroup( comm, group );
+    mpi::Incl( group, subsetSize, subsetRanks.data(), subsetGroup );
+    const Grid gSubset( comm, subsetGroup, Grid::FindFactor(subsetSize) );
+
+    CheckSharded<T,MC,  MR,  MC,  MR  >( m, n, g, gTrans, basename );
+    CheckSharded<T,MC,  MR,  VR,  STAR>( m, n, g, gTrans, basename );
+    CheckSharded<T,MD,  STAR,STAR,VC  >( m, n, g, gTrans, basename );
+    CheckSharded<T,STAR,MR,  MC,  MR  >( m, n, g, gSubset, basename );
+    CheckSharded<T,MC,  MR,  MR,  MC  >( m, n, gSubset, g, basename );
+    CheckSharded<T,STAR,STAR,MC,  STAR>( m, n, g, gTrans, basename );
+    mpi::Free( subsetGroup );
+    mpi::Free( group );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int r = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const std::string basename =
+            Input("--basename","basename of test files",
+                  std::string("IOTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm, ( r==0 ? Grid::FindFactor(mpi::Size(comm)) : r ) );
+
+        if( commRank == 0 )
+            std::cout << "Testing with doubles:" << std::endl;
+        IOTest<double>( m, n, g, basename );
+
+        if( commRank == 0 )
+            std::cout << "Testing with double-precision complex:" << std::endl;
+        IOTest<Complex<double>>( m, n, g, basename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Read a symmetric coordinate-format Matrix Market file with a repeated
+// entry in parallel and compare against a sequential read
+template<typename T>
+void
+CheckCoordinate( Int n, const Grid& g, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckCoordinate"))
+    const Int commRank = g.Rank();
+    const std::string filename =
+        basename + "-coordinate." + FileExtension(MATRIX_MARKET);
+    if( commRank == 0 )
+    {
+        std::cout << "Testing coordinate " << FileExtension(MATRIX_MARKET)
+                  << "...";
+        std::cout.flush();
+        std::ofstream file( filename.c_str() );
+        file << "%%MatrixMarket matrix coordinate "
+             << ( IsComplex<T>::val ? "complex" : "real" ) << " symmetric\n"
+             << "% A comment\n"
+             << n << " " << n << " " << 2*n << "\n";
+        for( Int j=0; j<n; ++j )
+        {
+            file << j+1 << " " << j+1 << " 2"
+                 << ( IsComplex<T>::val ? " 1\n" : "\n" );
+            file << n << " " << j+1 << " -0.5"
+                 << ( IsComplex<T>::val ? " 0.25\n" : "\n" );
+        }
+    }
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<T> A(g), ASeq(g);
+    Read( A, filename, MATRIX_MARKET );
+    Read( ASeq, filename, MATRIX_MARKET, true );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), ASeq_STAR_STAR( ASeq );
+    Int myErrorFlag = ( A.Height() != n || A.Width() != n );
+    for( Int j=0; j<n && myErrorFlag==0; ++j )
+        for( Int i=0; i<n; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != ASeq_STAR_STAR.GetLocal(i,j) )
+            {
+                myErrorFlag = 1;
+                break;
+            }
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( commRank == 0 )
+        std::cout << ( summedErrorFlag == 0 ? "PASSED" : "FAILED" )
+                  << std::endl;
+}
+
+// Read an ASCII file whose tokens are longer than the fast path can handle
+// (some rows contain long decimal expansions and some do not) in parallel and
+// sequentially and compare against the C library's interpretation
+template<typename T>
+void
+CheckLongTokens( const Grid& g, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckLongTokens"))
+    typedef Base<T> Real;
+    const Int commRank = g.Rank();
+    const std::string filename = basename + "-long." + FileExtension(ASCII);
+    const std::string longA = "0." + std::string(76,'1');
+    const std::string longB = "-3." + std::string(75,'3') + "e-2";
+    const std::string tokens[3][2] =
+      { { longA, "5" }, { "2", "4" }, { longB, longA } };
+    if( commRank == 0 )
+    {
+        std::cout << "Testing long tokens in " << FileExtension(ASCII)
+                  << "...";
+        std::cout.flush();
+        std::ofstream file( filename.c_str() );
+        for( Int i=0; i<3; ++i )
+            file << tokens[i][0] << " " << tokens[i][1] << "\n";
+    }
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<T> A(g), ASeq(g);
+    Read( A, filename, ASCII );
+    Read( ASeq, filename, ASCII, true );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), ASeq_STAR_STAR( ASeq );
+    Int myErrorFlag = ( A.Height() != 3 || A.Width() != 2 ||
+                        ASeq.Height() != 3 || ASeq.Width() != 2 );
+    for( Int j=0; j<2 && myErrorFlag==0; ++j )
+        for( Int i=0; i<3; ++i )
+        {
+            const T alpha = Real(std::strtod(tokens[i][j].c_str(),nullptr));
+            if( A_STAR_STAR.GetLocal(i,j) != alpha ||
+                ASeq_STAR_STAR.GetLocal(i,j) != alpha )
+            {
+                myErrorFlag = 1;
+                break;
+            }
+        }
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( commRank == 0 )
+        std::cout << ( summedErrorFlag == 0 ? "PASSED" : "FAILED" )
+                  << std::endl;
+}
+
+// Reading a missing file should fail on every process rather than leaving
+// the others waiting on the root
+template<typename T>
+void
+CheckMissing( const Grid& g, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckMissing"))
+    const Int commRank = g.Rank();
+    for( FileFormat format : {ASCII,ASCII_MATLAB,MATRIX_MARKET} )
+    {
+        if( commRank == 0 )
+        {
+            std::cout << "Testing missing " << FileExtension(format) << "...";
+            std::cout.flush();
+        }
+        const std::string filename =
+            basename + "-missing." + FileExtension(format);
+        DistMatrix<T> A(g);
+        bool threw = false;
+        try { Read( A, filename, format ); }
+        catch( std::exception& ) { threw = true; }
+        const Int numFailed = mpi::AllReduce( Int(!threw), g.Comm() );
+        if( commRank == 0 )
+            std::cout << ( numFailed == 0 ? "PASSED" : "FAILED" )
+                      << std::endl;
+    }
+}
+
+// The round trips through each text format are tested along with the binary
+// formats in tests/core/IO.cpp
+template<typename T>
+void
+TextIOTest( Int n, const Grid& g, const std::string& basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("TextIOTest"))
+    CheckCoordinate<T>( n, g, basename );
+    CheckLongTokens<T>( g, basename );
+    CheckMissing<T>( g, basename );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int r = Input("--gridHeight","height of process grid",0);
+        const Int n = Input("--size","size of coordinate matrix",100);
+        const std::string basename =
+            Input("--basename","basename of test files",
+                  std::string("TextIOTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm, ( r==0 ? Grid::FindFactor(mpi::Size(comm)) : r ) );
+
+        if( commRank == 0 )
+            std::cout << "Testing with doubles:" << std::endl;
+        TextIOTest<double>( n, g, basename );
+
+        if( commRank == 0 )
+            std::cout << "Testing with double-precision complex:" << std::endl;
+        TextIOTest<Complex<double>>( n, g, basename );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
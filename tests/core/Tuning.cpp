@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+void Check( std::string description, bool passed, mpi::Comm comm )
+{
+    const Int numFailed = mpi::AllReduce( Int(!passed), comm );
+    if( mpi::Rank(comm) == 0 )
+        std::cout << "Testing " << description << "..."
+                  << ( numFailed == 0 ? "PASSED" : "FAILED" ) << std::endl;
+}
+
+// Sequential entries, 1 x 1 grid entries, and entries for the given grid
+// should all be distinct
+void CheckEntries
+( std::string description, const Grid& g, Int defaultBlocksize )
+{
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const bool oneByOne = ( r == 1 && c == 1 );
+    bool passed =
+        HaveTunedBlocksize( "LU", TypeName<double>(), 0, 0 ) &&
+        HaveTunedBlocksize( "LU", TypeName<double>(), 1, 1 ) &&
+        Blocksize<double>("LU") == 17 &&
+        Blocksize<double>("LU",1,1) == 23 &&
+        Blocksize<double>("Cholesky") == 29 &&
+        Blocksize<double>("Cholesky",g) ==
+        ( oneByOne ? defaultBlocksize : 31 );
+    if( !oneByOne )
+        passed = passed && Blocksize<double>("LU",g) == defaultBlocksize;
+
+    // There are no entries for other types or routines
+    passed = passed &&
+        !HaveTunedBlocksize( "LU", TypeName<float>(), 0, 0 ) &&
+        Blocksize<float>("LU") == defaultBlocksize &&
+        Blocksize<double>("QR") == defaultBlocksize;
+    Check( description, passed, g.Comm() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int r = Input("--gridHeight","height of process grid",0);
+        const std::string filename =
+            Input("--filename","name of the tuning file",
+                  std::string("TuningTest.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm, ( r==0 ? Grid::FindFactor(mpi::Size(comm)) : r ) );
+        const Int defaultBlocksize = Blocksize();
+
+        ClearTunedBlocksizes();
+        SetTunedBlocksize( "LU", TypeName<double>(), 0, 0, 17 );
+        SetTunedBlocksize( "LU", TypeName<double>(), 1, 1, 23 );
+        SetTunedBlocksize( "Cholesky", TypeName<double>(), 0, 0, 29 );
+        if( g.Height() != 1 || g.Width() != 1 )
+            SetTunedBlocksize
+            ( "Cholesky", TypeName<double>(), g.Height(), g.Width(), 31 );
+        CheckEntries
+        ( "distinct sequential and grid entries", g, defaultBlocksize );
+
+        bool rejected = false;
+        try { SetTunedBlocksize( "LU", TypeName<double>(), 1, 0, 8 ); }
+        catch( std::logic_error& ) { rejected = true; }
+        Check( "rejection of a partially sequential grid", rejected, comm );
+
+        SaveTuning( filename, comm );
+        ClearTunedBlocksizes();
+        Check
+        ( "clearing of the tuned blocksizes",
+          !HaveTunedBlocksize( "LU", TypeName<double>(), 0, 0 ) &&
+          Blocksize<double>("LU") == defaultBlocksize, comm );
+        LoadTuning( filename, comm );
+        CheckEntries( "SaveTuning/LoadTuning round trip", g, defaultBlocksize );
+
+        // Explicitly requested blocksizes take precedence over tuned values,
+        // first when pushed onto the stack and then when set as the default
+        PushBlocksizeStack( 5 );
+        Check
+        ( "precedence of a pushed blocksize",
+          Blocksize<double>("LU") == 5 && Blocksize<double>("LU",1,1) == 5,
+          comm );
+        PopBlocksizeStack();
+        Check
+        ( "restoration of tuned values after popping",
+          Blocksize<double>("LU") == 17, comm );
+        SetBlocksize( 7 );
+        Check
+        ( "precedence of a set blocksize",
+          Blocksize<double>("LU") == 7 && Blocksize<double>("LU",1,1) == 7 &&
+          Blocksize<double>("Cholesky",g) == 7, comm );
+
+        if( commRank == 0 )
+            std::remove( filename.c_str() );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
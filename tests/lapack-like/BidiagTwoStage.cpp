@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A,
+  const DistMatrix<F,STAR,STAR>& tP,
+  const DistMatrix<F,STAR,STAR>& tQ,
+  const BulgeReflectors<F>& bulgeP,
+  const BulgeReflectors<F>& bulgeQ,
+        DistMatrix<F>& AOrig,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = AOrig.Height();
+    const Int n = AOrig.Width();
+    const Real infNormAOrig = InfinityNorm( AOrig );
+    const Real frobNormAOrig = FrobeniusNorm( AOrig );
+    if( g.Rank() == 0 )
+        cout << "Testing error..." << endl;
+
+    // Grab the diagonal and off-diagonal of the bidiagonal matrix
+    auto d = A.GetDiagonal( 0 );
+    auto e = A.GetDiagonal( (m>=n ? 1 : -1) );
+
+    // Zero B and then fill its bidiagonal
+    DistMatrix<F> B(g);
+    B.AlignWith( A );
+    Zeros( B, m, n );
+    B.SetDiagonal( d, 0  );
+    B.SetDiagonal( e, (m>=n ? 1 : -1) );
+    if( print )
+        Print( B, "Bidiagonal" );
+
+    // Reverse the accumulated Householder transforms
+    bidiag::ApplyQ( LEFT,  ADJOINT, A, tQ, bulgeQ, AOrig );
+    bidiag::ApplyP( RIGHT, NORMAL,  A, tP, bulgeP, AOrig );
+    if( print )
+        Print( AOrig, "Manual bidiagonal" );
+
+    // Compare all of AOrig with B, since the band should have been annihilated
+    Axpy( F(-1), AOrig, B );
+    if( print )
+        Print( B, "Error in rotated bidiagonal" );
+    const Real infNormError = InfinityNorm( B );
+    const Real frobNormError = FrobeniusNorm( B );
+
+    // Compute || I - Q^H Q || and || I - P^H P ||
+    DistMatrix<F> Z(g);
+    Identity( Z, m, m );
+    bidiag::ApplyQ( LEFT, NORMAL,  A, tQ, bulgeQ, Z );
+    bidiag::ApplyQ( LEFT, ADJOINT, A, tQ, bulgeQ, Z );
+    UpdateDiagonal( Z, F(-1) );
+    const Real frobNormQError = FrobeniusNorm( Z );
+    Identity( Z, n, n );
+    bidiag::ApplyP( LEFT, NORMAL,  A, tP, bulgeP, Z );
+    bidiag::ApplyP( LEFT, ADJOINT, A, tP, bulgeP, Z );
+    UpdateDiagonal( Z, F(-1) );
+    const Real frobNormPError = FrobeniusNorm( Z );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_oo = " << infNormAOrig << "\n"
+             << "    ||A||_F  = " << frobNormAOrig << "\n"
+             << "    || I - Q^H Q ||_F  = " << frobNormQError << "\n"
+             << "    || I - P^H P ||_F  = " << frobNormPError << "\n"
+             << "    ||B - Q^H A P||_oo = " << infNormError << "\n"
+             << "    ||B - Q^H A P||_F  = " << frobNormError << endl;
+    }
+}
+
+template<typename F>
+void TestBidiagTwoStage
+( Int m, Int n, const Grid& g, bool testCorrectness, bool print )
+{
+    DistMatrix<F> A(g), AOrig(g);
+    DistMatrix<F,STAR,STAR> tP(g), tQ(g);
+    BulgeReflectors<F> bulgeP, bulgeQ;
+
+    Uniform( A, m, n );
+    if( testCorrectness )
+    {
+        if( g.Rank() == 0 )
+        {
+            cout << "  Making copy of original matrix...";
+            cout.flush();
+        }
+        AOrig = A;
+        if( g.Rank() == 0 )
+            cout << "DONE" << endl;
+    }
+    if( print )
+        Print( A, "A" );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting two-stage bidiagonalization...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    bidiag::TwoStage( A, tP, tQ, bulgeP, bulgeQ );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << std::endl;
+    }
+    if( print )
+    {
+        Print( A, "A after reduction" );
+        Print( tP, "tP after reduction" );
+        Print( tQ, "tQ after reduction" );
+    }
+    if( testCorrectness )
+        TestCorrectness( A, tP, tQ, bulgeP, bulgeQ, AOrig, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int nb = Input("--nb","algorithmic blocksize and bandwidth",32);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool testReal = Input("--testReal","test real matrices?",true);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test two-stage Bidiag" << endl;
+
+        if( testReal )
+        {
+            if( commRank == 0 )
+                cout << "Double-precision:" << endl;
+            TestBidiagTwoStage<double>( m, n, g, testCorrectness, print );
+        }
+        if( testCpx )
+        {
+            if( commRank == 0 )
+                cout << "Double-precision complex:" << endl;
+            TestBidiagTwoStage<Complex<double>>
+            ( m, n, g, testCorrectness, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -250,6 +250,18 @@ main( int argc, char* argv[] )
             TestHermitianEig<Complex<double>>
             ( testCorrectness, print, onlyEigvals, clustered, 
               uplo, m, sort, g, subset, ctrl );
+
+        if( commRank == 0 )
+            cout << "Two-stage tridiag algorithms:" << endl;
+        ctrl.useTwoStage = true;
+        if( testReal )
+            TestHermitianEig<double>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl );
+        if( testCpx )
+            TestHermitianEig<Complex<double>>
+            ( testCorrectness, print, onlyEigvals, clustered, 
+              uplo, m, sort, g, subset, ctrl );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  UpperOrLower uplo,
+  const DistMatrix<Base<F>,VR,STAR>& w,
+  const DistMatrix<F>& Z,
+  const DistMatrix<F>& AOrig,
+  const HermitianLanczosCtrl<Base<F>>& ctrl )
+{
+    typedef Base<F> Real;
+    const Grid& g = Z.Grid();
+    const Int n = Z.Height();
+    const Int k = Z.Width();
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of eigenvectors..." << endl;
+    DistMatrix<F> X(g);
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, F(-1), Z, F(1), X );
+    const Real frobNormOfOrthogError = HermitianFrobeniusNorm( LOWER, X );
+
+    // Form A Z - Z W
+    DistMatrix<F> ZW( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZW );
+    Zeros( X, n, k );
+    Hemm( LEFT, uplo, F(1), AOrig, Z, F(0), X );
+    Axpy( F(-1), ZW, X );
+    if( print )
+        Print( X, "A Z - Z W" );
+    const Real frobNormOfA = HermitianFrobeniusNorm( uplo, AOrig );
+    const Real frobNormOfError = FrobeniusNorm( X );
+
+    // Compare against the wanted eigenvalues from a full eigensolver
+    auto ACopy( AOrig );
+    DistMatrix<Real,VR,STAR> wExact(g);
+    HermitianEig( uplo, ACopy, wExact, ASCENDING );
+    DistMatrix<Real,STAR,STAR> wExact_STAR_STAR( wExact ), w_STAR_STAR( w );
+    vector<Real> wanted(n);
+    for( Int i=0; i<n; ++i )
+        wanted[i] = wExact_STAR_STAR.GetLocal(i,0);
+    if( ctrl.target == LANCZOS_LARGEST )
+        reverse( wanted.begin(), wanted.end() );
+    else if( ctrl.target == LANCZOS_NEAREST )
+        stable_sort
+        ( wanted.begin(), wanted.end(),
+          [&]( Real a, Real b )
+          { return Abs(a-ctrl.shift) < Abs(b-ctrl.shift); } );
+    wanted.resize( k );
+    sort( wanted.begin(), wanted.end() );
+    Real maxEigError = 0;
+    for( Int i=0; i<k; ++i )
+        maxEigError =
+            Max( maxEigError, Abs(wanted[i]-w_STAR_STAR.GetLocal(i,0)) );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||Z^H Z - I||_F     = " << frobNormOfOrthogError << "\n"
+             << "    ||A||_F             = " << frobNormOfA << "\n"
+             << "    ||A Z - Z W||_F     = " << frobNormOfError << "\n"
+             << "    max |w - wExact|    = " << maxEigError << "\n"
+             << endl;
+    }
+}
+
+template<typename F>
+void TestHermitianEigLanczos
+( bool testCorrectness, bool print, UpperOrLower uplo, Int n, Int numEigs,
+  const HermitianLanczosCtrl<Base<F>>& ctrl, const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), AOrig(g), Z(g);
+    DistMatrix<Real,VR,STAR> w(g);
+
+    HermitianUniformSpectrum( A, n, Real(-10), Real(10) );
+    if( testCorrectness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting Lanczos...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    herm_eig::Lanczos( uplo, A, numEigs, w, Z, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds." << endl;
+    if( print )
+    {
+        Print( w, "eigenvalues:" );
+        Print( Z, "eigenvectors:" );
+    }
+    if( testCorrectness )
+        TestCorrectness( print, uplo, w, Z, AOrig, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int n = Input("--size","size of Hermitian matrix",200);
+        const Int numEigs = Input("--numEigs","number of eigenpairs",5);
+        const Int target = Input
+            ("--target","0: smallest, 1: largest, 2: nearest shift",0);
+        const double shift = Input("--shift","shift for target 2",0.);
+        const bool definiteShift = Input
+            ("--definiteShift","is A - shift I HPD?",false);
+        const Int basisSize = Input("--basisSize","Krylov basis size",0);
+        const bool fullReorthog = Input
+            ("--fullReorthog","reorthogonalize every step?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool testReal = Input("--testReal","test real matrices?",true);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test Lanczos" << endl;
+
+        HermitianLanczosCtrl<double> ctrl;
+        ctrl.target = static_cast<HermitianLanczosTarget>(target);
+        ctrl.shift = shift;
+        ctrl.definiteShift = definiteShift;
+        ctrl.basisSize = basisSize;
+        ctrl.fullReorthog = fullReorthog;
+        ctrl.progress = progress;
+        if( testReal )
+        {
+            if( commRank == 0 )
+                cout << "Testing with doubles:" << endl;
+            TestHermitianEigLanczos<double>
+            ( testCorrectness, print, uplo, n, numEigs, ctrl, g );
+        }
+        if( testCpx )
+        {
+            if( commRank == 0 )
+                cout << "Testing with double-precision complex:" << endl;
+            TestHermitianEigLanczos<Complex<double>>
+            ( testCorrectness, print, uplo, n, numEigs, ctrl, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
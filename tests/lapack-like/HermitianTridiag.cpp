@@ -201,6 +201,16 @@ main( int argc, char* argv[] )
             TestHermitianTridiag<Complex<double>>
             ( uplo, m, g, testCorrectness, print, display, ctrl );
 
+        if( commRank == 0 )
+            cout << "Cost-model selected algorithm:" << endl;
+        ctrl.approach = HERMITIAN_TRIDIAG_DEFAULT;
+        if( testReal )
+            TestHermitianTridiag<double>
+            ( uplo, m, g, testCorrectness, print, display, ctrl );
+        if( testCpx )
+            TestHermitianTridiag<Complex<double>>
+            ( uplo, m, g, testCorrectness, print, display, ctrl );
+
         if( commRank == 0 )
             cout << "Square row-major algorithm:" << endl;
         ctrl.approach = HERMITIAN_TRIDIAG_SQUARE;
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( UpperOrLower uplo,
+  const DistMatrix<F>& A,
+  const DistMatrix<F,STAR,STAR>& t,
+  const BulgeReflectors<F>& bulge,
+        DistMatrix<F>& AOrig,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = AOrig.Height();
+    const Real infNormAOrig = HermitianInfinityNorm( uplo, AOrig );
+    const Real frobNormAOrig = HermitianFrobeniusNorm( uplo, AOrig );
+    if( g.Rank() == 0 )
+        cout << "Testing error..." << endl;
+
+    // Form the symmetric tridiagonal matrix from the main diagonal and the
+    // diagonal adjacent to it within the stored triangle
+    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    DistMatrix<Real,STAR,STAR> d( A.GetRealPartOfDiagonal() ),
+                               e( A.GetRealPartOfDiagonal(subdiagonal) );
+    DistMatrix<F> B(g);
+    Zeros( B, m, m );
+    for( Int j=0; j<m; ++j )
+        B.Set( j, j, d.GetLocal(j,0) );
+    for( Int j=0; j<m-1; ++j )
+    {
+        B.Set( j+1, j, e.GetLocal(j,0) );
+        B.Set( j, j+1, e.GetLocal(j,0) );
+    }
+    if( print )
+        Print( B, "Tridiagonal" );
+
+    // Reverse the accumulated Householder transforms, ignoring symmetry
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, bulge, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, t, bulge, B );
+    if( print )
+        Print( B, "Rotated tridiagonal" );
+
+    // Compare the appropriate triangle of AOrig and B
+    MakeTriangular( uplo, AOrig );
+    MakeTriangular( uplo, B );
+    Axpy( F(-1), AOrig, B );
+    if( print )
+        Print( B, "Error in rotated tridiagonal" );
+    const Real infNormError = HermitianInfinityNorm( uplo, B );
+    const Real frobNormError = HermitianFrobeniusNorm( uplo, B );
+
+    // Compute || I - Q^H Q ||
+    MakeIdentity( B );
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, bulge, B );
+    herm_tridiag::ApplyQ( LEFT, uplo, ADJOINT, A, t, bulge, B );
+    UpdateDiagonal( B, F(-1) );
+    const Real infNormQError = InfinityNorm( B );
+    const Real frobNormQError = FrobeniusNorm( B );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_oo = " << infNormAOrig << "\n"
+             << "    ||A||_F  = " << frobNormAOrig << "\n"
+             << "    || I - Q^H Q ||_oo = " << infNormQError << "\n"
+             << "    || I - Q^H Q ||_F  = " << frobNormQError << "\n"
+             << "    ||A - Q T Q^H||_oo = " << infNormError << "\n"
+             << "    ||A - Q T Q^H||_F  = " << frobNormError << endl;
+    }
+}
+
+template<typename F>
+void TestHermitianTridiagTwoStage
+( UpperOrLower uplo, Int m, const Grid& g, bool testCorrectness, bool print )
+{
+    DistMatrix<F> A(g), AOrig(g);
+    DistMatrix<F,STAR,STAR> t(g);
+    BulgeReflectors<F> bulge;
+
+    Wigner( A, m );
+    if( testCorrectness )
+    {
+        if( g.Rank() == 0 )
+        {
+            cout << "  Making copy of original matrix...";
+            cout.flush();
+        }
+        AOrig = A;
+        if( g.Rank() == 0 )
+            cout << "DONE" << endl;
+    }
+    if( print )
+        Print( A, "A" );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting two-stage tridiagonalization...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    herm_tridiag::TwoStage( uplo, A, t, bulge );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    const double realGFlops = 16./3.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds. GFlops = "
+             << gFlops << endl;
+    }
+    if( print )
+    {
+        Print( A, "A after reduction" );
+        Print( t, "t after reduction" );
+    }
+    if( testCorrectness )
+        TestCorrectness( uplo, A, t, bulge, AOrig, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int m = Input("--height","height of matrix",100);
+        const Int nb = Input("--nb","algorithmic blocksize and bandwidth",32);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool testReal = Input("--testReal","test real matrices?",true);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test two-stage HermitianTridiag" << uploChar << endl;
+
+        if( testReal )
+            TestHermitianTridiagTwoStage<double>
+            ( uplo, m, g, testCorrectness, print );
+        if( testCpx )
+            TestHermitianTridiagTwoStage<Complex<double>>
+            ( uplo, m, g, testCorrectness, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
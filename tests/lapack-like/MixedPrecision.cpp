@@ -0,0 +1,142 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Check that the solution X of A X = B has the reported backward error and
+// that the solve took the expected route
+template<typename F>
+void TestCorrectness
+( bool print, bool hpd, bool expectFallback,
+  const MixedPrecisionInfo<Base<F>>& info,
+  const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& X )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    DistMatrix<F> R( B );
+    if( hpd )
+        Hemm( LEFT, LOWER, F(-1), A, X, F(1), R );
+    else
+        Gemm( NORMAL, NORMAL, F(-1), A, X, F(1), R );
+    if( print )
+        Print( R, "B - A X" );
+    const Real frobNormOfA =
+        ( hpd ? HermitianFrobeniusNorm( LOWER, A ) : FrobeniusNorm( A ) );
+    const Real backwardError =
+        FrobeniusNorm(R) / (frobNormOfA*FrobeniusNorm(X)+FrobeniusNorm(B));
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = Sqrt(Real(n))*eps;
+
+    const bool routeOkay =
+        ( expectFallback ? info.fellBack && !info.converged &&
+                           info.numRefineIts == 0 && info.numGMRESIts == 0
+                         : info.converged && !info.fellBack );
+    const bool reportOkay =
+        Abs(backwardError-info.backwardError) <= 10*eps*Max(backwardError,tol);
+    const bool passed = routeOkay && reportOkay && backwardError <= 100*tol;
+    if( g.Rank() == 0 )
+    {
+        cout << "    converged            = " << info.converged << "\n"
+             << "    fell back            = " << info.fellBack << "\n"
+             << "    refinement its       = " << info.numRefineIts << "\n"
+             << "    GMRES its            = " << info.numGMRESIts << "\n"
+             << "    reported backward error = " << info.backwardError << "\n"
+             << "    actual backward error   = " << backwardError << "\n"
+             << "    " << ( passed ? "PASSED" : "FAILED" ) << "\n" << endl;
+    }
+}
+
+template<typename F>
+void TestMixedPrecision
+( bool print, Int n, Int numRhs, const MixedPrecisionCtrl<Base<F>>& ctrl,
+  const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), B(g), X(g);
+    for( const bool hpd : {false,true} )
+    {
+        const string routine =
+            ( hpd ? "MixedPrecisionHPDSolve" :
+                    "MixedPrecisionGaussianElimination" );
+
+        // A well-conditioned matrix, which the refinement should handle
+        HermitianUniformSpectrum( A, n, Real(1), Real(10) );
+        Uniform( B, n, numRhs );
+        X = B;
+        if( g.Rank() == 0 )
+            cout << "  " << routine << " with a well-conditioned matrix:"
+                 << endl;
+        MixedPrecisionInfo<Real> info =
+          ( hpd ? MixedPrecisionHPDSolve( LOWER, A, X, ctrl )
+                : MixedPrecisionGaussianElimination( A, X, ctrl ) );
+        TestCorrectness( print, hpd, false, info, A, B, X );
+
+        // ones(n,n) + delta I is HPD in the working precision but exactly
+        // singular once rounded to single precision, so the lower-precision
+        // factorization must break down and the solve must fall back
+        Ones( A, n, n );
+        UpdateDiagonal( A, F(Real(1e-10)) );
+        Uniform( B, n, numRhs );
+        X = B;
+        if( g.Rank() == 0 )
+            cout << "  " << routine << " with a matrix which is singular in "
+                 << "single precision:" << endl;
+        info =
+          ( hpd ? MixedPrecisionHPDSolve( LOWER, A, X, ctrl )
+                : MixedPrecisionGaussianElimination( A, X, ctrl ) );
+        TestCorrectness( print, hpd, true, info, A, B, X );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--size","size of matrix",100);
+        const Int numRhs = Input("--numRhs","number of right-hand sides",5);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool gmres = Input("--gmres","allow GMRES-IR?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        MixedPrecisionCtrl<double> ctrl;
+        ctrl.gmres = gmres;
+        ctrl.progress = progress;
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestMixedPrecision<double>( print, n, numRhs, ctrl, g );
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestMixedPrecision<Complex<double>>( print, n, numRhs, ctrl, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Report ||A - Q R||_F / ||A||_F, || I - Q^H Q ||_F, and, for the factor RSolo
+// which was modified without Q, ||A^H A - RSolo^H RSolo||_F / ||A||_F^2
+template<typename F>
+void TestCorrectness
+( const string& label, const DistMatrix<F>& A,
+  const DistMatrix<F,VC,STAR>& Q, const DistMatrix<F,STAR,STAR>& R,
+  const DistMatrix<F,STAR,STAR>& RSolo )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+
+    DistMatrix<F> QMCMR( Q ), RMCMR( R ), RSoloMCMR( RSolo );
+    const Real frobNormOfA = FrobeniusNorm( A );
+
+    auto E( A );
+    Gemm( NORMAL, NORMAL, F(-1), QMCMR, RMCMR, F(1), E );
+    const Real frobNormOfError = FrobeniusNorm( E );
+
+    DistMatrix<F> Z(g);
+    Identity( Z, n, n );
+    Gemm( ADJOINT, NORMAL, F(-1), QMCMR, QMCMR, F(1), Z );
+    const Real frobNormOfOrthogError = FrobeniusNorm( Z );
+
+    DistMatrix<F> C(g);
+    Zeros( C, n, n );
+    Gemm( ADJOINT, NORMAL, F(1), A, A, F(0), C );
+    Gemm( ADJOINT, NORMAL, F(-1), RSoloMCMR, RSoloMCMR, F(1), C );
+    const Real frobNormOfGramError = FrobeniusNorm( C );
+
+    if( g.Rank() == 0 )
+        cout << "  " << label << ":\n"
+             << "    ||A - Q R||_F / ||A||_F             = "
+             << frobNormOfError/frobNormOfA << "\n"
+             << "    ||I - Q^H Q||_F                     = "
+             << frobNormOfOrthogError << "\n"
+             << "    ||A^H A - R^H R||_F / ||A||_F^2     = "
+             << frobNormOfGramError/(frobNormOfA*frobNormOfA) << endl;
+}
+
+template<typename F>
+void TestQRMod( Int m, Int n, Int k, bool print, const Grid& g )
+{
+    DistMatrix<F> A(g);
+    Uniform( A, m, n );
+
+    // Form the initial thin QR factorization
+    DistMatrix<F,VC,STAR> Q(g);
+    DistMatrix<F,STAR,STAR> R(g), RSolo(g);
+    {
+        DistMatrix<F> QMCMR( A ), RMCMR(g);
+        qr::Explicit( QMCMR, RMCMR );
+        Q = QMCMR;
+        R = RMCMR;
+        RSolo = R;
+    }
+    TestCorrectness( "Original factorization", A, Q, R, RSolo );
+
+    // A := [A; W]
+    {
+        DistMatrix<F,STAR,STAR> W(g);
+        Uniform( W, k, n );
+        qr::AppendRows( Q, R, W );
+        qr::AppendRows( RSolo, W );
+
+        DistMatrix<F> ANew(g);
+        Zeros( ANew, m+k, n );
+        auto ANewT = ViewRange( ANew, 0, 0, m,   n );
+        auto ANewB = ViewRange( ANew, m, 0, m+k, n );
+        ANewT = A;
+        ANewB = W;
+        A = ANew;
+    }
+    if( print )
+    {
+        Print( Q, "Q after appending rows" );
+        Print( R, "R after appending rows" );
+    }
+    TestCorrectness( "After appending rows", A, Q, R, RSolo );
+
+    // A := A with rows [i,i+k) removed
+    {
+        const Int i = (m+k)/3;
+        DistMatrix<F,STAR,STAR> W( LockedViewRange( A, i, 0, i+k, n ) );
+        qr::DeleteRows( Q, R, i, k );
+        qr::DeleteRows( RSolo, W );
+
+        DistMatrix<F> ANew(g);
+        Zeros( ANew, m, n );
+        auto AT = LockedViewRange( A, 0,   0, i,   n );
+        auto AB = LockedViewRange( A, i+k, 0, m+k, n );
+        auto ANewT = ViewRange( ANew, 0, 0, i, n );
+        auto ANewB = ViewRange( ANew, i, 0, m, n );
+        ANewT = AT;
+        ANewB = AB;
+        A = ANew;
+    }
+    TestCorrectness( "After deleting rows", A, Q, R, RSolo );
+
+    // A := [A, U]
+    {
+        DistMatrix<F,VC,STAR> U(g);
+        Uniform( U, m, k );
+        qr::AppendColumns( Q, R, U );
+
+        DistMatrix<F> ANew(g);
+        Zeros( ANew, m, n+k );
+        auto ANewL = ViewRange( ANew, 0, 0, m, n   );
+        auto ANewR = ViewRange( ANew, 0, n, m, n+k );
+        ANewL = A;
+        ANewR = U;
+        A = ANew;
+        RSolo = R;
+    }
+    TestCorrectness( "After appending columns", A, Q, R, RSolo );
+
+    // A := A with columns [j,j+k) removed
+    {
+        const Int j = (n+k)/3;
+        qr::DeleteColumns( Q, R, j, k );
+        qr::DeleteColumns( RSolo, j, k );
+
+        DistMatrix<F> ANew(g);
+        Zeros( ANew, m, n );
+        auto AL = LockedViewRange( A, 0, 0,   m, j   );
+        auto AR = LockedViewRange( A, 0, j+k, m, n+k );
+        auto ANewL = ViewRange( ANew, 0, 0, m, j );
+        auto ANewR = ViewRange( ANew, 0, j, m, n );
+        ANewL = AL;
+        ANewR = AR;
+        A = ANew;
+    }
+    TestCorrectness( "After deleting columns", A, Q, R, RSolo );
+
+    // A := A + U V^H
+    {
+        DistMatrix<F,VC,STAR> U(g);
+        DistMatrix<F,STAR,STAR> V(g);
+        Uniform( U, m, k );
+        Uniform( V, n, k );
+        if( g.Rank() == 0 )
+        {
+            cout << "  Starting rank-" << k << " QR modification...";
+            cout.flush();
+        }
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        QRMod( Q, R, U, V );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        if( g.Rank() == 0 )
+            cout << "DONE.\n" << "  Time = " << runTime << " seconds." << endl;
+
+        DistMatrix<F> UMCMR( U ), VMCMR( V );
+        Gemm( NORMAL, ADJOINT, F(1), UMCMR, VMCMR, F(1), A );
+        RSolo = R;
+    }
+    if( print )
+    {
+        Print( Q, "Q after modification" );
+        Print( R, "R after modification" );
+    }
+    TestCorrectness( "After rank-k modification", A, Q, R, RSolo );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",100);
+        const Int k = Input("--rank","rank of modifications",5);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestQRMod<double>( m, n, k, print, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestQRMod<Complex<double>>( m, n, k, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
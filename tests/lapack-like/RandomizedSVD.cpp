@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  const DistMatrix<F>& AOrig )
+{
+    typedef Base<F> Real;
+    const Grid& g = U.Grid();
+    const Int k = s.Height();
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of singular vectors..." << endl;
+    DistMatrix<F> X(g);
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, F(-1), U, F(1), X );
+    const Real frobNormOfUError = HermitianFrobeniusNorm( LOWER, X );
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, F(-1), V, F(1), X );
+    const Real frobNormOfVError = HermitianFrobeniusNorm( LOWER, X );
+
+    // Form A - U Sigma V^H
+    auto E( AOrig );
+    DistMatrix<F> USigma( U );
+    DiagonalScale( RIGHT, NORMAL, s, USigma );
+    Gemm( NORMAL, ADJOINT, F(-1), USigma, V, F(1), E );
+    if( print )
+        Print( E, "A - U Sigma V^H" );
+    const Real frobNormOfA = FrobeniusNorm( AOrig );
+    const Real frobNormOfE = FrobeniusNorm( E );
+
+    // The best possible error is the norm of the trailing singular values
+    auto ACopy( AOrig );
+    DistMatrix<Real,VR,STAR> sExact(g);
+    SVD( ACopy, sExact );
+    auto sTail = LockedView( sExact, k, 0, sExact.Height()-k, 1 );
+    const Real frobNormOfTail = FrobeniusNorm( sTail );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||U^H U - I||_F         = " << frobNormOfUError << "\n"
+             << "    ||V^H V - I||_F         = " << frobNormOfVError << "\n"
+             << "    ||A||_F                 = " << frobNormOfA << "\n"
+             << "    ||A - U Sigma V^H||_F   = " << frobNormOfE << "\n"
+             << "    ||A - A_k||_F           = " << frobNormOfTail << "\n"
+             << endl;
+    }
+}
+
+template<typename F>
+void TestRandomizedSVD
+( bool testCorrectness, bool print, Int m, Int n, Int rank,
+  Base<F> noise, const RandomizedSVDCtrl& ctrl, const Grid& g )
+{
+    DistMatrix<F> A(g), AOrig(g), B(g), C(g), U(g), V(g);
+    DistMatrix<Base<F>,VR,STAR> s(g);
+
+    // Build a rank-'rank' matrix and perturb it with a small amount of noise
+    Gaussian( B, m, rank );
+    Gaussian( C, rank, n );
+    Gaussian( A, m, n, F(0), noise );
+    Gemm( NORMAL, NORMAL, F(1), B, C, F(1), A );
+    if( testCorrectness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting randomized SVD...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    svd::Randomized( A, rank, U, s, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds." << endl;
+    if( print )
+    {
+        Print( U, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+    if( testCorrectness )
+        TestCorrectness( print, U, s, V, AOrig );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",200);
+        const Int n = Input("--width","width of matrix",100);
+        const Int rank = Input("--rank","rank of approximation",10);
+        const double noise = Input("--noise","std. dev. of noise",1e-6);
+        const Int oversample = Input("--oversample","oversampling amount",10);
+        const Int powerIts = Input("--powerIts","number of power iterations",1);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool testReal = Input("--testReal","test real matrices?",true);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test randomized SVD" << endl;
+
+        RandomizedSVDCtrl ctrl;
+        ctrl.oversample = oversample;
+        ctrl.numPowerIts = powerIts;
+        if( testReal )
+        {
+            if( commRank == 0 )
+                cout << "Testing with doubles:" << endl;
+            TestRandomizedSVD<double>
+            ( testCorrectness, print, m, n, rank, noise, ctrl, g );
+        }
+        if( testCpx )
+        {
+            if( commRank == 0 )
+                cout << "Testing with double-precision complex:" << endl;
+            TestRandomizedSVD<Complex<double>>
+            ( testCorrectness, print, m, n, rank, noise, ctrl, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
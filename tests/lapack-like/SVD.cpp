@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( bool print,
+  const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  const DistMatrix<F>& AOrig,
+  const SVDCtrl& ctrl )
+{
+    typedef Base<F> Real;
+    const Grid& g = U.Grid();
+    const Int k = s.Height();
+
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of singular vectors..." << endl;
+    auto UL = LockedView( U, 0, 0, U.Height(), k );
+    auto VL = LockedView( V, 0, 0, V.Height(), k );
+    DistMatrix<F> X(g);
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, F(-1), UL, F(1), X );
+    const Real frobNormOfUError = HermitianFrobeniusNorm( LOWER, X );
+    Identity( X, k, k );
+    Herk( LOWER, ADJOINT, F(-1), VL, F(1), X );
+    const Real frobNormOfVError = HermitianFrobeniusNorm( LOWER, X );
+
+    // Form A - U Sigma V^H
+    auto E( AOrig );
+    DistMatrix<F> USigma( UL );
+    DiagonalScale( RIGHT, NORMAL, s, USigma );
+    Gemm( NORMAL, ADJOINT, F(-1), USigma, VL, F(1), E );
+    if( print )
+        Print( E, "A - U Sigma V^H" );
+    const Real frobNormOfA = FrobeniusNorm( AOrig );
+    const Real frobNormOfE = FrobeniusNorm( E );
+
+    // Compare against the singular values computed without the vectors
+    auto B( AOrig );
+    DistMatrix<Real,VR,STAR> sOnly(g);
+    SVD( B, sOnly, ctrl );
+    Sort( sOnly, DESCENDING );
+    DistMatrix<Real,VR,STAR> sSorted( s );
+    Sort( sSorted, DESCENDING );
+    Axpy( Real(-1), sSorted, sOnly );
+    const Real maxNormOfs = MaxNorm( s );
+    const Real maxNormOfsErr = MaxNorm( sOnly );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||U^H U - I||_F         = " << frobNormOfUError << "\n"
+             << "    ||V^H V - I||_F         = " << frobNormOfVError << "\n"
+             << "    ||A||_F                 = " << frobNormOfA << "\n"
+             << "    ||A - U Sigma V^H||_F   = " << frobNormOfE << "\n"
+             << "    ||s||_max               = " << maxNormOfs << "\n"
+             << "    ||s - sOnly||_max       = " << maxNormOfsErr << "\n"
+             << endl;
+    }
+}
+
+// Uniform matrices almost surely have full rank, so rank-deficient matrices
+// and matrices with a zero column are also tested, as they lead to
+// (numerically) zero singular values
+template<typename F>
+void TestSVD
+( bool testCorrectness, bool print, Int m, Int n, Int rank, Int testCase,
+  const SVDCtrl& ctrl, const Grid& g )
+{
+    DistMatrix<F> A(g), AOrig(g), V(g);
+    DistMatrix<Base<F>,VR,STAR> s(g);
+
+    if( testCase == 0 )
+    {
+        if( g.Rank() == 0 )
+            cout << "  Uniform matrix" << endl;
+        Uniform( A, m, n );
+    }
+    else if( testCase == 1 )
+    {
+        if( g.Rank() == 0 )
+            cout << "  Rank-" << rank << " matrix" << endl;
+        DistMatrix<F> B(g), C(g);
+        Uniform( B, m, rank );
+        Uniform( C, rank, n );
+        Zeros( A, m, n );
+        Gemm( NORMAL, NORMAL, F(1), B, C, F(0), A );
+    }
+    else
+    {
+        if( g.Rank() == 0 )
+            cout << "  Uniform matrix with a zero column" << endl;
+        Uniform( A, m, n );
+        auto a = View( A, 0, n/2, m, 1 );
+        Zero( a );
+    }
+    if( testCorrectness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting SVD...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    SVD( A, s, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds." << endl;
+    if( print )
+    {
+        Print( A, "U" );
+        Print( s, "s" );
+        Print( V, "V" );
+    }
+    if( testCorrectness )
+        TestCorrectness( print, A, s, V, AOrig, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int rank = Input("--rank","rank of rank-deficient matrix",5);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        const bool testReal = Input("--testReal","test real matrices?",true);
+        const bool testCpx = Input("--testCpx","test complex matrices?",true);
+        const bool testTwoStage =
+            Input("--testTwoStage","test two-stage bidiag?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test SVD" << endl;
+
+        SVDCtrl ctrl;
+        for( Int stage=0; stage<(testTwoStage?2:1); ++stage )
+        {
+            ctrl.useTwoStage = ( stage == 1 );
+            if( commRank == 0 )
+                cout << ( ctrl.useTwoStage ? "Two-stage" : "Standard" )
+                     << " bidiagonalization:" << endl;
+            if( testReal )
+            {
+                if( commRank == 0 )
+                    cout << "Testing with doubles:" << endl;
+                for( Int testCase=0; testCase<3; ++testCase )
+                    TestSVD<double>
+                    ( testCorrectness, print, m, n, rank, testCase, ctrl, g );
+            }
+            if( testCpx )
+            {
+                if( commRank == 0 )
+                    cout << "Testing with double-precision complex:" << endl;
+                for( Int testCase=0; testCase<3; ++testCase )
+                    TestSVD<Complex<double>>
+                    ( testCorrectness, print, m, n, rank, testCase, ctrl, g );
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}